@@ -0,0 +1,202 @@
+#pragma once
+
+// The number of tasks defined by the single extension script
+constexpr uint32_t GenerateTaskCount = 20;
+
+// The number of compile operations created by a single task
+constexpr uint32_t GenerateCompileCount = 5000;
+
+/// <summary>
+/// Write an extension script that chains many tasks, each reading the active state left by the
+/// previous task and creating a single operation
+/// </summary>
+void WriteGenerateBenchmarkScript(const std::filesystem::path& scriptFile)
+{
+	auto script = std::ofstream(scriptFile);
+	script << "import \"soup\" for Soup, SoupTask\n";
+	for (auto i = 0u; i < GenerateTaskCount; i++)
+	{
+		script << "\n";
+		script << "class Task" << i << " is SoupTask {\n";
+		script << "	static runBefore { [] }\n";
+		if (i == 0)
+			script << "	static runAfter { [] }\n";
+		else
+			script << "	static runAfter { [\"Task" << (i - 1) << "\"] }\n";
+		script << "	static evaluate() {\n";
+		script << "		var count = Soup.activeState.containsKey(\"Count\") ? Soup.activeState[\"Count\"] : 0\n";
+		script << "		Soup.activeState[\"Count\"] = count + 1\n";
+		script << "		Soup.createOperation(\n";
+		script << "			\"Task" << i << "\",\n";
+		script << "			\"/bench/bin/tool\",\n";
+		script << "			[\"" << i << "\"],\n";
+		script << "			\"/bench/\",\n";
+		script << "			[],\n";
+		script << "			[\"./out/" << i << ".obj\"])\n";
+		script << "	}\n";
+		script << "}\n";
+	}
+}
+
+/// <summary>
+/// Write an extension script that creates the same compile operations one call at a time and as a single batch
+/// </summary>
+void WriteCreateOperationsBenchmarkScript(const std::filesystem::path& scriptFile)
+{
+	auto script = std::ofstream(scriptFile);
+	script << "import \"soup\" for Soup, SoupTask\n";
+	script << "\n";
+	script << "class CompileEach is SoupTask {\n";
+	script << "	static evaluate() {\n";
+	script << "		for (i in 0..." << GenerateCompileCount << ") {\n";
+	script << "			Soup.createOperation(\n";
+	script << "				\"Compile %(i)\",\n";
+	script << "				\"/bench/bin/compiler\",\n";
+	script << "				[\"-c\", \"-O2\", \"-std=c++20\", \"-Iinclude/\", \"%(i).cpp\"],\n";
+	script << "				\"/bench/\",\n";
+	script << "				[\"./obj/pch.gch\", \"./%(i).cpp\"],\n";
+	script << "				[\"./obj/%(i).o\"])\n";
+	script << "		}\n";
+	script << "	}\n";
+	script << "}\n";
+	script << "\n";
+	script << "class CompileBatch is SoupTask {\n";
+	script << "	static evaluate() {\n";
+	script << "		var operations = []\n";
+	script << "		for (i in 0..." << GenerateCompileCount << ") {\n";
+	script << "			operations.add({\n";
+	script << "				\"Title\": \"Compile %(i)\",\n";
+	script << "				\"Arguments\": [\"%(i).cpp\"],\n";
+	script << "				\"DeclaredInput\": [\"./%(i).cpp\"],\n";
+	script << "				\"DeclaredOutput\": [\"./obj/%(i).o\"],\n";
+	script << "			})\n";
+	script << "		}\n";
+	script << "		Soup.createOperations(\n";
+	script << "			\"/bench/bin/compiler\",\n";
+	script << "			\"/bench/\",\n";
+	script << "			[\"-c\", \"-O2\", \"-std=c++20\", \"-Iinclude/\"],\n";
+	script << "			[\"./obj/pch.gch\"],\n";
+	script << "			operations)\n";
+	script << "	}\n";
+	script << "}\n";
+}
+
+/// <summary>
+/// Measure a generate phase for an extension that defines many tasks, comparing a new Wren host for every
+/// task against reusing the host that discovered the extensions and a pool that stays warm across packages
+/// </summary>
+void RunGenerateBenchmarks()
+{
+	// Only surface failures, the tasks log every state transition
+	auto listener = std::make_shared<ConsoleTraceListener>(
+		"Log",
+		std::make_shared<EventTypeFilter>(
+			static_cast<TraceEventFlag>(
+				static_cast<uint32_t>(TraceEventFlag::Error) |
+				static_cast<uint32_t>(TraceEventFlag::Critical))),
+		false,
+		false);
+	auto scopedTraceListener = ScopedTraceListenerRegister(listener);
+
+	auto workingDirectory = std::filesystem::temp_directory_path() / "soup-generate-bench";
+	std::filesystem::create_directories(workingDirectory);
+	auto scriptFile = Path::Parse((workingDirectory / "Extension.wren").string());
+	WriteGenerateBenchmarkScript(workingDirectory / "Extension.wren");
+
+	auto fileSystemState = FileSystemState();
+	auto createState = [&]()
+	{
+		return Generate::GenerateState(
+			ValueTable(),
+			fileSystemState,
+			std::vector<Path>({ Path("/bench/") }),
+			std::vector<Path>({ Path("/bench/") }));
+	};
+
+	auto bench = ankerl::nanobench::Bench();
+	bench.title(std::format("Generate {} Tasks", GenerateTaskCount))
+		.unit("task")
+		.batch(GenerateTaskCount)
+		.warmup(1)
+		.minEpochIterations(5);
+
+	bench.run(std::format("Generate {} Tasks Host Per Task", GenerateTaskCount), [&]
+	{
+		auto discoveryHost = Generate::GenerateHost(scriptFile, std::nullopt);
+		discoveryHost.InterpretMain();
+		auto extensions = discoveryHost.DiscoverExtensions();
+
+		// The tasks are chained in declaration order so no sorting is required
+		auto state = createState();
+		for (auto& extension : extensions)
+		{
+			auto host = Generate::GenerateHost(extension.ScriptFile, extension.BundlesFile);
+			host.InterpretMain();
+			host.SetState(state);
+			host.EvaluateTask(extension.Name);
+			auto updatedActiveState = host.GetUpdatedActiveState();
+			auto updatedSharedState = host.GetUpdatedSharedState();
+			state.Update(std::move(updatedActiveState), std::move(updatedSharedState));
+		}
+
+		ankerl::nanobench::doNotOptimizeAway(state.BuildOperationGraph());
+	});
+
+	auto runReusedHost = [&](Generate::GenerateHostPool& hostPool)
+	{
+		auto extensionManager = Generate::ExtensionManager(hostPool);
+		auto discoveryHost = hostPool.Acquire(scriptFile, std::nullopt);
+		for (auto& extension : discoveryHost->DiscoverExtensions())
+			extensionManager.RegisterExtensionTask(std::move(extension));
+		hostPool.Release(std::move(discoveryHost));
+
+		auto state = createState();
+		extensionManager.Execute(state);
+		ankerl::nanobench::doNotOptimizeAway(state.BuildOperationGraph());
+	};
+
+	bench.run(std::format("Generate {} Tasks Reused Host", GenerateTaskCount), [&]
+	{
+		auto hostPool = Generate::GenerateHostPool();
+		runReusedHost(hostPool);
+	});
+
+	auto warmHostPool = Generate::GenerateHostPool();
+	bench.run(std::format("Generate {} Tasks Warm Pool", GenerateTaskCount), [&]
+	{
+		runReusedHost(warmHostPool);
+	});
+
+	// Include the calls from Wren into the host, a single create crosses once per operation and the batch once per task
+	auto createOperationsScriptFile = Path::Parse((workingDirectory / "CreateOperations.wren").string());
+	WriteCreateOperationsBenchmarkScript(workingDirectory / "CreateOperations.wren");
+	auto createOperationsHost = Generate::GenerateHost(createOperationsScriptFile, std::nullopt);
+	createOperationsHost.InterpretMain();
+	auto runCreateOperationsTask = [&](const std::string& className)
+	{
+		auto state = createState();
+		createOperationsHost.SetState(state);
+		createOperationsHost.EvaluateTask(className);
+		createOperationsHost.ResetState();
+		ankerl::nanobench::doNotOptimizeAway(state.BuildOperationGraph());
+	};
+
+	auto compileBench = ankerl::nanobench::Bench();
+	compileBench.title(std::format("Generate {} Compiles", GenerateCompileCount))
+		.unit("operation")
+		.batch(GenerateCompileCount)
+		.epochs(3)
+		.epochIterations(1);
+
+	compileBench.run(std::format("Generate {} Compiles createOperation", GenerateCompileCount), [&]
+	{
+		runCreateOperationsTask("CompileEach");
+	});
+
+	compileBench.run(std::format("Generate {} Compiles createOperations", GenerateCompileCount), [&]
+	{
+		runCreateOperationsTask("CompileBatch");
+	});
+
+	std::filesystem::remove_all(workingDirectory);
+}
@@ -1,5 +1,22 @@
 #include "nanobench.h"
+#include <atomic>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
 #include <set>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/ptrace.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 import Monitor.Host;
 import Opal;
@@ -9,8 +26,17 @@ using namespace Opal;
 using namespace Opal::System;
 using namespace Soup::Core;
 
-int main()
+#include "GenerateBenchmarks.h"
+#include "MonitorBenchmarks.h"
+
+int main(int argc, char** argv)
 {
+#ifdef __linux__
+	// The monitor benchmarks run their workloads in a child copy of this executable
+	if (argc == 4 && std::string_view(argv[1]) == "--workload")
+		return RunMonitorWorkload(argv[2], static_cast<uint32_t>(std::stoul(argv[3])));
+#endif
+
 	{
 		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReference Parse Name Only", [&]
 		{
@@ -69,8 +95,9 @@ int main()
 		auto fileSystemState = FileSystemState();
 		auto binaryFileContent = std::vector<char>(
 		{
-			'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+			'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 			'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+			'O', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 			'R', 'T', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 		});
 		auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -97,7 +124,7 @@ int main()
 			});
 		auto binaryFileContent = std::vector<uint8_t>(
 		{
-			'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+			'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 			'F', 'I', 'S', '\0', 0x08, 0x00, 0x00, 0x00,
 			0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
 			0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
@@ -107,17 +134,25 @@ int main()
 			0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '6',
 			0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '7',
 			0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '8',
+			'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00,
 			'R', 'T', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
 			0x05, 0x00, 0x00, 0x00,
 			0x01, 0x00, 0x00, 0x00,
 			0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+			0x00, 0x00, 0x00, 0x00,
 			0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
 			0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00,
 			0x06, 0x00, 0x00, 0x00,
 			0x01, 0x00, 0x00, 0x00,
 			0x80, 0x8d, 0xa9, 0xeb, 0x0b, 0x41, 0x38, 0x00,
+			0x00, 0x00, 0x00, 0x00,
 			0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
 			0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00,
+			0x00, 0x00, 0x00, 0x00,
 		});
 		auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
 
@@ -649,4 +684,142 @@ int main()
 				recipeCache);
 		});
 	}
+
+	{
+		// Each operation reads the output of the previous three operations so the generator
+		// must drop two transitive references per operation while finalizing
+		constexpr uint32_t operationCount = 50000;
+		constexpr size_t epochCount = 3;
+
+		// Build every graph up front so only the finalize is measured
+		auto fileSystemState = FileSystemState();
+		auto generators = std::vector<std::unique_ptr<Generate::OperationGraphGenerator>>();
+		for (auto epoch = 0u; epoch < epochCount; epoch++)
+		{
+			auto generator = std::make_unique<Generate::OperationGraphGenerator>(
+				fileSystemState,
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }),
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }));
+			for (auto i = 0u; i < operationCount; i++)
+			{
+				auto declaredInput = std::vector<Path>();
+				for (auto j = 1u; j <= 3 && j <= i; j++)
+					declaredInput.push_back(Path(std::format("./out/{}.obj", i - j)));
+
+				generator->CreateOperation(
+					std::format("Operation {}", i),
+					Path("C:/bin/tool.exe"),
+					{ std::to_string(i) },
+					Path("C:/WorkingDirectory/"),
+					std::move(declaredInput),
+					{ Path(std::format("./out/{}.obj", i)) });
+			}
+
+			generators.push_back(std::move(generator));
+		}
+
+		auto generatorIndex = 0u;
+		ankerl::nanobench::Bench().epochs(epochCount).epochIterations(1).run("OperationGraphGenerator FinalizeGraph 50k Operations", [&]
+		{
+			auto actual = generators[generatorIndex++]->FinalizeGraph();
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+	}
+
+	{
+		// A typical compile step, every operation shares the compiler, working directory, flags and a
+		// precompiled header while only the source and object file change
+		constexpr uint32_t operationCount = 5000;
+		auto fileSystemState = FileSystemState();
+		auto commonArguments = std::vector<std::string>({ "-c", "-O2", "-std=c++20", "-Iinclude/" });
+		auto commonInput = std::vector<Path>({ Path("./obj/pch.gch") });
+		auto createGenerator = [&]()
+		{
+			return Generate::OperationGraphGenerator(
+				fileSystemState,
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }),
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }));
+		};
+
+		ankerl::nanobench::Bench().epochs(3).epochIterations(1).run("OperationGraphGenerator CreateOperation 5k Compiles", [&]
+		{
+			auto generator = createGenerator();
+			for (auto i = 0u; i < operationCount; i++)
+			{
+				auto arguments = commonArguments;
+				arguments.push_back(std::format("{}.cpp", i));
+				auto declaredInput = commonInput;
+				declaredInput.push_back(Path(std::format("./{}.cpp", i)));
+				generator.CreateOperation(
+					std::format("Compile {}", i),
+					Path("C:/bin/compiler.exe"),
+					std::move(arguments),
+					Path("C:/WorkingDirectory/"),
+					std::move(declaredInput),
+					{ Path(std::format("./obj/{}.o", i)) });
+			}
+
+			ankerl::nanobench::doNotOptimizeAway(generator);
+		});
+
+		ankerl::nanobench::Bench().epochs(3).epochIterations(1).run("OperationGraphGenerator CreateOperations 5k Compiles", [&]
+		{
+			auto generator = createGenerator();
+			auto operations = std::vector<Generate::OperationBatchEntry>();
+			for (auto i = 0u; i < operationCount; i++)
+			{
+				operations.push_back(Generate::OperationBatchEntry({
+					std::format("Compile {}", i),
+					{ std::format("{}.cpp", i) },
+					{ Path(std::format("./{}.cpp", i)) },
+					{ Path(std::format("./obj/{}.o", i)) },
+				}));
+			}
+
+			generator.CreateOperations(
+				Path("C:/bin/compiler.exe"),
+				Path("C:/WorkingDirectory/"),
+				commonArguments,
+				commonInput,
+				std::move(operations));
+			ankerl::nanobench::doNotOptimizeAway(generator);
+		});
+	}
+
+	RunGenerateBenchmarks();
+
+#ifdef __linux__
+	{
+		// Read a typical header path out of a stopped tracee, the fork keeps the buffer at the same address
+		auto path = std::string("/usr/lib/gcc/x86_64-linux-gnu/13/../../../../include/c++/13/bits/stl_algobase.h");
+		auto processId = fork();
+		if (processId == 0)
+		{
+			ptrace(PTRACE_TRACEME, 0, nullptr, nullptr);
+			raise(SIGSTOP);
+			_exit(0);
+		}
+
+		int status;
+		waitpid(processId, &status, 0);
+		auto address = reinterpret_cast<long>(path.data());
+
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("LinuxTraceeMemory PeekNullTerminatedString", [&]
+		{
+			auto actual = Monitor::Linux::LinuxTraceeMemory::PeekNullTerminatedString(processId, address);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("LinuxTraceeMemory ReadNullTerminatedString", [&]
+		{
+			auto actual = Monitor::Linux::LinuxTraceeMemory::ReadNullTerminatedString(processId, address);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+
+		kill(processId, SIGKILL);
+		waitpid(processId, &status, 0);
+	}
+
+	RunMonitorBenchmarks();
+#endif
 }
\ No newline at end of file
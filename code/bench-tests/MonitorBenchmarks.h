@@ -0,0 +1,280 @@
+#pragma once
+
+#ifdef __linux__
+
+/// <summary>
+/// A system access monitor that only counts the events it receives
+/// </summary>
+class CountingAccessMonitor : public Monitor::ISystemAccessMonitor
+{
+private:
+	std::atomic<uint64_t> _eventCount;
+
+public:
+	CountingAccessMonitor() :
+		_eventCount(0)
+	{
+	}
+
+	uint64_t GetEventCount() const
+	{
+		return _eventCount;
+	}
+
+	void OnCreateProcess(std::string_view applicationName, bool wasDetoured) override final
+	{
+		_eventCount++;
+	}
+
+	void TouchFileRead(Path filePath, bool exists, bool wasBlocked) override final
+	{
+		_eventCount++;
+	}
+
+	void TouchFileWrite(Path filePath, bool wasBlocked) override final
+	{
+		_eventCount++;
+	}
+
+	void TouchFileDelete(Path filePath, bool wasBlocked) override final
+	{
+		_eventCount++;
+	}
+
+	void TouchFileDeleteOnClose(Path filePath) override final
+	{
+		_eventCount++;
+	}
+
+	void SearchPath(std::string_view path, std::string_view filename) override final
+	{
+		_eventCount++;
+	}
+};
+
+// The distinct input files, the access monitor drops repeated paths so each open must use a new one
+constexpr uint32_t MonitorWorkloadFileCount = 20000;
+
+/// <summary>
+/// Run a single workload inside the child copy of the benchmark executable
+/// </summary>
+int RunMonitorWorkload(std::string_view name, uint32_t count)
+{
+	if (name == "open")
+	{
+		if (count > MonitorWorkloadFileCount)
+			return 2;
+
+		for (auto i = 0u; i < count; i++)
+		{
+			auto fileName = std::format("Input{}.txt", i);
+			auto handle = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+			if (handle < 0)
+				return 1;
+			close(handle);
+		}
+	}
+	else if (name == "stat")
+	{
+		if (count > MonitorWorkloadFileCount)
+			return 2;
+
+		for (auto i = 0u; i < count; i++)
+		{
+			auto fileName = std::format("Input{}.txt", i);
+			struct stat fileStatus;
+			if (stat(fileName.c_str(), &fileStatus) != 0)
+				return 1;
+		}
+	}
+	else if (name == "spawn")
+	{
+		// Each child is a fresh copy of this executable that exits right away
+		auto executable = std::filesystem::read_symlink("/proc/self/exe").string();
+		for (auto i = 0u; i < count; i++)
+		{
+			auto processId = fork();
+			if (processId == 0)
+			{
+				execl(executable.c_str(), executable.c_str(), "--workload", "exit", "0", nullptr);
+				_exit(127);
+			}
+
+			int status;
+			if (processId < 0 || waitpid(processId, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+				return 1;
+		}
+	}
+	else if (name == "write")
+	{
+		// Write full lines to measure draining the output pipes
+		auto line = std::string(127, 'x') + '\n';
+		for (auto i = 0u; i < count; i++)
+		{
+			if (write(STDOUT_FILENO, line.data(), line.size()) != static_cast<ssize_t>(line.size()))
+				return 1;
+		}
+	}
+	else if (name != "exit")
+	{
+		return 2;
+	}
+
+	return 0;
+}
+
+/// <summary>
+/// Measure the cost the Linux monitor adds to each workload by running the same child unmonitored,
+/// with the partial monitor and fully monitored by each backend. The throughput is reported per
+/// workload unit and the overhead summary subtracts the unmonitored time.
+/// The stat family is not monitored, so the stat workload only measures the cost of the filter itself.
+/// </summary>
+void RunMonitorBenchmarks()
+{
+	struct MonitorWorkload
+	{
+		std::string Name;
+		std::string Unit;
+		uint32_t Count;
+	};
+
+	auto workloads = std::vector<MonitorWorkload>({
+		{ "open", "open", MonitorWorkloadFileCount },
+		{ "stat", "stat", MonitorWorkloadFileCount },
+		{ "spawn", "process", 50 },
+		{ "write", "line", 100000 },
+	});
+
+	// Only surface failures
+	auto listener = std::make_shared<ConsoleTraceListener>(
+		"Log",
+		std::make_shared<EventTypeFilter>(
+			static_cast<TraceEventFlag>(
+				static_cast<uint32_t>(TraceEventFlag::Error) |
+				static_cast<uint32_t>(TraceEventFlag::Critical))),
+		false,
+		false);
+	auto scopedTraceListener = ScopedTraceListenerRegister(listener);
+
+	auto processManager = std::make_shared<LinuxProcessManager>();
+	auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+	// Setup the shared input files for the workloads
+	auto workingDirectory = std::filesystem::temp_directory_path() / "soup-monitor-bench";
+	std::filesystem::create_directories(workingDirectory);
+	for (auto i = 0u; i < MonitorWorkloadFileCount; i++)
+		std::ofstream(workingDirectory / std::format("Input{}.txt", i)) << i;
+
+	auto executablePath = std::filesystem::read_symlink("/proc/self/exe");
+	auto executable = Path::Parse(executablePath.string());
+	auto workingDirectoryPath = Path::Parse(workingDirectory.string() + "/");
+
+	struct MonitorBackend
+	{
+		std::string Name;
+		Monitor::Linux::LinuxMonitorBackend Value;
+	};
+
+	auto backends = std::vector<MonitorBackend>({
+		{ "Trace", Monitor::Linux::LinuxMonitorBackend::Trace },
+		{ "UserNotification", Monitor::Linux::LinuxMonitorBackend::UserNotification },
+	});
+
+	// The preload backend loads the client library from beside the executable
+	if (std::filesystem::exists(executablePath.parent_path() / "Monitor.Client.so"))
+		backends.push_back({ "Preload", Monitor::Linux::LinuxMonitorBackend::Preload });
+	else
+		std::cout << "Monitor.Client.so not found, skipping the Preload backend\n";
+
+	for (auto& workload : workloads)
+	{
+		auto arguments = std::vector<std::string>({ "--workload", workload.Name, std::to_string(workload.Count) });
+		auto runWorkload = [&](std::shared_ptr<IProcess> process)
+		{
+			process->Start();
+			process->WaitForExit();
+			if (process->GetExitCode() != 0)
+				throw std::runtime_error(std::format("Monitor workload {} failed", workload.Name));
+		};
+
+		auto runMonitoredWorkload = [&](bool partialMonitor, Monitor::Linux::LinuxMonitorBackend backend)
+		{
+			auto monitor = std::make_shared<CountingAccessMonitor>();
+			runWorkload(std::make_shared<Monitor::Linux::LinuxMonitorProcess>(
+				executable,
+				arguments,
+				workingDirectoryPath,
+				monitor,
+				false,
+				partialMonitor,
+				backend,
+				std::make_shared<const std::vector<Path>>(),
+				std::make_shared<const std::vector<Path>>()));
+			return monitor->GetEventCount();
+		};
+
+		auto bench = ankerl::nanobench::Bench();
+		bench.title(std::format("Monitor {}", workload.Name))
+			.unit(workload.Unit)
+			.batch(workload.Count)
+			.warmup(1)
+			.epochs(5)
+			.epochIterations(1);
+
+		bench.run(std::format("Monitor {} Unmonitored", workload.Name), [&]
+		{
+			runWorkload(processManager->CreateProcess(
+				executable,
+				arguments,
+				workingDirectoryPath,
+				true));
+		});
+
+		bench.run(std::format("Monitor {} Partial Monitor", workload.Name), [&]
+		{
+			runMonitoredWorkload(true, Monitor::Linux::LinuxMonitorBackend::Trace);
+		});
+
+		auto fullEventCounts = std::vector<uint64_t>(backends.size(), 0);
+		for (auto i = 0u; i < backends.size(); i++)
+		{
+			bench.run(std::format("Monitor {} Full Monitor {}", workload.Name, backends[i].Name), [&]
+			{
+				fullEventCounts[i] = runMonitoredWorkload(false, backends[i].Value);
+			});
+		}
+
+		// Report the time the monitor adds to each unit of work and the rate it delivers events
+		auto& results = bench.results();
+		auto getTimePerUnit = [&](size_t index)
+		{
+			return results[index].median(ankerl::nanobench::Result::Measure::elapsed) / results[index].config().mBatch;
+		};
+
+		auto unmonitoredTime = getTimePerUnit(0);
+		auto partialTime = getTimePerUnit(1);
+		std::cout << std::format(
+			"Monitor {} overhead: partial {:.1f} ns/{}\n",
+			workload.Name,
+			(partialTime - unmonitoredTime) * 1e9,
+			workload.Unit);
+
+		for (auto i = 0u; i < backends.size(); i++)
+		{
+			auto fullTime = getTimePerUnit(2 + i);
+			auto fullRunTime = fullTime * workload.Count;
+			std::cout << std::format(
+				"Monitor {} overhead: full {} {:.1f} ns/{}, {} events per run, {:.0f} events/s\n",
+				workload.Name,
+				backends[i].Name,
+				(fullTime - unmonitoredTime) * 1e9,
+				workload.Unit,
+				fullEventCounts[i],
+				fullRunTime > 0 ? fullEventCounts[i] / fullRunTime : 0.0);
+		}
+	}
+
+	std::filesystem::remove_all(workingDirectory);
+}
+
+#endif
@@ -154,10 +154,31 @@ namespace Soup::Client
 		{
 			Log::Diag("Setup BuildOptions");
 			SetupShared(options);
+			SetupMonitorBackend(options.MonitorBackend);
 			return std::make_shared<BuildCommand>(
 				std::move(options));
 		}
 
+		void SetupMonitorBackend(const std::string& backend)
+		{
+			if (backend.empty())
+				return;
+
+			#if defined(__linux__)
+				// Replace the default monitor registered at startup
+				auto value = Monitor::Linux::LinuxMonitorBackend::Trace;
+				if (backend == "notify")
+					value = Monitor::Linux::LinuxMonitorBackend::UserNotification;
+				else if (backend == "preload")
+					value = Monitor::Linux::LinuxMonitorBackend::Preload;
+
+				Log::Diag("Monitor backend: {}", backend);
+				Monitor::IMonitorProcessManager::Register(std::make_shared<Monitor::Linux::LinuxMonitorProcessManager>(value));
+			#else
+				Log::Warning("The monitor backend is only configurable on Linux");
+			#endif
+		}
+
 		std::shared_ptr<ICommand> Setup(RunOptions options)
 		{
 			Log::Diag("Setup RunCommand");
@@ -56,6 +56,10 @@ namespace Soup::Client
 			arguments.SkipEvaluate = _options.SkipEvaluate;
 			arguments.DisableMonitor = _options.DisableMonitor;
 			arguments.PartialMonitor = _options.PartialMonitor;
+			arguments.InProcessGenerate = _options.InProcessGenerate;
+			arguments.UseContentDigests = _options.UseContentDigests;
+			arguments.MaxParallelOperations = _options.MaxParallelOperations;
+			arguments.MaxParallelPackages = _options.MaxParallelPackages;
 
 			// Platform specific defaults
 			#if defined(_WIN32)
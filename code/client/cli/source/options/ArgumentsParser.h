@@ -58,8 +58,45 @@ namespace Soup::Client
 				options->SkipEvaluate = IsFlagSet("skipEvaluate", unusedArgs);
 				options->DisableMonitor = IsFlagSet("disableMonitor", unusedArgs);
 				options->PartialMonitor = IsFlagSet("partialMonitor", unusedArgs);
+				options->InProcessGenerate = IsBooleanFlagSet("inProcessGenerate", unusedArgs);
+				options->UseContentDigests = IsBooleanFlagSet("contentDigests", unusedArgs);
 				options->Force = IsFlagSet("force", unusedArgs);
 
+				auto jobsValue = std::string();
+				if (TryGetValueArgument("j", unusedArgs, jobsValue))
+				{
+					options->MaxParallelOperations = ParseCountArgument("j", jobsValue);
+				}
+				else
+				{
+					// Default to one operation per core
+					options->MaxParallelOperations = std::thread::hardware_concurrency();
+				}
+
+				auto packageJobsValue = std::string();
+				if (TryGetValueArgument("packageJobs", unusedArgs, packageJobsValue))
+				{
+					options->MaxParallelPackages = ParseCountArgument("packageJobs", packageJobsValue);
+				}
+				else
+				{
+					// Default to building one package at a time
+					options->MaxParallelPackages = 1;
+				}
+
+				auto monitorBackendValue = std::string();
+				if (TryGetValueArgument("monitorBackend", unusedArgs, monitorBackendValue))
+				{
+					if (monitorBackendValue != "trace" &&
+						monitorBackendValue != "notify" &&
+						monitorBackendValue != "preload")
+					{
+						throw std::runtime_error(std::format("Invalid value for argument -monitorBackend: {}", monitorBackendValue));
+					}
+
+					options->MonitorBackend = std::move(monitorBackendValue);
+				}
+
 				auto flavorValue = std::string();
 				if (TryGetValueArgument("flavor", unusedArgs, flavorValue))
 				{
@@ -331,6 +368,30 @@ namespace Soup::Client
 			}
 		}
 
+		/// <summary>
+		/// Check a flag that may be followed by an explicit true or false value,
+		/// otherwise the value would be left behind as an unrecognized argument
+		/// </summary>
+		static bool IsBooleanFlagSet(const char* name, std::vector<std::string>& unusedArgs)
+		{
+			auto flagValue = std::string("-") + name;
+			Log::Diag("IsBooleanFlagSet: {}", flagValue);
+			auto flagLocation = std::find(unusedArgs.begin(), unusedArgs.end(), flagValue);
+			if (flagLocation == unusedArgs.end())
+				return false;
+
+			// Consume the flag value
+			auto valueLocation = unusedArgs.erase(flagLocation);
+			if (valueLocation != unusedArgs.end() && (*valueLocation == "true" || *valueLocation == "false"))
+			{
+				auto result = *valueLocation == "true";
+				unusedArgs.erase(valueLocation);
+				return result;
+			}
+
+			return true;
+		}
+
 		static void SplitArguments(const char* name, std::vector<std::string>& unusedArgs, std::vector<std::string>& splitArgs)
 		{
 			auto flagValue = std::string("-") + name;
@@ -357,6 +418,11 @@ namespace Soup::Client
 			{
 				// Consume the flag value
 				auto valueLocation = unusedArgs.erase(nameLocation);
+				if (valueLocation == unusedArgs.end())
+				{
+					throw std::runtime_error(std::format("Missing value for argument: {}", nameValue));
+				}
+
 				value = std::move(*valueLocation);
 				unusedArgs.erase(valueLocation);
 				return true;
@@ -367,6 +433,27 @@ namespace Soup::Client
 			}
 		}
 
+		static uint32_t ParseCountArgument(const char* name, const std::string& value)
+		{
+			// Only accept plain positive integers, stoul would allow signs, whitespace and trailing text
+			auto isNumber = !value.empty() && std::all_of(
+				value.begin(),
+				value.end(),
+				[](char character) { return character >= '0' && character <= '9'; });
+			if (!isNumber || value.size() > 9)
+			{
+				throw std::runtime_error(std::format("Invalid value for argument -{}: {}", name, value));
+			}
+
+			auto count = static_cast<uint32_t>(std::stoul(value));
+			if (count == 0)
+			{
+				throw std::runtime_error(std::format("Argument -{} must be greater than zero", name));
+			}
+
+			return count;
+		}
+
 		static TraceEventFlag CheckVerbosity(std::vector<std::string>& unusedArgs)
 		{
 			auto level = 
@@ -44,12 +44,42 @@ namespace Soup::Client
 		// [[Args::Option("partialMonitor", Default = false, HelpText = "Do not monitor usage for incremental builds.")]]
 		bool PartialMonitor;
 
+		/// <summary>
+		/// Gets or sets the system monitor backend, empty for the platform default
+		/// </summary>
+		// [[Args::Option("monitorBackend", Default = "", HelpText = "Linux monitor backend, one of trace, notify or preload.")]]
+		std::string MonitorBackend;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to run the generate phase in process
+		/// </summary>
+		// [[Args::Option("inProcessGenerate", Default = false, HelpText = "Run the generate phase inside the build process, accepts an optional true or false value.")]]
+		bool InProcessGenerate;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to use content digests for incremental checks
+		/// </summary>
+		// [[Args::Option("contentDigests", Default = false, HelpText = "Compare input file contents instead of write times, accepts an optional true or false value.")]]
+		bool UseContentDigests;
+
 		/// <summary>
 		/// Gets or sets a value indicating whether to force a build
 		/// </summary>
 		// [[Args::Option("force", Default = false, HelpText = "Force a rebuild.")]]
 		bool Force;
 
+		/// <summary>
+		/// Gets or sets the maximum number of operations to run in parallel
+		/// </summary>
+		// [[Args::Option('j', "jobs", Default = 0, HelpText = "Maximum parallel operations, defaults to the core count.")]]
+		uint32_t MaxParallelOperations;
+
+		/// <summary>
+		/// Gets or sets the maximum number of packages to build in parallel
+		/// </summary>
+		// [[Args::Option("packageJobs", Default = 0, HelpText = "Maximum parallel packages, defaults to one.")]]
+		uint32_t MaxParallelPackages;
+
 		/// <summary>
 		/// Gets or sets a value indicating what flavor to use
 		/// </summary>
@@ -7,14 +7,20 @@ module;
 
 #include <any>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
 #include <codecvt>
+#include <condition_variable>
 #include <cstring>
 #include <ctime>
+#include <deque>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <locale>
 #include <map>
+#include <mutex>
 #include <regex>
 #include <optional>
 #include <set>
@@ -22,6 +28,7 @@ module;
 #include <stack>
 #include <string>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
@@ -41,8 +48,12 @@ module;
 
 #elif defined(__linux__)
 
+#include <fcntl.h>
 #include <spawn.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/wait.h>
+#include <unistd.h>
 
 #endif
 
@@ -106,7 +117,9 @@ using namespace Opal;
 #include "utilities/SequenceMap.h"
 #include "build/RecipeBuildLocationManager.h"
 #include "build/BuildEngine.h"
+#include "generate/GenerateEngine.h"
 #include "local-user-config/LocalUserConfigExtensions.h"
 #include "package/PackageManager.h"
+#include "wren/WrenModuleCache.h"
 #include "wren/WrenHost.h"
 #include "wren/WrenValueTable.h"
\ No newline at end of file
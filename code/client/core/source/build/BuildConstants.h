@@ -27,6 +27,18 @@ namespace Soup::Core
 			return value;
 		}
 
+		static const Path& EvaluateResultsJournalFileName()
+		{
+			static const auto value = Path("./Evaluate.boj");
+			return value;
+		}
+
+		static const Path& FileDigestCacheFileName()
+		{
+			static const auto value = Path("./FileDigests.bfd");
+			return value;
+		}
+
 		static const Path& GenerateInputFileName()
 		{
 			static const auto value = Path("./GenerateInput.bvt");
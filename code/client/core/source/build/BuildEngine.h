@@ -159,16 +159,28 @@ namespace Soup::Core
 
 			// Load the system specific state
 			auto systemReadAccess = LoadHostSystemAccess();
+			auto immutableRoots = LoadImmutableRoots(userDataPath, systemReadAccess);
 
 			// Load the file system state
 			auto fileSystemState = PreloadFileSystemState(packageProvider);
 
+			// Load the persisted content digests when requested
+			auto fileDigestCache = FileDigestCache();
+			auto fileDigestCacheFile = userDataPath + BuildConstants::FileDigestCacheFileName();
+			if (arguments.UseContentDigests)
+			{
+				fileDigestCache.TryLoadState(fileDigestCacheFile);
+			}
+
 			// Initialize a shared Evaluate Engine
 			auto evaluateEngine = BuildEvaluateEngine(
 				arguments.ForceRebuild,
 				arguments.DisableMonitor,
 				arguments.PartialMonitor,
-				fileSystemState);
+				arguments.MaxParallelOperations,
+				fileSystemState,
+				arguments.UseContentDigests ? &fileDigestCache : nullptr,
+				immutableRoots);
 
 			// Initialize the build runner that will perform the generate and evaluate phase
 			// for each individual package
@@ -181,7 +193,18 @@ namespace Soup::Core
 				evaluateEngine,
 				fileSystemState,
 				locationManager);
-			buildRunner.Execute();
+			try
+			{
+				buildRunner.Execute();
+			}
+			catch (...)
+			{
+				// Keep the digests hashed before the failure so the next build does not hash them again
+				SaveFileDigestCache(fileDigestCache, fileDigestCacheFile);
+				throw;
+			}
+
+			SaveFileDigestCache(fileDigestCache, fileDigestCacheFile);
 
 			auto endTime = std::chrono::high_resolution_clock::now();
 			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
@@ -197,6 +220,24 @@ namespace Soup::Core
 		}
 
 	private:
+		/// <summary>
+		/// Persist any new content digests, the cache is only an optimization so a failure is not fatal
+		/// </summary>
+		static void SaveFileDigestCache(FileDigestCache& fileDigestCache, const Path& fileDigestCacheFile)
+		{
+			if (!fileDigestCache.IsModified())
+				return;
+
+			try
+			{
+				fileDigestCache.SaveState(fileDigestCacheFile);
+			}
+			catch (const std::exception& ex)
+			{
+				Log::Warning("Failed to save file digest cache: {}", ex.what());
+			}
+		}
+
 		static ValueTable LoadHostSystemState()
 		{
 			auto hostGlobalParameters = ValueTable();
@@ -217,5 +258,36 @@ namespace Soup::Core
 
 			return systemReadAccess;
 		}
+
+		/// <summary>
+		/// Load the directories that do not change between builds, accesses under them are not tracked
+		/// Defaults to the system and SDK read access directories when the local user config does not override them
+		/// </summary>
+		static std::vector<Path> LoadImmutableRoots(
+			const Path& userDataPath,
+			const std::vector<Path>& systemReadAccess)
+		{
+			auto localUserConfigPath = userDataPath + BuildConstants::LocalUserConfigFileName();
+			auto localUserConfig = LocalUserConfig();
+			LocalUserConfigExtensions::TryLoadLocalUserConfigFromFile(localUserConfigPath, localUserConfig);
+
+			if (localUserConfig.HasImmutableRoots())
+				return localUserConfig.GetImmutableRoots();
+
+			auto immutableRoots = systemReadAccess;
+			if (localUserConfig.HasSDKs())
+			{
+				for (auto& sdk : localUserConfig.GetSDKs())
+				{
+					if (sdk.HasSourceDirectories())
+					{
+						for (auto& sourceDirectory : sdk.GetSourceDirectories())
+							immutableRoots.push_back(std::move(sourceDirectory));
+					}
+				}
+			}
+
+			return immutableRoots;
+		}
 	};
 }
@@ -15,18 +15,63 @@ namespace Soup::Core
 	class BuildEvaluateState
 	{
 	public:
+		/// <summary>
+		/// The ready operations owned by a single worker, guarded by its own lock so that
+		/// taking and stealing work never contends on the shared evaluation state
+		/// </summary>
+		struct WorkerQueue
+		{
+			std::mutex Mutex;
+			std::deque<OperationId> Operations;
+		};
+
+		/// <summary>
+		/// The content digest of a file along with the write time when it was hashed
+		/// </summary>
+		struct FileContentState
+		{
+			uint64_t Digest;
+			std::chrono::time_point<std::chrono::file_clock> LastWriteTime;
+		};
+
+		/// <summary>
+		/// An operation with a monitored process in flight, the first free worker finishes it once the process exits
+		/// </summary>
+		struct RunningOperation
+		{
+			const OperationInfo& Operation;
+			std::shared_ptr<SystemAccessTracker> Tracker;
+			std::unordered_map<FileId, FileContentState> PreviousOutputState;
+			Monitor::MonitorProcessResult ProcessResult;
+		};
+
 		BuildEvaluateState(
 			const OperationGraph& operationGraph,
 			OperationResults& operationResults,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
-			const std::vector<Path>& globalAllowedWriteAccess) :
+			const std::vector<Path>& globalAllowedWriteAccess,
+			OperationResultsJournal* operationResultsJournal,
+			uint32_t workerCount) :
 			OperationGraph(operationGraph),
 			OperationResults(operationResults),
+			OperationResultsJournal(operationResultsJournal),
 			TemporaryDirectory(temporaryDirectory),
 			GlobalAllowedReadAccess(globalAllowedReadAccess),
 			GlobalAllowedWriteAccess(globalAllowedWriteAccess),
 			RemainingDependencyCounts(),
+			Mutex(),
+			WorkAvailable(),
+			ReadyOperations(workerCount),
+			QueuedOperationCount(0),
+			PendingOperationCount(0),
+			RunningProcessCount(0),
+			CompletedOperations(),
+			DidAnyEvaluate(false),
+			Failure(nullptr),
+			UnchangedFiles(),
+			AllowedReadAccessLookup(),
+			AllowedWriteAccessLookup(),
 			LookupLoaded(false),
 			InputFileLookup(),
 			OutputFileLookup()
@@ -35,6 +80,7 @@ namespace Soup::Core
 
 		const ::Soup::Core::OperationGraph& OperationGraph;
 		::Soup::Core::OperationResults& OperationResults;
+		::Soup::Core::OperationResultsJournal* OperationResultsJournal;
 
 		const Path& TemporaryDirectory;
 
@@ -44,6 +90,35 @@ namespace Soup::Core
 		// Running State
 		std::unordered_map<OperationId, int32_t> RemainingDependencyCounts;
 
+		// Scheduler State
+		// The shared evaluation state is guarded by the single mutex, it is released while a process is running
+		// and while looking for work, the ready queues are only ever guarded by their own locks
+		std::mutex Mutex;
+		std::condition_variable WorkAvailable;
+		std::vector<WorkerQueue> ReadyOperations;
+
+		// The operations sitting in a ready queue, only used to decide if a worker should wait for more work
+		std::atomic<uint32_t> QueuedOperationCount;
+
+		// The operations that have been queued and not yet completed, guarded by the mutex
+		uint32_t PendingOperationCount;
+
+		// The monitored processes that have not reported their exit and the operations waiting
+		// to be finished after their process exited, guarded by the mutex
+		uint32_t RunningProcessCount;
+		std::deque<std::shared_ptr<RunningOperation>> CompletedOperations;
+
+		bool DidAnyEvaluate;
+		std::exception_ptr Failure;
+
+		// The outputs of operations that were executed this build but left the content untouched,
+		// along with the write time of the content before the operation ran
+		std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>> UnchangedFiles;
+
+		// The resolved allowed paths for each shared access set combined with the global access
+		std::unordered_map<const std::vector<FileId>*, std::shared_ptr<const std::vector<Path>>> AllowedReadAccessLookup;
+		std::unordered_map<const std::vector<FileId>*, std::shared_ptr<const std::vector<Path>>> AllowedWriteAccessLookup;
+
 		bool LookupLoaded;
 		std::unordered_map<FileId, std::set<OperationId>> InputFileLookup;
 		std::unordered_map<FileId, OperationId> OutputFileLookup;
@@ -124,14 +199,39 @@ namespace Soup::Core
 	class BuildEvaluateEngine : public IEvaluateEngine
 	{
 	private:
+		using FileContentState = BuildEvaluateState::FileContentState;
+
+		/// <summary>
+		/// The progress of an operation after it was checked
+		/// </summary>
+		enum class OperationStatus
+		{
+			UpToDate,
+			Executed,
+			Running,
+		};
+
 		bool _forceRebuild;
 		bool _disableMonitor;
 		bool _partialMonitor;
+		uint32_t _maxParallelOperations;
+
+		// Process slots shared by every concurrent evaluation so the total
+		// number of running commands stays within the requested limit
+		std::mutex _processSlotMutex;
+		std::condition_variable _processSlotAvailable;
+		uint32_t _activeProcessCount;
 
 		// Shared Runtime State
 		FileSystemState& _fileSystemState;
 		BuildHistoryChecker _stateChecker;
 
+		// The optional digest cache that enables content based up to date checks
+		FileDigestCache* _fileDigestCache;
+
+		// The directories that never change between builds, reads under them are not tracked individually
+		std::vector<std::string> _immutableRoots;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
@@ -141,12 +241,81 @@ namespace Soup::Core
 			bool disableMonitor,
 			bool partialMonitor,
 			FileSystemState& fileSystemState) :
+			BuildEvaluateEngine(forceRebuild, disableMonitor, partialMonitor, 1, fileSystemState)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			uint32_t maxParallelOperations,
+			FileSystemState& fileSystemState) :
+			BuildEvaluateEngine(
+				forceRebuild,
+				disableMonitor,
+				partialMonitor,
+				maxParallelOperations,
+				fileSystemState,
+				nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			uint32_t maxParallelOperations,
+			FileSystemState& fileSystemState,
+			FileDigestCache* fileDigestCache) :
+			BuildEvaluateEngine(
+				forceRebuild,
+				disableMonitor,
+				partialMonitor,
+				maxParallelOperations,
+				fileSystemState,
+				fileDigestCache,
+				{})
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			uint32_t maxParallelOperations,
+			FileSystemState& fileSystemState,
+			FileDigestCache* fileDigestCache,
+			const std::vector<Path>& immutableRoots) :
 			_forceRebuild(forceRebuild),
 			_disableMonitor(disableMonitor),
 			_partialMonitor(partialMonitor),
+			_maxParallelOperations(std::max(maxParallelOperations, 1u)),
+			_processSlotMutex(),
+			_processSlotAvailable(),
+			_activeProcessCount(0),
 			_fileSystemState(fileSystemState),
-			_stateChecker(fileSystemState)
+			_stateChecker(fileSystemState),
+			_fileDigestCache(fileDigestCache),
+			_immutableRoots()
 		{
+			// Ensure a root only matches the files under the directory
+			for (auto& root : immutableRoots)
+			{
+				auto value = root.ToString();
+				if (!value.ends_with('/'))
+					value.push_back('/');
+				_immutableRoots.push_back(std::move(value));
+			}
 		}
 
 		/// <summary>
@@ -157,34 +326,252 @@ namespace Soup::Core
 			OperationResults& operationResults,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
-			const std::vector<Path>& globalAllowedWriteAccess) override
+			const std::vector<Path>& globalAllowedWriteAccess,
+			OperationResultsJournal* operationResultsJournal) override
 		{
 			// Run all build operations in the correct order with incremental build checks
 			Log::Diag("Build evaluation start");
+
+			// Never spin up more workers than there are operations to run
+			auto workerCount = std::min<uint32_t>(
+				_maxParallelOperations,
+				std::max<uint32_t>(static_cast<uint32_t>(operationGraph.GetOperations().size()), 1u));
 			auto evaluateState = BuildEvaluateState(
 				operationGraph,
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				operationResultsJournal,
+				workerCount);
+
+			// Seed the first worker with the root operations
+			{
+				auto lock = std::unique_lock<std::mutex>(evaluateState.Mutex);
+				QueueReadyOperations(
+					evaluateState,
+					0,
+					operationGraph.GetRootOperationIds());
+			}
+
+			// The calling thread always participates as the first worker
+			auto workers = std::vector<std::thread>();
+			for (auto workerId = 1u; workerId < workerCount; workerId++)
+			{
+				workers.emplace_back(&BuildEvaluateEngine::RunWorker, this, std::ref(evaluateState), workerId);
+			}
+
+			RunWorker(evaluateState, 0);
+
+			for (auto& worker : workers)
+			{
+				worker.join();
+			}
+
+			// Surface the first failure after all running operations have completed
+			if (evaluateState.Failure != nullptr)
+			{
+				std::rethrow_exception(evaluateState.Failure);
+			}
 
-			auto result = CheckExecuteOperations(
-				evaluateState,
-				operationGraph.GetRootOperationIds());
 			Log::Diag("Build evaluation end");
 
-			return result;
+			return evaluateState.DidAnyEvaluate;
 		}
 
 	private:
 		/// <summary>
-		/// Execute the collection of build operations
+		/// The worker loop that finishes operations whose process exited and pulls ready operations
+		/// from its own queue, or steals from another worker, until the entire graph has been evaluated.
+		/// A worker never waits on a monitored process, the process manager reports the exit.
+		/// </summary>
+		void RunWorker(
+			BuildEvaluateState& evaluateState,
+			uint32_t workerId)
+		{
+			while (true)
+			{
+				// Finish the exited operations first, they unblock their children
+				if (TryFinishCompletedOperation(evaluateState, workerId))
+					continue;
+
+				OperationId operationId;
+				if (TryTakeOperation(evaluateState, workerId, operationId))
+				{
+					auto lock = std::unique_lock<std::mutex>(evaluateState.Mutex);
+
+					// Drop the remaining work as soon as any operation fails
+					if (evaluateState.Failure == nullptr)
+					{
+						try
+						{
+							// Run the single operation, a monitored process is finished once it exits
+							auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(operationId);
+							auto status = CheckExecuteOperation(
+								evaluateState,
+								operationInfo,
+								lock);
+							evaluateState.DidAnyEvaluate |= status != OperationStatus::UpToDate;
+							if (status == OperationStatus::Running)
+								continue;
+
+							// Queue up all of the children that are now unblocked
+							QueueReadyOperations(
+								evaluateState,
+								workerId,
+								operationInfo.Children);
+						}
+						catch (...)
+						{
+							// Keep the first failure, later failures are usually fallout from the same problem
+							if (evaluateState.Failure == nullptr)
+								evaluateState.Failure = std::current_exception();
+						}
+					}
+
+					evaluateState.PendingOperationCount--;
+					evaluateState.WorkAvailable.notify_all();
+				}
+				else
+				{
+					auto lock = std::unique_lock<std::mutex>(evaluateState.Mutex);
+					evaluateState.WorkAvailable.wait(
+						lock,
+						[&]()
+						{
+							return !evaluateState.CompletedOperations.empty() ||
+								evaluateState.QueuedOperationCount > 0 ||
+								IsEvaluateComplete(evaluateState);
+						});
+
+					// Stop when a failure occurred or nothing is queued, once no process is left that could report back
+					if (evaluateState.CompletedOperations.empty() && IsEvaluateComplete(evaluateState))
+						break;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Check if the evaluation is done, the running processes must report their exit first
+		/// since their callbacks reference the evaluation state
+		/// </summary>
+		static bool IsEvaluateComplete(const BuildEvaluateState& evaluateState)
+		{
+			return evaluateState.RunningProcessCount == 0 &&
+				(evaluateState.Failure != nullptr || evaluateState.PendingOperationCount == 0);
+		}
+
+		/// <summary>
+		/// Finish an operation whose monitored process has exited and queue up its children
+		/// </summary>
+		bool TryFinishCompletedOperation(
+			BuildEvaluateState& evaluateState,
+			uint32_t workerId)
+		{
+			auto lock = std::unique_lock<std::mutex>(evaluateState.Mutex);
+			if (evaluateState.CompletedOperations.empty())
+				return false;
+
+			auto runningOperation = std::move(evaluateState.CompletedOperations.front());
+			evaluateState.CompletedOperations.pop_front();
+
+			// Drop the result when another operation already failed
+			if (evaluateState.Failure == nullptr)
+			{
+				try
+				{
+					FinishExecuteOperation(evaluateState, *runningOperation, lock);
+
+					// Queue up all of the children that are now unblocked
+					QueueReadyOperations(
+						evaluateState,
+						workerId,
+						runningOperation->Operation.Children);
+				}
+				catch (...)
+				{
+					// Keep the first failure, later failures are usually fallout from the same problem
+					if (evaluateState.Failure == nullptr)
+						evaluateState.Failure = std::current_exception();
+				}
+			}
+
+			evaluateState.PendingOperationCount--;
+			evaluateState.WorkAvailable.notify_all();
+			return true;
+		}
+
+		/// <summary>
+		/// Take the most recently queued operation from the local queue to keep
+		/// a depth first order, otherwise steal the oldest operation from another worker
+		/// </summary>
+		bool TryTakeOperation(
+			BuildEvaluateState& evaluateState,
+			uint32_t workerId,
+			OperationId& result)
+		{
+			{
+				auto& localQueue = evaluateState.ReadyOperations[workerId];
+				auto queueLock = std::lock_guard<std::mutex>(localQueue.Mutex);
+				if (!localQueue.Operations.empty())
+				{
+					result = localQueue.Operations.back();
+					localQueue.Operations.pop_back();
+					evaluateState.QueuedOperationCount--;
+					return true;
+				}
+			}
+
+			auto workerCount = evaluateState.ReadyOperations.size();
+			for (auto offset = 1u; offset < workerCount; offset++)
+			{
+				auto& victimQueue = evaluateState.ReadyOperations[(workerId + offset) % workerCount];
+				auto queueLock = std::lock_guard<std::mutex>(victimQueue.Mutex);
+				if (!victimQueue.Operations.empty())
+				{
+					result = victimQueue.Operations.front();
+					victimQueue.Operations.pop_front();
+					evaluateState.QueuedOperationCount--;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Wait until the number of running processes is below the limit and claim a slot
 		/// </summary>
-		bool CheckExecuteOperations(
+		void AcquireProcessSlot()
+		{
+			auto lock = std::unique_lock<std::mutex>(_processSlotMutex);
+			_processSlotAvailable.wait(lock, [&]() { return _activeProcessCount < _maxParallelOperations; });
+			_activeProcessCount++;
+		}
+
+		/// <summary>
+		/// Release a running process slot and wake up a waiting evaluation
+		/// </summary>
+		void ReleaseProcessSlot()
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(_processSlotMutex);
+				_activeProcessCount--;
+			}
+
+			_processSlotAvailable.notify_one();
+		}
+
+		/// <summary>
+		/// Update the remaining dependency counts for the collection of build operations
+		/// and queue up any that are ready to run
+		/// </summary>
+		void QueueReadyOperations(
 			BuildEvaluateState& evaluateState,
+			uint32_t workerId,
 			const std::vector<OperationId>& operations)
 		{
-			bool didAnyEvaluate = false;
+			auto readyOperations = std::vector<OperationId>();
 			for (auto operationId : operations)
 			{
 				// Check if the operation was already a child from a different path
@@ -207,15 +594,7 @@ namespace Soup::Core
 
 				if (remainingCount == 0)
 				{
-					// Run the single operation
-					didAnyEvaluate |= CheckExecuteOperation(
-						evaluateState,
-						operationInfo);
-					
-					// Recursively build all of the operation children
-					didAnyEvaluate |= CheckExecuteOperations(
-						evaluateState,
-						operationInfo.Children);
+					readyOperations.push_back(operationId);
 				}
 				else if (remainingCount < 0)
 				{
@@ -227,25 +606,47 @@ namespace Soup::Core
 				}
 			}
 
-			return didAnyEvaluate;
+			if (readyOperations.empty())
+				return;
+
+			// Count the operations before they become visible so a worker never sees
+			// an empty queue with nothing pending while they are in flight
+			evaluateState.PendingOperationCount += static_cast<uint32_t>(readyOperations.size());
+			evaluateState.QueuedOperationCount += static_cast<uint32_t>(readyOperations.size());
+
+			// Push in reverse so the first ready operation is taken first
+			{
+				auto& localQueue = evaluateState.ReadyOperations[workerId];
+				auto queueLock = std::lock_guard<std::mutex>(localQueue.Mutex);
+				for (auto operationId = readyOperations.rbegin(); operationId != readyOperations.rend(); ++operationId)
+				{
+					localQueue.Operations.push_back(*operationId);
+				}
+			}
+
+			evaluateState.WorkAvailable.notify_all();
 		}
 
 		/// <summary>
 		/// Check if an individual operation has been run and execute if required
 		/// </summary>
-		bool CheckExecuteOperation(
+		OperationStatus CheckExecuteOperation(
 			BuildEvaluateState& evaluateState,
-			const OperationInfo& operationInfo)
+			const OperationInfo& operationInfo,
+			std::unique_lock<std::mutex>& lock)
 		{
 			// Check if each source file is out of date and requires a rebuild
 			Log::Diag("Check for previous operation invocation");
 
 			// Check if this operation was run before
 			auto buildRequired = false;
+			auto previousOutput = std::vector<FileId>();
 			OperationResult* previousResult;
 			if (evaluateState.OperationResults.TryFindResult(operationInfo.Id, previousResult) &&
 				previousResult->WasSuccessfulRun)
 			{
+				previousOutput = previousResult->ObservedOutput;
+
 				// Check if the executable has changed since the last run
 				bool executableOutOfDate = false;
 				if (operationInfo.Command.Executable != Path("./writefile.exe"))
@@ -262,8 +663,7 @@ namespace Soup::Core
 				}
 
 				// Perform the incremental build checks
-				if (executableOutOfDate ||
-					_stateChecker.IsOutdated(previousResult->ObservedOutput, previousResult->ObservedInput))
+				if (executableOutOfDate || IsOutdated(evaluateState, operationInfo.Id, *previousResult, lock))
 				{
 					buildRequired = true;
 				}
@@ -298,38 +698,271 @@ namespace Soup::Core
 
 				Log::Diag(messageBuilder.str());
 
-				auto operationResult = OperationResult();
+				// Capture the previous outputs to detect content that is rewritten unchanged
+				auto previousOutputState = std::unordered_map<FileId, FileContentState>();
+				if (_fileDigestCache != nullptr && !previousOutput.empty())
+				{
+					lock.unlock();
+					try
+					{
+						previousOutputState = GetFileContentState(previousOutput);
+					}
+					catch (...)
+					{
+						lock.lock();
+						throw;
+					}
+
+					lock.lock();
+				}
 
 				// Check for special in-process write operations
 				if (operationInfo.Command.Executable == Path("./writefile.exe"))
 				{
-					ExecuteWriteFileOperation(
+					// The write only touches its own file, keep the shared state available to the other workers
+					auto operationResult = OperationResult();
+					lock.unlock();
+					try
+					{
+						ExecuteWriteFileOperation(
+							operationInfo,
+							operationResult);
+					}
+					catch (...)
+					{
+						lock.lock();
+						throw;
+					}
+
+					lock.lock();
+
+					PublishOperationResult(
+						evaluateState,
 						operationInfo,
-						operationResult);
+						previousOutputState,
+						operationResult,
+						lock);
+					return OperationStatus::Executed;
 				}
 				else
 				{
-					ExecuteOperation(
-						evaluateState.TemporaryDirectory,
-						evaluateState.GlobalAllowedReadAccess,
-						evaluateState.GlobalAllowedWriteAccess,
+					return ExecuteOperation(
+						evaluateState,
 						operationInfo,
-						operationResult);
+						std::move(previousOutputState),
+						lock);
+				}
+			}
+			else
+			{
+				Log::Info(operationInfo.Title);
+				return OperationStatus::UpToDate;
+			}
+		}
+
+		/// <summary>
+		/// Verify and persist the result of an executed operation and make it visible to its children
+		/// </summary>
+		void PublishOperationResult(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo,
+			const std::unordered_map<FileId, FileContentState>& previousOutputState,
+			OperationResult& operationResult,
+			std::unique_lock<std::mutex>& lock)
+		{
+			// Ensure there are no new dependencies
+			VerifyObservedState(evaluateState, operationInfo, operationResult);
+
+			// Starting the journal rewrites the previous records from the shared results
+			if (evaluateState.OperationResultsJournal != nullptr)
+				evaluateState.OperationResultsJournal->EnsureOpen();
+
+			// Hash and persist the result outside of the lock, only publishing it needs the shared state
+			lock.unlock();
+			auto unchangedOutput = std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>();
+			try
+			{
+				if (_fileDigestCache != nullptr && operationResult.WasSuccessfulRun)
+				{
+					// Unchanged inputs are served from the digest cache
+					RecordInputDigests(operationResult);
+					unchangedOutput = FindUnchangedOutput(previousOutputState, operationResult.ObservedOutput);
+				}
+
+				// Persist the result immediately so it survives an interrupted build
+				if (evaluateState.OperationResultsJournal != nullptr)
+					evaluateState.OperationResultsJournal->Append(operationInfo.Id, operationResult);
+			}
+			catch (...)
+			{
+				lock.lock();
+				throw;
+			}
+
+			lock.lock();
+
+			// Allow the children to skip the unchanged outputs when checking for changes
+			evaluateState.UnchangedFiles.insert(unchangedOutput.begin(), unchangedOutput.end());
+			evaluateState.OperationResults.AddOrUpdateOperationResult(
+				operationInfo.Id,
+				std::move(operationResult));
+		}
+
+		/// <summary>
+		/// Check if the previous result is outdated, comparing content digests when they were recorded
+		/// </summary>
+		bool IsOutdated(
+			BuildEvaluateState& evaluateState,
+			OperationId operationId,
+			OperationResult& previousResult,
+			std::unique_lock<std::mutex>& lock)
+		{
+			if (_fileDigestCache != nullptr && !previousResult.ObservedInputDigests.empty())
+			{
+				// Outputs that were rewritten with identical content keep the same digest
+				return _stateChecker.IsContentOutdated(
+					previousResult.ObservedOutput,
+					previousResult.ObservedInput,
+					previousResult.ObservedInputDigests,
+					*_fileDigestCache);
+			}
+			else if (_fileDigestCache != nullptr && !evaluateState.UnchangedFiles.empty())
+			{
+				// Cut off the rebuild when the only newer inputs were rewritten by a parent without changes
+				// since this operation last ran
+				if (_stateChecker.IsOutdated(
+					previousResult.ObservedOutput,
+					previousResult.ObservedInput,
+					evaluateState.UnchangedFiles))
+				{
+					return true;
 				}
 
-				// Ensure there are no new dependencies
-				VerifyObservedState(evaluateState, operationInfo, operationResult);
+				// Upgrade the result to content digests so the cut off holds for future builds
+				auto hasUnchangedInput = std::any_of(
+					previousResult.ObservedInput.begin(),
+					previousResult.ObservedInput.end(),
+					[&](FileId fileId) { return evaluateState.UnchangedFiles.contains(fileId); });
+				if (hasUnchangedInput)
+				{
+					Log::Info("Inputs unchanged after parent rebuild");
+					if (evaluateState.OperationResultsJournal != nullptr)
+						evaluateState.OperationResultsJournal->EnsureOpen();
+
+					// No other worker touches this result, upgrade and persist it outside of the lock
+					lock.unlock();
+					try
+					{
+						RecordInputDigests(previousResult);
+
+						// The upgraded result must survive an interrupted build the same as an executed one
+						if (evaluateState.OperationResultsJournal != nullptr)
+							evaluateState.OperationResultsJournal->Append(operationId, previousResult);
+					}
+					catch (...)
+					{
+						lock.lock();
+						throw;
+					}
+
+					lock.lock();
+				}
 
-				evaluateState.OperationResults.AddOrUpdateOperationResult(
-					operationInfo.Id,
-					std::move(operationResult));
+				return false;
 			}
 			else
 			{
-				Log::Info(operationInfo.Title);
+				return _stateChecker.IsOutdated(previousResult.ObservedOutput, previousResult.ObservedInput);
+			}
+		}
+
+		/// <summary>
+		/// Get the current content digest and write time for each of the files that exist
+		/// </summary>
+		std::unordered_map<FileId, FileContentState> GetFileContentState(const std::vector<FileId>& files)
+		{
+			auto result = std::unordered_map<FileId, FileContentState>();
+			for (auto fileId : files)
+			{
+				auto lastWriteTime = _fileSystemState.GetLastWriteTime(fileId);
+				uint64_t digest;
+				if (lastWriteTime.has_value() &&
+					_fileDigestCache->TryGetDigest(_fileSystemState.GetFilePath(fileId), digest))
+				{
+					result.emplace(fileId, FileContentState(digest, lastWriteTime.value()));
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Hash the new outputs, which also warms the digest cache for the children,
+		/// and find the outputs that have identical content to the previous run along with the previous write time
+		/// </summary>
+		std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>> FindUnchangedOutput(
+			const std::unordered_map<FileId, FileContentState>& previousOutputState,
+			const std::vector<FileId>& observedOutput)
+		{
+			auto result = std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>();
+			for (auto fileId : observedOutput)
+			{
+				uint64_t digest;
+				auto& filePath = _fileSystemState.GetFilePath(fileId);
+				if (!_fileDigestCache->TryGetDigest(filePath, digest))
+					continue;
+
+				auto findPrevious = previousOutputState.find(fileId);
+				if (findPrevious != previousOutputState.end() && findPrevious->second.Digest == digest)
+				{
+					Log::Diag("Output unchanged: {}", filePath.ToString());
+					result.emplace(fileId, findPrevious->second.LastWriteTime);
+				}
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Record the content digest for each observed input
+		/// If any input cannot be hashed the result falls back to write time checks
+		/// </summary>
+		void RecordInputDigests(OperationResult& operationResult)
+		{
+			auto digests = std::vector<uint64_t>();
+			digests.reserve(operationResult.ObservedInput.size());
+			for (auto fileId : operationResult.ObservedInput)
+			{
+				uint64_t digest;
+				if (!_fileDigestCache->TryGetDigest(_fileSystemState.GetFilePath(fileId), digest))
+				{
+					Log::Diag("Unable to hash input, using write time checks: {}", _fileSystemState.GetFilePath(fileId).ToString());
+					return;
+				}
+
+				digests.push_back(digest);
+			}
+
+			operationResult.ObservedInputDigests = std::move(digests);
+		}
+
+		/// <summary>
+		/// Get the allowed paths for an access set, operations that share a set only resolve it once
+		/// </summary>
+		std::shared_ptr<const std::vector<Path>> GetAllowedAccess(
+			std::unordered_map<const std::vector<FileId>*, std::shared_ptr<const std::vector<Path>>>& allowedAccessLookup,
+			const AccessSet& accessSet,
+			const std::vector<Path>& globalAllowedAccess)
+		{
+			auto [insertIterator, wasInserted] = allowedAccessLookup.try_emplace(&accessSet.GetFiles());
+			if (wasInserted)
+			{
+				auto allowedAccess = _fileSystemState.GetFilePaths(accessSet.GetFiles());
+				std::copy(globalAllowedAccess.begin(), globalAllowedAccess.end(), std::back_inserter(allowedAccess));
+				insertIterator->second = std::make_shared<const std::vector<Path>>(std::move(allowedAccess));
 			}
 
-			return buildRequired;
+			return insertIterator->second;
 		}
 
 		/// <summary>
@@ -354,9 +987,18 @@ namespace Soup::Core
 			auto filePath = fileName.HasRoot() ? fileName : operationInfo.Command.WorkingDirectory + fileName;
 			auto& content = operationInfo.Command.Arguments[1];
 
-			// Open the file to write to
-			auto file = System::IFileSystem::Current().OpenWrite(filePath, false);
-			file->GetOutStream() << content;
+			// Skip the write when the content is identical so the write time stays untouched
+			// and the operations that read the file are not invalidated
+			if (HasFileContent(filePath, content))
+			{
+				Log::Info("WriteFile content unchanged");
+			}
+			else
+			{
+				// Open the file to write to
+				auto file = System::IFileSystem::Current().OpenWrite(filePath, false);
+				file->GetOutStream() << content;
+			}
 
 			operationResult.ObservedInput = {};
 			operationResult.ObservedOutput = {
@@ -372,55 +1014,147 @@ namespace Soup::Core
 		}
 
 		/// <summary>
-		/// Execute a single build operation
+		/// Check if the file already exists with the exact content
 		/// </summary>
-		void ExecuteOperation(
-			const Path& temporaryDirectory,
-			const std::vector<Path>& globalAllowedReadAccess,
-			const std::vector<Path>& globalAllowedWriteAccess,
+		bool HasFileContent(const Path& filePath, const std::string& content)
+		{
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(filePath, false, file))
+				return false;
+
+			auto existingContent = std::string(
+				std::istreambuf_iterator<char>(file->GetInStream()),
+				std::istreambuf_iterator<char>());
+			return existingContent == content;
+		}
+
+		/// <summary>
+		/// Execute a single build operation, a monitored process keeps running after this returns
+		/// </summary>
+		OperationStatus ExecuteOperation(
+			BuildEvaluateState& evaluateState,
 			const OperationInfo& operationInfo,
-			OperationResult& operationResult)
+			std::unordered_map<FileId, FileContentState> previousOutputState,
+			std::unique_lock<std::mutex>& lock)
 		{
-			auto monitor = std::make_shared<SystemAccessTracker>();
+			auto monitor = std::make_shared<SystemAccessTracker>(_immutableRoots);
 
 			// Add the temp folder to the environment
 			auto environment = std::map<std::string, std::string>();
-			environment.emplace("TEMP", temporaryDirectory.ToString());
-			environment.emplace("TMP", temporaryDirectory.ToString());
+			environment.emplace("TEMP", evaluateState.TemporaryDirectory.ToString());
+			environment.emplace("TMP", evaluateState.TemporaryDirectory.ToString());
 
 			// Allow access to the declared inputs/outputs
 			bool enableAccessChecks = true;
-			auto allowedReadAccess = std::vector<Path>();
-			auto allowedWriteAccess = std::vector<Path>();
+			auto allowedReadAccess = std::shared_ptr<const std::vector<Path>>();
+			auto allowedWriteAccess = std::shared_ptr<const std::vector<Path>>();
 			if (enableAccessChecks)
 			{
-				allowedReadAccess = _fileSystemState.GetFilePaths(operationInfo.ReadAccess);
-				allowedWriteAccess = _fileSystemState.GetFilePaths(operationInfo.WriteAccess);
+				// Resolve the shared access sets along with the global overrides
+				allowedReadAccess = GetAllowedAccess(
+					evaluateState.AllowedReadAccessLookup,
+					operationInfo.ReadAccess,
+					evaluateState.GlobalAllowedReadAccess);
+				allowedWriteAccess = GetAllowedAccess(
+					evaluateState.AllowedWriteAccessLookup,
+					operationInfo.WriteAccess,
+					evaluateState.GlobalAllowedWriteAccess);
+			}
+			else
+			{
+				// Allow access to the global overrides
+				allowedReadAccess = std::make_shared<const std::vector<Path>>(evaluateState.GlobalAllowedReadAccess);
+				allowedWriteAccess = std::make_shared<const std::vector<Path>>(evaluateState.GlobalAllowedWriteAccess);
 			}
-
-			// Allow access to the global overrides
-			std::copy(globalAllowedReadAccess.begin(), globalAllowedReadAccess.end(), std::back_inserter(allowedReadAccess));
-			std::copy(globalAllowedWriteAccess.begin(), globalAllowedWriteAccess.end(), std::back_inserter(allowedWriteAccess));
 
 			Log::Diag("Allowed Read Access:");
-			for (auto& file : allowedReadAccess)
+			for (auto& file : *allowedReadAccess)
 				Log::Diag(file.ToString());
 			Log::Diag("Allowed Write Access:");
-			for (auto& file : allowedWriteAccess)
+			for (auto& file : *allowedWriteAccess)
 				Log::Diag(file.ToString());
 
-			std::shared_ptr<System::IProcess> process = nullptr;
+			// Operations run in parallel so tag each line of output with the operation as it arrives
+			// TODO: Find warnings + errors
+			auto onOutput = [operationId = operationInfo.Id](
+				Monitor::MonitorProcessOutputStream stream,
+				std::string_view line)
+			{
+				if (stream == Monitor::MonitorProcessOutputStream::StandardError)
+					Log::Error("{0}: {1}", operationId, line);
+				else
+					Log::Info("{0}: {1}", operationId, line);
+			};
+
 			if (_disableMonitor)
 			{
-				process = System::IProcessManager::Current().CreateProcess(
+				auto process = System::IProcessManager::Current().CreateProcess(
 					operationInfo.Command.Executable,
 					operationInfo.Command.Arguments,
 					operationInfo.Command.WorkingDirectory,
 					true);
+
+				// The plain process has no asynchronous interface, release the shared state while this worker waits
+				lock.unlock();
+				AcquireProcessSlot();
+				auto processResult = Monitor::MonitorProcessResult();
+				try
+				{
+					process->Start();
+					process->WaitForExit();
+
+					Monitor::ReportOutputLines(
+						process->GetStandardOutput(),
+						Monitor::MonitorProcessOutputStream::StandardOutput,
+						onOutput);
+					Monitor::ReportOutputLines(
+						process->GetStandardError(),
+						Monitor::MonitorProcessOutputStream::StandardError,
+						onOutput);
+					processResult.ExitCode = process->GetExitCode();
+				}
+				catch (...)
+				{
+					ReleaseProcessSlot();
+					lock.lock();
+					throw;
+				}
+
+				ReleaseProcessSlot();
+
+				lock.lock();
+
+				auto operationResult = OperationResult();
+				RecordProcessResult(
+					evaluateState,
+					operationInfo,
+					*monitor,
+					processResult,
+					operationResult);
+				PublishOperationResult(
+					evaluateState,
+					operationInfo,
+					previousOutputState,
+					operationResult,
+					lock);
+				return OperationStatus::Executed;
 			}
-			else
+
+			// The monitored process is supervised by the process manager and reports its exit through the
+			// callback, which hands the operation to the first free worker instead of parking this one
+			auto runningOperation = std::make_shared<BuildEvaluateState::RunningOperation>(
+				operationInfo,
+				monitor,
+				std::move(previousOutputState),
+				Monitor::MonitorProcessResult());
+			evaluateState.RunningProcessCount++;
+
+			// Release the shared state while the process starts, the callback may run before this returns
+			lock.unlock();
+			AcquireProcessSlot();
+			try
 			{
-				process = Monitor::IMonitorProcessManager::Current().CreateMonitorProcess(
+				Monitor::IMonitorProcessManager::Current().StartMonitorProcess(
 					operationInfo.Command.Executable,
 					operationInfo.Command.Arguments,
 					operationInfo.Command.WorkingDirectory,
@@ -429,40 +1163,80 @@ namespace Soup::Core
 					enableAccessChecks,
 					_partialMonitor,
 					std::move(allowedReadAccess),
-					std::move(allowedWriteAccess));
+					std::move(allowedWriteAccess),
+					onOutput,
+					[this, &evaluateState, runningOperation](Monitor::MonitorProcessResult result)
+					{
+						ReleaseProcessSlot();
+
+						auto callbackLock = std::lock_guard<std::mutex>(evaluateState.Mutex);
+						runningOperation->ProcessResult = std::move(result);
+						evaluateState.CompletedOperations.push_back(runningOperation);
+						evaluateState.RunningProcessCount--;
+
+						// Notify while holding the lock, the evaluation may complete as soon as it is released
+						evaluateState.WorkAvailable.notify_all();
+					});
+			}
+			catch (...)
+			{
+				// Start failures are reported through the callback, anything else never reached the process
+				ReleaseProcessSlot();
+				lock.lock();
+				evaluateState.RunningProcessCount--;
+				throw;
 			}
 
-			process->Start();
-			process->WaitForExit();
+			lock.lock();
+			return OperationStatus::Running;
+		}
 
-			auto stdOut = process->GetStandardOutput();
-			auto stdErr = process->GetStandardError();
-			auto exitCode = process->GetExitCode();
+		/// <summary>
+		/// Finish an operation once its monitored process has exited
+		/// </summary>
+		void FinishExecuteOperation(
+			BuildEvaluateState& evaluateState,
+			BuildEvaluateState::RunningOperation& runningOperation,
+			std::unique_lock<std::mutex>& lock)
+		{
+			if (runningOperation.ProcessResult.Failure != nullptr)
+				std::rethrow_exception(runningOperation.ProcessResult.Failure);
 
-			// Check the result of the monitor
-			monitor->VerifyResult();
+			auto operationResult = OperationResult();
+			RecordProcessResult(
+				evaluateState,
+				runningOperation.Operation,
+				*runningOperation.Tracker,
+				runningOperation.ProcessResult,
+				operationResult);
+			PublishOperationResult(
+				evaluateState,
+				runningOperation.Operation,
+				runningOperation.PreviousOutputState,
+				operationResult,
+				lock);
+		}
 
-			if (!stdOut.empty())
-			{
-				// Upgrade output to a warning if the command fails
-				if (exitCode != 0)
-					Log::Warning(stdOut);
-				else
-					Log::Info(stdOut);
-			}
+		/// <summary>
+		/// Record the observed state of a process that exited, a failed process abandons the build
+		/// </summary>
+		void RecordProcessResult(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo,
+			SystemAccessTracker& monitor,
+			const Monitor::MonitorProcessResult& processResult,
+			OperationResult& operationResult)
+		{
+			auto exitCode = processResult.ExitCode;
 
-			// If there was any error output then the build failed
-			// TODO: Find warnings + errors
-			if (!stdErr.empty())
-			{
-				Log::Error(stdErr);
-			}
+			// Check the result of the monitor
+			monitor.VerifyResult();
 
 			if (exitCode == 0)
 			{
 				// Save off the build graph for future builds
 				auto input = std::vector<Path>();
-				for (auto& value : monitor->GetInput())
+				for (auto& value : monitor.GetInput())
 				{
 					auto path = Path::Parse(value);
 					#ifdef TRACE_FILE_SYSTEM_STATE
@@ -471,8 +1245,18 @@ namespace Soup::Core
 					input.push_back(std::move(path));
 				}
 
+				// The directories that held the immutable reads fingerprint the installed toolchain version,
+				// a new file in them or an upgrade that replaces the executable invalidates the operation
+				if (monitor.HasImmutableInput())
+				{
+					for (auto& directory : monitor.GetImmutableDirectories())
+						input.push_back(Path::Parse(directory));
+
+					input.push_back(operationInfo.Command.Executable);
+				}
+
 				auto output = std::vector<Path>();
-				for (auto& value : monitor->GetOutput())
+				for (auto& value : monitor.GetOutput())
 				{
 					auto path = Path::Parse(value);
 					#ifdef TRACE_FILE_SYSTEM_STATE
@@ -481,9 +1265,9 @@ namespace Soup::Core
 					output.push_back(std::move(path));
 				}
 
-				operationResult.ObservedInput = _fileSystemState.ToFileIds(
-					input,
-					operationInfo.Command.WorkingDirectory);
+				// Share the common inputs with the other results
+				operationResult.ObservedInput = evaluateState.OperationResults.InternObservedInput(
+					_fileSystemState.ToFileIds(input, operationInfo.Command.WorkingDirectory));
 				operationResult.ObservedOutput = _fileSystemState.ToFileIds(
 					output,
 					operationInfo.Command.WorkingDirectory);
@@ -492,13 +1276,25 @@ namespace Soup::Core
 				operationResult.WasSuccessfulRun = true;
 				operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
 
+				// Keep the cost of the run alongside its observed state
+				auto& resourceUsage = processResult.ResourceUsage;
+				operationResult.ResourceUsage = OperationResourceUsage({
+					resourceUsage.WallTime,
+					resourceUsage.UserTime,
+					resourceUsage.SystemTime,
+					resourceUsage.MaxResidentSetSize,
+					resourceUsage.VoluntaryContextSwitches,
+					resourceUsage.InvoluntaryContextSwitches,
+					resourceUsage.MonitorEventCount,
+				});
+
 				// Ensure the File System State is notified of any output files that have changed
 				_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
 			}
 			else
 			{
 				// Leave the previous state untouched and abandon the remaining operations
-				Log::Error("Operation exited with non-success code: {}", exitCode);
+				Log::Error("{0}: Operation exited with non-success code: {1}", operationInfo.Id, exitCode);
 				throw BuildFailedException();
 			}
 		}
@@ -541,13 +1337,11 @@ namespace Soup::Core
 			for (auto fileId : operationResult.ObservedOutput)
 			{
 				// Ensure the file is not also an output
-				auto findObservedInput = std::find(operationResult.ObservedInput.begin(), operationResult.ObservedInput.end(), fileId);
-				if (findObservedInput != operationResult.ObservedInput.end())
+				if (operationResult.ObservedInput.Remove(fileId))
 				{
 					auto filePath = _fileSystemState.GetFilePath(fileId);
 					Log::Warning("File \"{}\" observed as both input and output for operation \"{}\"", filePath.ToString(), operationInfo.Title);
 					Log::Warning("Removing from input list for now. Will be treated as error in the future.");
-					operationResult.ObservedInput.erase(findObservedInput);
 				}
 
 				// Ensure declared output is compatible
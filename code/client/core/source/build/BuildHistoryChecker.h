@@ -3,7 +3,9 @@
 // </copyright>
 
 #pragma once
+#include "FileDigestCache.h"
 #include "FileSystemState.h"
+#include "operation-graph/InputSet.h"
 
 namespace Soup::Core
 {
@@ -13,11 +15,43 @@ namespace Soup::Core
 	class BuildHistoryChecker
 	{
 	private:
+		/// <summary>
+		/// The newest write time across a shared input base, dirty when one of its files may have changed
+		/// </summary>
+		struct InputBaseState
+		{
+			std::weak_ptr<const std::vector<FileId>> Base;
+			bool IsDirty = true;
+			bool HasMissingFile = false;
+			FileId File = 0;
+			std::chrono::time_point<std::chrono::file_clock> LastWriteTime = std::chrono::time_point<std::chrono::file_clock>::min();
+		};
+
+		// The number of cached bases before the first sweep for released bases
+		static constexpr size_t MinInputBaseSweepSize = 1024;
+
 		FileSystemState& _fileSystemState;
 
+		// Guards the cached base states, a single checker is shared by packages that evaluate in parallel
+		std::mutex _inputBaseMutex;
+
+		// The cached state for each base keyed by the stable address of the list
+		// Entries only observe the base so they can be evicted once every operation has released it
+		std::unordered_map<const std::vector<FileId>*, InputBaseState> _inputBaseStates;
+
+		// The bases that reference each file, so a write only dirties the bases that contain it
+		std::unordered_map<FileId, std::vector<const std::vector<FileId>*>> _inputBaseLookup;
+		uint64_t _inputBaseWriteTimeVersion;
+		size_t _inputBaseSweepSize;
+
 	public:
 		BuildHistoryChecker(FileSystemState& fileSystemState) :
-			_fileSystemState(fileSystemState)
+			_fileSystemState(fileSystemState),
+			_inputBaseMutex(),
+			_inputBaseStates(),
+			_inputBaseLookup(),
+			_inputBaseWriteTimeVersion(fileSystemState.GetWriteTimeVersion()),
+			_inputBaseSweepSize(MinInputBaseSweepSize)
 		{
 		}
 
@@ -60,7 +94,22 @@ namespace Soup::Core
 		/// </summary>
 		bool IsOutdated(
 			const std::vector<FileId>& targetFiles,
-			const std::vector<FileId>& inputFiles)
+			const InputSet& inputFiles)
+		{
+			static const auto noUnchangedInputFiles = std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>();
+			return IsOutdated(targetFiles, inputFiles, noUnchangedInputFiles);
+		}
+
+		/// <summary>
+		/// Perform a check if the requested target is outdated with
+		/// respect to the input files, ignoring inputs that were rewritten with unchanged content
+		/// The inputs map to the write time of the previous content, which must be older than the target
+		/// to know the target was built from that content
+		/// </summary>
+		bool IsOutdated(
+			const std::vector<FileId>& targetFiles,
+			const InputSet& inputFiles,
+			const std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>& unchangedInputFiles)
 		{
 			// If there are no input files then the output can never be outdated
 			if (inputFiles.empty())
@@ -68,7 +117,7 @@ namespace Soup::Core
 
 			for (auto& targetFile : targetFiles)
 			{
-				if (IsOutdated(targetFile, inputFiles))
+				if (IsOutdated(targetFile, inputFiles, unchangedInputFiles))
 				{
 					return true;
 				}
@@ -77,6 +126,55 @@ namespace Soup::Core
 			return false;
 		}
 
+		/// <summary>
+		/// Perform a check if the requested target is outdated by comparing the current
+		/// content digests of the input files against the digests recorded during the last run
+		/// </summary>
+		bool IsContentOutdated(
+			const std::vector<FileId>& targetFiles,
+			const InputSet& inputFiles,
+			const std::vector<uint64_t>& inputDigests,
+			FileDigestCache& fileDigestCache)
+		{
+			if (inputFiles.size() != inputDigests.size())
+			{
+				Log::Info("Missing content digests for previous run");
+				return true;
+			}
+
+			for (auto& targetFile : targetFiles)
+			{
+				if (!_fileSystemState.GetLastWriteTime(targetFile).has_value())
+				{
+					auto targetFilePath = _fileSystemState.GetFilePath(targetFile);
+					Log::Info("Output target does not exist: {}", targetFilePath.ToString());
+					return true;
+				}
+			}
+
+			auto inputDigest = inputDigests.begin();
+			for (auto inputFile : inputFiles)
+			{
+				auto inputFilePath = _fileSystemState.GetFilePath(inputFile);
+				uint64_t digest;
+				if (!fileDigestCache.TryGetDigest(inputFilePath, digest))
+				{
+					Log::Info("Input Missing [{}]", inputFilePath.ToString());
+					return true;
+				}
+
+				if (digest != *inputDigest)
+				{
+					Log::Info("Input content altered after last evaluate [{}]", inputFilePath.ToString());
+					return true;
+				}
+
+				++inputDigest;
+			}
+
+			return false;
+		}
+
 	private:
 		/// <summary>
 		/// Perform a check if the requested target is outdated with
@@ -84,7 +182,8 @@ namespace Soup::Core
 		/// </summary>
 		bool IsOutdated(
 			FileId targetFile,
-			const std::vector<FileId>& inputFiles)
+			const InputSet& inputFiles,
+			const std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>& unchangedInputFiles)
 		{
 			// Get the output file last write time
 			auto targetFileLastWriteTime = _fileSystemState.GetLastWriteTime(targetFile);
@@ -96,11 +195,170 @@ namespace Soup::Core
 				return true;
 			}
 
+			// Check the shared base once for every operation that references it
+			if (unchangedInputFiles.empty() && !inputFiles.GetBase().empty())
+			{
+				if (IsBaseOutdated(inputFiles.GetSharedBase(), targetFile, targetFileLastWriteTime.value()))
+					return true;
+
+				return IsAnyInputOutdated(targetFile, targetFileLastWriteTime.value(), inputFiles.GetDelta(), unchangedInputFiles);
+			}
+
+			return IsAnyInputOutdated(targetFile, targetFileLastWriteTime.value(), inputFiles, unchangedInputFiles);
+		}
+
+		/// <summary>
+		/// Check the newest write time of a shared input base against the target
+		/// </summary>
+		bool IsBaseOutdated(
+			const std::shared_ptr<const std::vector<FileId>>& base,
+			FileId targetFile,
+			std::chrono::time_point<std::chrono::file_clock> targetFileLastWriteTime)
+		{
+			auto baseState = GetInputBaseState(base);
+			if (baseState.HasMissingFile)
+			{
+				auto inputFilePath = _fileSystemState.GetFilePath(baseState.File);
+				Log::Info("Input Missing [{}]", inputFilePath.ToString());
+				return true;
+			}
+			else if (baseState.LastWriteTime > targetFileLastWriteTime)
+			{
+				auto inputFilePath = _fileSystemState.GetFilePath(baseState.File);
+				auto targetFilePath = _fileSystemState.GetFilePath(targetFile);
+				Log::Info("Input altered after target [{}] -> [{}]", inputFilePath.ToString(), targetFilePath.ToString());
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Get the newest write time for a shared input base, recalculated when one of its files may have changed
+		/// </summary>
+		InputBaseState GetInputBaseState(const std::shared_ptr<const std::vector<FileId>>& base)
+		{
+			auto lock = std::lock_guard<std::mutex>(_inputBaseMutex);
+
+			DirtyChangedInputBases();
+
+			auto findResult = _inputBaseStates.find(base.get());
+			if (findResult != _inputBaseStates.end() && findResult->second.Base.lock() != base)
+			{
+				// The address was reused by a new base after the previous one was released
+				_inputBaseStates.erase(findResult);
+				findResult = _inputBaseStates.end();
+			}
+
+			if (findResult == _inputBaseStates.end())
+			{
+				if (_inputBaseStates.size() >= _inputBaseSweepSize)
+					SweepReleasedInputBases();
+
+				auto newState = InputBaseState();
+				newState.Base = base;
+				findResult = _inputBaseStates.emplace(base.get(), std::move(newState)).first;
+				for (auto inputFile : *base)
+					_inputBaseLookup[inputFile].push_back(base.get());
+			}
+
+			auto& baseState = findResult->second;
+			if (baseState.IsDirty)
+			{
+				baseState.IsDirty = false;
+				baseState.HasMissingFile = false;
+				baseState.File = 0;
+				baseState.LastWriteTime = std::chrono::time_point<std::chrono::file_clock>::min();
+				for (auto inputFile : *base)
+				{
+					auto lastWriteTime = _fileSystemState.GetLastWriteTime(inputFile);
+					if (!lastWriteTime.has_value())
+					{
+						baseState.HasMissingFile = true;
+						baseState.File = inputFile;
+						break;
+					}
+					else if (lastWriteTime.value() > baseState.LastWriteTime)
+					{
+						baseState.File = inputFile;
+						baseState.LastWriteTime = lastWriteTime.value();
+					}
+				}
+			}
+
+			return baseState;
+		}
+
+		/// <summary>
+		/// Mark the bases that reference a file whose write time changed since the last check
+		/// </summary>
+		void DirtyChangedInputBases()
+		{
+			auto writeTimeVersion = _fileSystemState.GetWriteTimeVersion();
+			if (writeTimeVersion == _inputBaseWriteTimeVersion)
+				return;
+
+			for (auto changedFile : _fileSystemState.GetWriteTimeChanges(_inputBaseWriteTimeVersion))
+			{
+				auto findBases = _inputBaseLookup.find(changedFile);
+				if (findBases == _inputBaseLookup.end())
+					continue;
+
+				for (auto base : findBases->second)
+				{
+					auto findState = _inputBaseStates.find(base);
+					if (findState != _inputBaseStates.end())
+						findState->second.IsDirty = true;
+				}
+			}
+
+			_inputBaseWriteTimeVersion = writeTimeVersion;
+		}
+
+		/// <summary>
+		/// Evict the cached state for bases that are no longer referenced by any results
+		/// </summary>
+		void SweepReleasedInputBases()
+		{
+			std::erase_if(
+				_inputBaseStates,
+				[](const auto& item) { return item.second.Base.expired(); });
+
+			// Rebuild the file lookup from the bases that are still alive
+			_inputBaseLookup.clear();
+			for (auto& [baseAddress, baseState] : _inputBaseStates)
+			{
+				auto base = baseState.Base.lock();
+				if (base == nullptr)
+					continue;
+
+				for (auto inputFile : *base)
+					_inputBaseLookup[inputFile].push_back(baseAddress);
+			}
+
+			_inputBaseSweepSize = std::max(MinInputBaseSweepSize, _inputBaseStates.size() * 2);
+		}
+
+		template<typename TFiles>
+		bool IsAnyInputOutdated(
+			FileId targetFile,
+			std::chrono::time_point<std::chrono::file_clock> targetFileLastWriteTime,
+			const TFiles& inputFiles,
+			const std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>& unchangedInputFiles)
+		{
 			// Note: No need to use cache here since target files should only be analyzed once
 			for (auto& inputFile : inputFiles)
 			{
+				// The rewrite only left the input untouched for targets that were built after the previous content was written,
+				// an older target may have missed a change from an earlier build that failed before it ran
+				auto findUnchanged = unchangedInputFiles.find(inputFile);
+				if (findUnchanged != unchangedInputFiles.end() && findUnchanged->second <= targetFileLastWriteTime)
+					continue;
+
 				// If the file is relative then combine it with the root path
-				if (IsOutdated(inputFile, targetFile, targetFileLastWriteTime.value()))
+				if (IsOutdated(inputFile, targetFile, targetFileLastWriteTime))
 				{
 					return true;
 				}
@@ -8,19 +8,139 @@
 #include "IEvaluateEngine.h"
 #include "BuildConstants.h"
 #include "BuildFailedException.h"
+#include "BuildHistoryChecker.h"
 #include "PackageProvider.h"
 #include "RecipeBuildArguments.h"
 #include "RecipeBuildLocationManager.h"
 #include "FileSystemState.h"
+#include "generate/GenerateEngine.h"
 #include "local-user-config/LocalUserConfig.h"
 #include "operation-graph/OperationGraphManager.h"
-#include "operation-graph/OperationResultsManager.h"
+#include "operation-graph/OperationResultsJournal.h"
 #include "utilities/HandledException.h"
 #include "value-table/ValueTableManager.h"
 #include "recipe/RecipeBuildStateConverter.h"
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// A single package in the flattened dependency graph that is scheduled by the parallel build
+	/// </summary>
+	struct PackageBuildNode
+	{
+		const PackageGraph* Graph;
+		const PackageInfo* Info;
+		std::vector<size_t> Dependents;
+		uint32_t RemainingDependencyCount;
+	};
+
+	/// <summary>
+	/// The shared scheduler state for building independent packages in parallel
+	/// </summary>
+	class PackageBuildState
+	{
+	public:
+		PackageBuildState() :
+			Nodes(),
+			NodeLookup(),
+			Mutex(),
+			WorkAvailable(),
+			ReadyPackages(),
+			ActivePackageCount(0),
+			Failure(nullptr)
+		{
+		}
+
+		// The packages in dependency first order
+		std::vector<PackageBuildNode> Nodes;
+		std::map<PackageId, size_t> NodeLookup;
+
+		// Scheduler State
+		// Ready packages are ordered by their index to stay close to the serial build order
+		std::mutex Mutex;
+		std::condition_variable WorkAvailable;
+		std::set<size_t> ReadyPackages;
+		uint32_t ActivePackageCount;
+		std::exception_ptr Failure;
+	};
+
+	/// <summary>
+	/// The log context for the packages that are actively building.
+	/// The logger has a single process wide active id, so a package id is only attributed while it is the
+	/// only package building and events are left unattributed (id 0) while independent packages overlap
+	/// </summary>
+	class PackageLogContext
+	{
+	private:
+		std::mutex _mutex;
+		std::multiset<PackageId> _activePackages;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PackageLogContext"/> class.
+		/// </summary>
+		PackageLogContext() :
+			_mutex(),
+			_activePackages()
+		{
+		}
+
+		/// <summary>
+		/// Mark a package as building on the calling thread
+		/// </summary>
+		void Enter(PackageId packageId)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_activePackages.insert(packageId);
+			UpdateActiveId();
+		}
+
+		/// <summary>
+		/// Mark a package as complete
+		/// </summary>
+		void Exit(PackageId packageId)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_activePackages.erase(_activePackages.find(packageId));
+			UpdateActiveId();
+		}
+
+	private:
+		void UpdateActiveId()
+		{
+			if (_activePackages.size() == 1)
+				Log::SetActiveId(*_activePackages.begin());
+			else
+				Log::SetActiveId(0);
+		}
+	};
+
+	/// <summary>
+	/// Keeps a package in the log context for the lifetime of the scope
+	/// </summary>
+	class ScopedPackageLogContext
+	{
+	private:
+		PackageLogContext& _context;
+		PackageId _packageId;
+
+	public:
+		ScopedPackageLogContext(PackageLogContext& context, PackageId packageId) :
+			_context(context),
+			_packageId(packageId)
+		{
+			_context.Enter(_packageId);
+		}
+
+		ScopedPackageLogContext(const ScopedPackageLogContext&) = delete;
+		ScopedPackageLogContext& operator=(const ScopedPackageLogContext&) = delete;
+
+		~ScopedPackageLogContext()
+		{
+			_context.Exit(_packageId);
+		}
+	};
+
 	/// <summary>
 	/// The build runner that knows how to perform the correct build for a recipe
 	/// and all of its development and runtime dependencies
@@ -46,7 +166,15 @@ namespace Soup::Core
 		RecipeBuildLocationManager& _locationManager;
 
 		// Mapping from package id to the required information to be used with dependencies parameters
+		// The mutex also guards the shared recipe cache while packages build in parallel
 		std::map<PackageId, RecipeBuildCacheState> _buildCache;
+		std::mutex _buildCacheMutex;
+
+		// The warm Wren hosts shared by every in-process generate
+		Generate::GenerateHostPool _generateHostPool;
+
+		// Attributes log events to the packages that are building
+		PackageLogContext _logContext;
 
 		const std::string _dependencyTypeBuild = "Build";
 		const std::string _dependencyTypeTool = "Tool";
@@ -72,7 +200,10 @@ namespace Soup::Core
 			_evaluateEngine(evaluateEngine),
 			_fileSystemState(fileSystemState),
 			_locationManager(locationManager),
-			_buildCache()
+			_buildCache(),
+			_buildCacheMutex(),
+			_generateHostPool(),
+			_logContext()
 		{
 		}
 
@@ -89,7 +220,14 @@ namespace Soup::Core
 				// Enable log event ids to track individual builds
 				auto& packageGraph = _packageProvider.GetRootPackageGraph();
 				auto& packageInfo = _packageProvider.GetPackageInfo(packageGraph.RootPackageId);
-				BuildPackageAndDependencies(packageGraph, packageInfo);
+				if (_arguments.MaxParallelPackages > 1)
+				{
+					BuildPackagesParallel(packageGraph, packageInfo);
+				}
+				else
+				{
+					BuildPackageAndDependencies(packageGraph, packageInfo);
+				}
 
 				Log::EnsureListener().SetShowEventId(false);
 			}
@@ -101,6 +239,159 @@ namespace Soup::Core
 		}
 
 	private:
+		/// <summary>
+		/// Build the full dependency graph with independent packages running concurrently
+		/// </summary>
+		void BuildPackagesParallel(const PackageGraph& packageGraph, const PackageInfo& packageInfo)
+		{
+			auto buildState = PackageBuildState();
+			AddPackageBuildNode(buildState, packageGraph, packageInfo);
+
+			for (auto index = 0u; index < buildState.Nodes.size(); index++)
+			{
+				if (buildState.Nodes[index].RemainingDependencyCount == 0)
+					buildState.ReadyPackages.insert(index);
+			}
+
+			// Never spin up more workers than there are packages to build
+			auto workerCount = std::min<size_t>(_arguments.MaxParallelPackages, buildState.Nodes.size());
+			Log::Diag("Build packages in parallel: {} packages, {} workers", buildState.Nodes.size(), workerCount);
+
+			// The calling thread always participates as the first worker
+			auto workers = std::vector<std::thread>();
+			for (auto workerId = 1u; workerId < workerCount; workerId++)
+			{
+				workers.emplace_back(&BuildRunner::RunPackageWorker, this, std::ref(buildState));
+			}
+
+			RunPackageWorker(buildState);
+
+			for (auto& worker : workers)
+			{
+				worker.join();
+			}
+
+			// Surface the first failure after all running packages have completed
+			if (buildState.Failure != nullptr)
+			{
+				std::rethrow_exception(buildState.Failure);
+			}
+		}
+
+		/// <summary>
+		/// Flatten the package and its dependencies into the build state, returning the node index
+		/// </summary>
+		size_t AddPackageBuildNode(
+			PackageBuildState& buildState,
+			const PackageGraph& packageGraph,
+			const PackageInfo& packageInfo)
+		{
+			auto findNode = buildState.NodeLookup.find(packageInfo.Id);
+			if (findNode != buildState.NodeLookup.end())
+				return findNode->second;
+
+			// Prebuilt packages do not build their dependencies
+			auto dependencyNodes = std::set<size_t>();
+			if (!packageInfo.IsPrebuilt)
+			{
+				for (auto& [dependencyType, dependencyTypeSet] : packageInfo.Dependencies)
+				{
+					for (auto& dependency : dependencyTypeSet)
+					{
+						if (dependency.IsSubGraph)
+						{
+							auto& dependencyPackageGraph = _packageProvider.GetPackageGraph(dependency.PackageGraphId);
+							auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependencyPackageGraph.RootPackageId);
+							dependencyNodes.insert(
+								AddPackageBuildNode(buildState, dependencyPackageGraph, dependencyPackageInfo));
+						}
+						else
+						{
+							auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependency.PackageId);
+							dependencyNodes.insert(
+								AddPackageBuildNode(buildState, packageGraph, dependencyPackageInfo));
+						}
+					}
+				}
+			}
+
+			auto index = buildState.Nodes.size();
+			buildState.Nodes.push_back(PackageBuildNode(
+				&packageGraph,
+				&packageInfo,
+				std::vector<size_t>(),
+				static_cast<uint32_t>(dependencyNodes.size())));
+			buildState.NodeLookup.emplace(packageInfo.Id, index);
+
+			for (auto dependencyNode : dependencyNodes)
+			{
+				buildState.Nodes[dependencyNode].Dependents.push_back(index);
+			}
+
+			return index;
+		}
+
+		/// <summary>
+		/// The worker loop that builds ready packages until the entire graph is complete
+		/// </summary>
+		void RunPackageWorker(PackageBuildState& buildState)
+		{
+			auto lock = std::unique_lock<std::mutex>(buildState.Mutex);
+			while (true)
+			{
+				// Stop picking up new work as soon as any package fails
+				if (buildState.Failure != nullptr)
+					break;
+
+				if (!buildState.ReadyPackages.empty())
+				{
+					auto index = *buildState.ReadyPackages.begin();
+					buildState.ReadyPackages.erase(buildState.ReadyPackages.begin());
+					buildState.ActivePackageCount++;
+
+					auto& node = buildState.Nodes[index];
+					lock.unlock();
+					try
+					{
+						if (node.Info->IsPrebuilt)
+						{
+							BuildPackageAndDependencies(*node.Graph, *node.Info);
+						}
+						else
+						{
+							CheckBuildPackage(*node.Graph, *node.Info);
+						}
+
+						lock.lock();
+						for (auto dependent : node.Dependents)
+						{
+							if (--buildState.Nodes[dependent].RemainingDependencyCount == 0)
+								buildState.ReadyPackages.insert(dependent);
+						}
+					}
+					catch (...)
+					{
+						if (!lock.owns_lock())
+							lock.lock();
+						if (buildState.Failure == nullptr)
+							buildState.Failure = std::current_exception();
+					}
+
+					buildState.ActivePackageCount--;
+					buildState.WorkAvailable.notify_all();
+				}
+				else if (buildState.ActivePackageCount == 0)
+				{
+					// Nothing is queued and nothing is running that could unblock more work
+					break;
+				}
+				else
+				{
+					buildState.WorkAvailable.wait(lock);
+				}
+			}
+		}
+
 		/// <summary>
 		/// Build the dependencies for the provided recipe recursively
 		/// </summary>
@@ -108,6 +399,7 @@ namespace Soup::Core
 		{
 			if (packageInfo.IsPrebuilt)
 			{
+				auto lock = std::lock_guard<std::mutex>(_buildCacheMutex);
 				if (_buildCache.contains(packageInfo.Id))
 				{
 					Log::Diag("Prebuilt Package was already processed");
@@ -164,32 +456,30 @@ namespace Soup::Core
 		/// </summary>
 		void CheckBuildPackage(const PackageGraph& packageGraph, const PackageInfo& packageInfo)
 		{
-			// TODO: RAII for active id
-			try
-			{
-				Log::SetActiveId(packageInfo.Id);
-				Log::Diag("Running Build: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
-
-				// Check if we already built this package down a different dependency path
-				if (_buildCache.contains(packageInfo.Id))
-				{
-					Log::Diag("Recipe already built: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
-				}
-				else
-				{
-					// Run the required builds in process
-					RunBuild(packageGraph, packageInfo);
-				}
+			auto scopedLogContext = ScopedPackageLogContext(_logContext, packageInfo.Id);
+			Log::Diag("Running Build: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
 
-				Log::SetActiveId(0);
+			// Check if we already built this package down a different dependency path
+			if (HasBuildCache(packageInfo.Id))
+			{
+				Log::Diag("Recipe already built: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
 			}
-			catch(...)
+			else
 			{
-				Log::SetActiveId(0);
-				throw;
+				// Run the required builds in process
+				RunBuild(packageGraph, packageInfo);
 			}
 		}
 
+		/// <summary>
+		/// Check if the package has already been built
+		/// </summary>
+		bool HasBuildCache(PackageId packageId)
+		{
+			auto lock = std::lock_guard<std::mutex>(_buildCacheMutex);
+			return _buildCache.contains(packageId);
+		}
+
 		/// <summary>
 		/// Setup and run the individual components of the Generate and Evaluate phases for a given package
 		/// </summary>
@@ -202,6 +492,7 @@ namespace Soup::Core
 				std::format("/(PACKAGE_{})/", packageInfo.Name.ToString()));
 			auto macroTargetDirectory = Path(
 				std::format("/(TARGET_{})/", packageInfo.Name.ToString()));
+			auto buildCacheLock = std::unique_lock<std::mutex>(_buildCacheMutex);
 			auto realTargetDirectory = _locationManager.GetOutputDirectory(
 				packageInfo.Name,
 				packageInfo.PackageRoot,
@@ -216,6 +507,7 @@ namespace Soup::Core
 				macroPackageDirectory,
 				macroTargetDirectory,
 				realTargetDirectory);
+			buildCacheLock.unlock();
 
 			// Preload target
 			// TODO: Ideally this should be done in the preload step, but easier here with the graph id
@@ -231,6 +523,8 @@ namespace Soup::Core
 			Log::Diag(evaluateGraphFile.ToString());
 			auto evaluateGraph = OperationGraph();
 			auto evaluateResults = OperationResults();
+			auto evaluateJournaledOperations = std::set<OperationId>();
+			auto isEvaluateResultsSnapshotStale = true;
 			auto hasExistingGraph = OperationGraphManager::TryLoadState(
 				evaluateGraphFile,
 				evaluateGraph,
@@ -249,6 +543,16 @@ namespace Soup::Core
 					_fileSystemState))
 				{
 					Log::Info("Previous results found");
+					isEvaluateResultsSnapshotStale = false;
+
+					// Apply the results that were journaled after the last full save
+					auto evaluateJournalFile = soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName();
+					evaluateJournaledOperations = OperationResultsManager::TryLoadJournal(
+						evaluateJournalFile,
+						evaluateResults,
+						_fileSystemState);
+					if (!evaluateJournaledOperations.empty())
+						Log::Info("Applied {} journaled results", evaluateJournaledOperations.size());
 				}
 				else
 				{
@@ -272,6 +576,7 @@ namespace Soup::Core
 					System::IFileSystem::Current().CreateDirectory(soupTargetDirectory);
 				}
 
+				auto generatedEvaluateGraph = std::optional<OperationGraph>();
 				auto ranGenerate = RunIncrementalGenerate(
 					packageInfo,
 					macroPackageDirectory,
@@ -279,7 +584,8 @@ namespace Soup::Core
 					realTargetDirectory,
 					soupTargetDirectory,
 					packageGraph.GlobalParameters,
-					packageAccessSet);
+					packageAccessSet,
+					generatedEvaluateGraph);
 
 				//////////////////////////////////////////////
 				// SETUP
@@ -288,14 +594,22 @@ namespace Soup::Core
 				// Load the new Evaluate Operation Graph and merge any results that are still relevant
 				if (ranGenerate)
 				{
-					Log::Info("Loading new Evaluate Operation Graph");
 					auto updatedEvaluateGraph = OperationGraph();
-					if (!OperationGraphManager::TryLoadState(
-						evaluateGraphFile,
-						updatedEvaluateGraph,
-						_fileSystemState))
+					if (generatedEvaluateGraph.has_value())
 					{
-						throw std::runtime_error("Missing required evaluate operation graph after generate evaluated.");
+						// The in-process generate hands over the graph it just saved
+						updatedEvaluateGraph = std::move(generatedEvaluateGraph.value());
+					}
+					else
+					{
+						Log::Info("Loading new Evaluate Operation Graph");
+						if (!OperationGraphManager::TryLoadState(
+							evaluateGraphFile,
+							updatedEvaluateGraph,
+							_fileSystemState))
+						{
+							throw std::runtime_error("Missing required evaluate operation graph after generate evaluated.");
+						}
 					}
 
 					Log::Diag("Map previous operation graph observed results");
@@ -305,8 +619,11 @@ namespace Soup::Core
 						updatedEvaluateGraph);
 
 					// Replace the previous operation graph and results
+					// Note: The operation ids no longer match the saved results so they must be fully rewritten
 					evaluateGraph = std::move(updatedEvaluateGraph);
 					evaluateResults = std::move(updatedEvaluateResults);
+					evaluateJournaledOperations.clear();
+					isEvaluateResultsSnapshotStale = true;
 				}
 			}
 
@@ -318,11 +635,14 @@ namespace Soup::Core
 				RunEvaluate(
 					evaluateGraph,
 					evaluateResults,
+					std::move(evaluateJournaledOperations),
+					isEvaluateResultsSnapshotStale,
 					realTargetDirectory,
 					soupTargetDirectory);
 			}
 
 			// Cache the build state for upstream dependencies
+			buildCacheLock.lock();
 			_buildCache.emplace(
 				packageInfo.Id,
 				RecipeBuildCacheState(
@@ -336,6 +656,7 @@ namespace Soup::Core
 
 		/// <summary>
 		/// Run an incremental generate phase
+		/// The graph is only set when the generate ran in process, otherwise it must be loaded from disk
 		/// </summary>
 		bool RunIncrementalGenerate(
 			const PackageInfo& packageInfo,
@@ -344,13 +665,16 @@ namespace Soup::Core
 			const Path& realTargetDirectory,
 			const Path& soupTargetDirectory,
 			const ValueTable& globalParameters,
-			const DependencyTargetSet& packageAccessSet)
+			const DependencyTargetSet& packageAccessSet,
+			std::optional<OperationGraph>& generatedEvaluateGraph)
 		{
 			// Clone the global parameters
 			auto inputTable = ValueTable();
 
 			// Pass along internal dependency information
+			auto buildCacheLock = std::unique_lock<std::mutex>(_buildCacheMutex);
 			inputTable.emplace("Dependencies", GenerateInputDependenciesValueTable(packageInfo));
+			buildCacheLock.unlock();
 
 			// Setup input that will be included in the global state
 			auto globalState = ValueTable();
@@ -366,7 +690,9 @@ namespace Soup::Core
 			globalState.emplace("Parameters", globalParameters);
 
 			// Generate the dependencies input state
+			buildCacheLock.lock();
 			globalState.emplace("Dependencies", GenerateParametersDependenciesValueTable(packageInfo));
+			buildCacheLock.unlock();
 
 			// Pass along the file system state
 			auto fileSystemRoot = BuildDirectoryStructure(packageInfo.PackageRoot);
@@ -421,6 +747,11 @@ namespace Soup::Core
 				ValueTableManager::SaveState(inputFile, inputTable);
 			}
 
+			if (_arguments.InProcessGenerate)
+			{
+				return RunInProcessGenerate(packageInfo, soupTargetDirectory, generatedEvaluateGraph);
+			}
+
 			// Run the incremental generate
 			auto generateGraph = OperationGraph();
 
@@ -507,7 +838,8 @@ namespace Soup::Core
 				generateResults,
 				temporaryDirectory,
 				generateAllowedReadAccess,
-				generateAllowedWriteAccess);
+				generateAllowedWriteAccess,
+				nullptr);
 
 			if (ranEvaluate)
 			{
@@ -518,6 +850,91 @@ namespace Soup::Core
 			return ranEvaluate;
 		}
 
+		/// <summary>
+		/// Run an incremental generate phase in process using the shared pool of warm Wren hosts
+		/// Without a monitored child process the inputs are the files the generate engine declares as read
+		/// </summary>
+		bool RunInProcessGenerate(
+			const PackageInfo& packageInfo,
+			const Path& soupTargetDirectory,
+			std::optional<OperationGraph>& generatedEvaluateGraph)
+		{
+			OperationId generateOperationId = 1;
+
+			// Load the previous build results if it exists
+			auto generateResultsFile = soupTargetDirectory + BuildConstants::GenerateResultsFileName();
+			Log::Info("Checking for existing Generate Operation Results");
+			Log::Diag(generateResultsFile.ToString());
+			auto generateResults = OperationResults();
+			if (OperationResultsManager::TryLoadState(
+				generateResultsFile,
+				generateResults,
+				_fileSystemState))
+			{
+				Log::Info("Previous results found");
+			}
+			else
+			{
+				Log::Info("No previous results found");
+			}
+
+			// The build runner stands in for the generate executable, upgrading it must regenerate
+			auto executableFileId = _fileSystemState.ToFileId(
+				System::IProcessManager::Current().GetCurrentProcessFileName());
+
+			OperationResult* previousResult;
+			if (!_arguments.ForceRebuild &&
+				generateResults.TryFindResult(generateOperationId, previousResult) &&
+				previousResult->WasSuccessfulRun)
+			{
+				auto stateChecker = BuildHistoryChecker(_fileSystemState);
+				if (!stateChecker.IsOutdated(previousResult->EvaluateTime, executableFileId) &&
+					!stateChecker.IsOutdated(previousResult->ObservedOutput, previousResult->ObservedInput))
+				{
+					Log::Info("Up to date");
+					return false;
+				}
+			}
+
+			Log::HighPriority(
+				"Generate: [{}]{}",
+				packageInfo.Recipe->GetLanguage().GetName(),
+				packageInfo.Name.ToString());
+			auto generateEngine = Generate::GenerateEngine(_fileSystemState, _generateHostPool);
+			try
+			{
+				generatedEvaluateGraph = generateEngine.Run(soupTargetDirectory);
+			}
+			catch (const std::exception& ex)
+			{
+				// Fail the same way as the generate process, leave the previous results untouched
+				Log::Error("Generate failed: {}", ex.what());
+				throw BuildFailedException();
+			}
+
+			// Ensure the File System State is notified of the generate output
+			auto observedOutput = _fileSystemState.ToFileIds(
+				generateEngine.GetWriteFiles(),
+				packageInfo.PackageRoot);
+			_fileSystemState.InvalidateFileWriteTimes(observedOutput);
+
+			auto observedInput = _fileSystemState.ToFileIds(
+				generateEngine.GetReadFiles(),
+				packageInfo.PackageRoot);
+			generateResults.AddOrUpdateOperationResult(
+				generateOperationId,
+				OperationResult(
+					true,
+					System::ISystem::Current().GetCurrentTime(),
+					InputSet(std::move(observedInput)),
+					std::move(observedOutput)));
+
+			// Save the generate operation results for future incremental builds
+			OperationResultsManager::SaveState(generateResultsFile, generateResults, _fileSystemState);
+
+			return true;
+		}
+
 		OperationResults MergeOperationResults(
 			const OperationGraph& previousGraph,
 			OperationResults& previousResults,
@@ -546,6 +963,8 @@ namespace Soup::Core
 		void RunEvaluate(
 			const OperationGraph& evaluateGraph,
 			OperationResults& evaluateResults,
+			std::set<OperationId> evaluateJournaledOperations,
+			bool isEvaluateResultsSnapshotStale,
 			const Path& realTargetDirectory,
 			const Path& soupTargetDirectory)
 		{
@@ -573,28 +992,41 @@ namespace Soup::Core
 				System::IFileSystem::Current().CreateDirectory(temporaryDirectory);
 			}
 
+			// Each completed operation is journaled as it finishes, the full results are only
+			// rewritten when the journal grows too large or the saved results are out of date
+			auto evaluateJournal = OperationResultsJournal(
+				soupTargetDirectory + BuildConstants::EvaluateResultsFileName(),
+				soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName(),
+				evaluateResults,
+				std::move(evaluateJournaledOperations),
+				isEvaluateResultsSnapshotStale,
+				_fileSystemState);
+
 			try
 			{
 				// Evaluate the build
-				auto ranEvaluate = _evaluateEngine.Evaluate(
+				_evaluateEngine.Evaluate(
 					evaluateGraph,
 					evaluateResults,
 					temporaryDirectory,
 					allowedReadAccess,
-					allowedWriteAccess);
+					allowedWriteAccess,
+					&evaluateJournal);
 
-				if (ranEvaluate)
+				if (evaluateJournal.RequiresCompaction())
 				{
 					Log::Info("Saving updated build state");
-					auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
-					OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+					evaluateJournal.Compact();
 				}
 			}
 			catch(const BuildFailedException&)
 			{
-				Log::Info("Saving partial build state");
-				auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
-				OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+				if (evaluateJournal.RequiresCompaction())
+				{
+					Log::Info("Saving partial build state");
+					evaluateJournal.Compact();
+				}
+
 				throw;
 			}
 
@@ -856,7 +1288,7 @@ namespace Soup::Core
 			return result;
 		}
 
-		void BuildDirectoryStructure(DirectoryState& activeDirectory, ValueList& result)
+		void BuildDirectoryStructure(const DirectoryState& activeDirectory, ValueList& result)
 		{
 			for (auto& file : activeDirectory.Files)
 			{
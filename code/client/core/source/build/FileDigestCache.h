@@ -0,0 +1,212 @@
+﻿// <copyright file="FileDigestCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "utilities/ContentHash.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A single cached file content digest and the last write time and size of the file when it was hashed
+	/// </summary>
+	struct FileDigestEntry
+	{
+		int64_t LastWriteTime;
+		uint64_t Size;
+		uint64_t Digest;
+	};
+
+	/// <summary>
+	/// The persisted cache of file content digests keyed by last write time and size
+	/// so that unchanged files are never hashed more than once
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class FileDigestCache
+	{
+	private:
+		// Binary File Digest cache file format
+		static constexpr uint32_t FileVersion = 3;
+
+		// Hash the contents in fixed size chunks to keep memory flat for large inputs
+		static constexpr size_t ChunkSize = 64 * 1024;
+
+		// The coarsest write time resolution of the supported file systems, FAT rounds to two seconds
+		static constexpr auto WriteTimeResolution = std::chrono::seconds(2);
+
+		std::mutex _mutex;
+		std::unordered_map<std::string, FileDigestEntry> _entries;
+		bool _isModified;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="FileDigestCache"/> class.
+		/// </summary>
+		FileDigestCache() :
+			_mutex(),
+			_entries(),
+			_isModified(false)
+		{
+		}
+
+		/// <summary>
+		/// Get a value indicating if there are new digests that have not been saved
+		/// </summary>
+		bool IsModified() const
+		{
+			return _isModified;
+		}
+
+		/// <summary>
+		/// Get the content digest for the provided file, only hashing the contents if the file changed
+		/// </summary>
+		bool TryGetDigest(const Path& file, uint64_t& digest)
+		{
+			std::chrono::time_point<std::chrono::file_clock> lastWriteTimeValue;
+			if (!System::IFileSystem::Current().TryGetLastWriteTime(file, lastWriteTimeValue))
+				return false;
+
+			std::shared_ptr<System::IInputFile> inputFile;
+			if (!System::IFileSystem::Current().TryOpenRead(file, true, inputFile))
+				return false;
+
+			// The size catches a rewrite that lands within the write time resolution of the file system
+			auto& stream = inputFile->GetInStream();
+			stream.seekg(0, std::ios::end);
+			auto size = static_cast<uint64_t>(stream.tellg());
+			stream.seekg(0, std::ios::beg);
+
+			auto lastWriteTime = static_cast<int64_t>(lastWriteTimeValue.time_since_epoch().count());
+			auto fileString = file.ToString();
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				auto findResult = _entries.find(fileString);
+				if (findResult != _entries.end() &&
+					findResult->second.LastWriteTime == lastWriteTime &&
+					findResult->second.Size == size)
+				{
+					digest = findResult->second.Digest;
+					return true;
+				}
+			}
+
+			// Hash the contents outside of the lock to allow concurrent evaluations to make progress
+			auto hash = ContentHash::Stream();
+			auto buffer = std::vector<char>(ChunkSize);
+			while (stream)
+			{
+				stream.read(buffer.data(), buffer.size());
+				hash.Update(std::string_view(buffer.data(), static_cast<size_t>(stream.gcount())));
+			}
+
+			if (stream.bad())
+				return false;
+
+			digest = hash.Finalize();
+
+			// A file written within the write time resolution of the hash can still change
+			// without a new write time, only use the digest for this request
+			if (lastWriteTimeValue + WriteTimeResolution > std::chrono::file_clock::now())
+				return true;
+
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_entries.insert_or_assign(std::move(fileString), FileDigestEntry(lastWriteTime, size, digest));
+			_isModified = true;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Load the cache from the provided file, an invalid file leaves the cache empty
+		/// </summary>
+		bool TryLoadState(const Path& cacheFile)
+		{
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(cacheFile, true, file))
+			{
+				Log::Diag("File digest cache does not exist");
+				return false;
+			}
+
+			auto& stream = file->GetInStream();
+			auto header = std::array<char, 4>();
+			stream.read(header.data(), 4);
+			if (header[0] != 'B' ||
+				header[1] != 'F' ||
+				header[2] != 'D' ||
+				header[3] != '\0' ||
+				ReadValue<uint32_t>(stream) != FileVersion)
+			{
+				Log::Warning("Invalid file digest cache, ignoring");
+				return false;
+			}
+
+			auto entries = std::unordered_map<std::string, FileDigestEntry>();
+			auto entryCount = ReadValue<uint32_t>(stream);
+			for (auto i = 0u; i < entryCount; i++)
+			{
+				auto fileLength = ReadValue<uint32_t>(stream);
+				auto fileString = std::string(fileLength, '\0');
+				stream.read(fileString.data(), fileLength);
+
+				auto entry = FileDigestEntry();
+				entry.LastWriteTime = ReadValue<int64_t>(stream);
+				entry.Size = ReadValue<uint64_t>(stream);
+				entry.Digest = ReadValue<uint64_t>(stream);
+				entries.emplace(std::move(fileString), entry);
+			}
+
+			if (!stream)
+			{
+				Log::Warning("File digest cache corrupted, ignoring");
+				return false;
+			}
+
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_entries = std::move(entries);
+			_isModified = false;
+			return true;
+		}
+
+		/// <summary>
+		/// Save the cache to the provided file
+		/// </summary>
+		void SaveState(const Path& cacheFile)
+		{
+			auto file = System::IFileSystem::Current().OpenWrite(cacheFile, true);
+			auto& stream = file->GetOutStream();
+
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			stream.write("BFD\0", 4);
+			WriteValue(stream, FileVersion);
+			WriteValue(stream, static_cast<uint32_t>(_entries.size()));
+			for (auto& [fileString, entry] : _entries)
+			{
+				WriteValue(stream, static_cast<uint32_t>(fileString.size()));
+				stream.write(fileString.data(), fileString.size());
+				WriteValue(stream, entry.LastWriteTime);
+				WriteValue(stream, entry.Size);
+				WriteValue(stream, entry.Digest);
+			}
+
+			_isModified = false;
+		}
+
+	private:
+		template<typename T>
+		static T ReadValue(std::istream& stream)
+		{
+			T result = 0;
+			stream.read(reinterpret_cast<char*>(&result), sizeof(T));
+			return result;
+		}
+
+		template<typename T>
+		static void WriteValue(std::ostream& stream, T value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(T));
+		}
+	};
+}
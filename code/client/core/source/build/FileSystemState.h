@@ -29,6 +29,7 @@ namespace Soup::Core
 
 	/// <summary>
 	/// The complete set of known files that tracking the active change state during execution
+	/// Access is internally synchronized so independent packages can be evaluated concurrently
 	/// </summary>
 	class FileSystemState
 	{
@@ -37,6 +38,9 @@ namespace Soup::Core
 		/// Initializes a new instance of the <see cref="FileSystemState"/> class.
 		/// </summary>
 		FileSystemState() :
+			_mutex(),
+			_writeTimeVersion(0),
+			_writeTimeChanges(),
 			_maxFileId(0),
 			_files(),
 			_fileLookup(),
@@ -63,6 +67,9 @@ namespace Soup::Core
 			std::unordered_map<FileId, Path> files,
 			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> directoryLookup,
 			std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> writeCache) :
+			_mutex(),
+			_writeTimeVersion(0),
+			_writeTimeChanges(),
 			_maxFileId(maxFileId),
 			_files(std::move(files)),
 			_fileLookup(),
@@ -79,10 +86,26 @@ namespace Soup::Core
 		}
 
 		/// <summary>
-		/// Get Files
+		/// Initializes a new instance of the <see cref="FileSystemState"/> class from an existing state.
 		/// </summary>
-		const std::unordered_map<FileId, Path>& GetFiles() const
+		FileSystemState(FileSystemState&& other) :
+			_mutex(),
+			_writeTimeVersion(other._writeTimeVersion),
+			_writeTimeChanges(std::move(other._writeTimeChanges)),
+			_maxFileId(other._maxFileId),
+			_files(std::move(other._files)),
+			_fileLookup(std::move(other._fileLookup)),
+			_directoryLookup(std::move(other._directoryLookup)),
+			_writeCache(std::move(other._writeCache))
 		{
+		}
+
+		/// <summary>
+		/// Get a copy of the known files, taken under the lock so concurrent builds may keep adding files
+		/// </summary>
+		std::unordered_map<FileId, Path> GetFiles() const
+		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
 			return _files;
 		}
 
@@ -94,14 +117,52 @@ namespace Soup::Core
 			return _maxFileId;
 		}
 
+		/// <summary>
+		/// Get the version of the write times, which changes every time a known write time may have changed
+		/// Allows callers to cache values derived from a group of write times
+		/// </summary>
+		uint64_t GetWriteTimeVersion() const
+		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+			return _writeTimeVersion;
+		}
+
+		/// <summary>
+		/// Get the files whose write times may have changed after the provided version
+		/// Allows callers to only refresh the cached values that depend on the changed files
+		/// </summary>
+		std::vector<FileId> GetWriteTimeChanges(uint64_t version) const
+		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
+			// Changes are recorded in version order
+			auto firstChange = std::upper_bound(
+				_writeTimeChanges.begin(),
+				_writeTimeChanges.end(),
+				version,
+				[](uint64_t value, const std::pair<uint64_t, FileId>& change) { return value < change.first; });
+
+			auto result = std::vector<FileId>();
+			for (auto change = firstChange; change != _writeTimeChanges.end(); ++change)
+			{
+				result.push_back(change->second);
+			}
+
+			return result;
+		}
+
 		/// <summary>
 		/// Update the write times for the provided set of files
 		/// </summary>
 		void InvalidateFileWriteTimes(const std::vector<FileId>& files)
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
+			_writeTimeVersion++;
 			for (auto file : files)
 			{
 				InvalidateFileWriteTime(file);
+				_writeTimeChanges.emplace_back(_writeTimeVersion, file);
 			}
 		}
 
@@ -110,6 +171,8 @@ namespace Soup::Core
 		/// </summary>
 		std::optional<std::chrono::time_point<std::chrono::file_clock>> GetLastWriteTime(FileId file)
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			auto findResult = _writeCache.find(file);
 			if (findResult != _writeCache.end())
 			{
@@ -146,6 +209,8 @@ namespace Soup::Core
 
 		FileId ToFileId(const Path& file)
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			if (!file.HasRoot())
 				throw std::runtime_error("File paths must be absolute to resolve to an id");
 
@@ -172,6 +237,8 @@ namespace Soup::Core
 		/// </summary>
 		bool TryFindFileId(const Path& file, FileId& fileId) const
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			auto findResult = _fileLookup.find(file.ToString());
 			if (findResult != _fileLookup.end())
 			{
@@ -203,6 +270,8 @@ namespace Soup::Core
 		/// </summary>
 		const Path& GetFilePath(FileId fileId) const
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			auto findResult = _files.find(fileId);
 			if (findResult != _files.end())
 			{
@@ -220,6 +289,8 @@ namespace Soup::Core
 			std::cout << "PreloadDirectory: " << directory.ToString() << std::endl;
 			#endif
 
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			FileId directoryId;
 			if (!TryFindFileId(directory, directoryId))
 			{
@@ -228,6 +299,8 @@ namespace Soup::Core
 				// Add the requested file as null
 				// This will be replaced if the file exists with the find all callback
 				auto insertResult = _writeCache.insert_or_assign(directoryId, std::nullopt);
+				_writeTimeVersion++;
+				_writeTimeChanges.emplace_back(_writeTimeVersion, directoryId);
 
 				std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
 					[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
@@ -251,6 +324,7 @@ namespace Soup::Core
 
 						FileId fileId = ToFileId(absolutePath);
 						auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
+						_writeTimeChanges.emplace_back(_writeTimeVersion, fileId);
 					};
 
 				// Load the write times for all files in the directory
@@ -265,8 +339,13 @@ namespace Soup::Core
 			}
 		}
 
-		DirectoryState& GetDirectoryState(const Path& directory)
+		/// <summary>
+		/// Get a copy of the directory state, taken under the lock so concurrent preloads may keep updating the tree
+		/// </summary>
+		DirectoryState GetDirectoryState(const Path& directory) const
 		{
+			auto lock = std::lock_guard<std::recursive_mutex>(_mutex);
+
 			auto activeDirectory = GetDirectoryState(_directoryLookup, directory.GetRoot());
 			const auto directories = directory.DecomposeDirectories();
 			for (auto currentDirectory : directories)
@@ -278,9 +357,9 @@ namespace Soup::Core
 		}
 
 	private:
-		DirectoryState* GetDirectoryState(
-			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& activeDirectory,
-			const std::string_view name)
+		const DirectoryState* GetDirectoryState(
+			const std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& activeDirectory,
+			const std::string_view name) const
 		{
 			auto findResult = activeDirectory.find(name);
 			if (findResult != activeDirectory.end())
@@ -377,6 +456,14 @@ namespace Soup::Core
 		}
 
 	private:
+		// Recursive to allow the public helpers to call each other while holding the lock
+		mutable std::recursive_mutex _mutex;
+
+		uint64_t _writeTimeVersion;
+
+		// The files whose write times changed, paired with the version that changed them
+		std::vector<std::pair<uint64_t, FileId>> _writeTimeChanges;
+
 		// The maximum id that has been used for files
 		// Used to ensure unique ids are generated across the entire system
 		FileId _maxFileId;
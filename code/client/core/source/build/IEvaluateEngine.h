@@ -4,7 +4,7 @@
 
 #pragma once
 #include "operation-graph/OperationGraph.h"
-#include "operation-graph/OperationResults.h"
+#include "operation-graph/OperationResultsJournal.h"
 
 namespace Soup::Core
 {
@@ -20,12 +20,14 @@ namespace Soup::Core
 		/// <summary>
 		/// Execute the entire operation graph that is referenced by this build evaluate engine
 		/// Returns true if any of the operations were evaluated
+		/// The optional journal receives each updated result as soon as the operation completes
 		/// </summary>
 		virtual bool Evaluate(
 			const OperationGraph& operationGraph,
 			OperationResults& operationResults,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
-			const std::vector<Path>& globalAllowedWriteAccess) = 0;
+			const std::vector<Path>& globalAllowedWriteAccess,
+			OperationResultsJournal* operationResultsJournal) = 0;
 	};
 }
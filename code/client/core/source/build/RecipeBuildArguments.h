@@ -40,6 +40,11 @@ namespace Soup::Core
 		/// </summary>
 		bool SkipEvaluate;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to run the generate phase in process
+		/// </summary>
+		bool InProcessGenerate;
+
 		/// <summary>
 		/// Gets or sets a value indicating whether to disable monitoring
 		/// </summary>
@@ -55,6 +60,21 @@ namespace Soup::Core
 		/// </summary>
 		bool ForceRebuild;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to compare input content digests instead of write times
+		/// </summary>
+		bool UseContentDigests;
+
+		/// <summary>
+		/// Gets or sets the maximum number of operations to evaluate in parallel
+		/// </summary>
+		uint32_t MaxParallelOperations;
+
+		/// <summary>
+		/// Gets or sets the maximum number of independent packages to build in parallel
+		/// </summary>
+		uint32_t MaxParallelPackages;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
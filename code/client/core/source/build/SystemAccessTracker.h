@@ -5,18 +5,30 @@ namespace Soup::Core
 	class SystemAccessTracker : public Monitor::ISystemAccessMonitor
 	{
 	private:
+		const std::vector<std::string>& _immutableRoots;
 		int _activeProcessCount;
 		std::set<std::string> _input;
 		std::set<std::string> _inputMissing;
 		std::set<std::string> _output;
 		std::set<std::string> _deleteOnClose;
+		std::set<std::string> _immutableDirectories;
+		bool _hasImmutableInput;
 
 	public:
 		SystemAccessTracker() :
+			SystemAccessTracker(GetEmptyRoots())
+		{
+		}
+
+		SystemAccessTracker(const std::vector<std::string>& immutableRoots) :
+			_immutableRoots(immutableRoots),
 			_activeProcessCount(0),
 			_input(),
+			_inputMissing(),
 			_output(),
-			_deleteOnClose()
+			_deleteOnClose(),
+			_immutableDirectories(),
+			_hasImmutableInput(false)
 		{
 		}
 
@@ -45,6 +57,23 @@ namespace Soup::Core
 			return _output;
 		}
 
+		/// <summary>
+		/// Get a value indicating if any read under an immutable root was dropped
+		/// </summary>
+		bool HasImmutableInput() const
+		{
+			return _hasImmutableInput;
+		}
+
+		/// <summary>
+		/// Get the directories that held the dropped reads, installing or upgrading a toolchain
+		/// replaces the files in them which updates the directory write time
+		/// </summary>
+		const std::set<std::string>& GetImmutableDirectories() const
+		{
+			return _immutableDirectories;
+		}
+
 		virtual void OnCreateProcess(std::string_view applicationName, bool wasDetoured) override final
 		{
 			if (wasDetoured)
@@ -68,6 +97,17 @@ namespace Soup::Core
 				Log::Diag("TouchFileRead {}", value);
 				#endif
 
+				// Do not track the system and toolchain files individually, only the directories that contain them.
+				// A missing probe may sit under a directory that does not exist, which would never be up to date.
+				if (IsImmutable(value))
+				{
+					_hasImmutableInput = true;
+					if (exists)
+						_immutableDirectories.insert(filePath.GetParent().ToString());
+
+					return;
+				}
+
 				if (exists)
 				{
 					_input.insert(std::move(value));
@@ -135,5 +175,42 @@ namespace Soup::Core
 		{
 			Log::Warning("Search Path encountered: {} - {}", path, filename);
 		}
+
+	private:
+		bool IsImmutable(const std::string& value) const
+		{
+			for (auto& root : _immutableRoots)
+			{
+				if (IsUnderRoot(value, root))
+					return true;
+			}
+
+			return false;
+		}
+
+		static bool IsUnderRoot(const std::string& value, const std::string& root)
+		{
+		#ifdef _WIN32
+			// The file system is case insensitive
+			return value.size() >= root.size() &&
+				std::equal(
+					root.begin(),
+					root.end(),
+					value.begin(),
+					[](char lhs, char rhs)
+					{
+						return std::tolower(static_cast<unsigned char>(lhs)) ==
+							std::tolower(static_cast<unsigned char>(rhs));
+					});
+		#else
+			return value.starts_with(root);
+		#endif
+		}
+
+		static const std::vector<std::string>& GetEmptyRoots()
+		{
+			static const auto value = std::vector<std::string>();
+			return value;
+		}
 	};
 }
@@ -4,27 +4,42 @@
 
 #pragma once
 #include "ExtensionTaskDetails.h"
-#include "GenerateHost.h"
+#include "GenerateHostPool.h"
 
 namespace Soup::Core::Generate
 {
 	/// <summary>
 	/// The extension manager
 	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
 	class ExtensionManager
 	{
 	private:
+		GenerateHostPool& _hostPool;
 		std::map<std::string, ExtensionTaskDetails> _tasks;
+		std::set<Path> _loadedFiles;
 
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="ExtensionManager"/> class.
 		/// </summary>
-		ExtensionManager() :
-			_tasks()
+		ExtensionManager(GenerateHostPool& hostPool) :
+			_hostPool(hostPool),
+			_tasks(),
+			_loadedFiles()
 		{
 		}
 
+		/// <summary>
+		/// Get the files the extension hosts loaded while executing the tasks
+		/// </summary>
+		const std::set<Path>& GetLoadedFiles() const
+		{
+			return _loadedFiles;
+		}
+
 		/// <summary>
 		/// Register extension task
 		/// </summary>
@@ -110,9 +125,9 @@ namespace Soup::Core::Generate
 				if (currentTask == nullptr)
 					throw std::runtime_error("TryFindNextTask returned empty result");
 
-				// Create a Wren Host to evaluate the extension task
-				auto host = std::make_unique<GenerateHost>(currentTask->ScriptFile, currentTask->BundlesFile);
-				host->InterpretMain();
+				// Reuse the warm Wren Host that already interpreted the script during discovery
+				// Note: a host that fails a task is dropped and never returned to the pool
+				auto host = _hostPool.Acquire(currentTask->ScriptFile, currentTask->BundlesFile);
 
 				// Set the current state AFTER we initialize to prevent pre-loading
 				host->SetState(state);
@@ -127,6 +142,12 @@ namespace Soup::Core::Generate
 				auto updatedActiveState = host->GetUpdatedActiveState();
 				auto updatedSharedState = host->GetUpdatedSharedState();
 
+				// Clear the cached state before the host is handed to the next task
+				host->ResetState();
+				auto& loadedFiles = host->GetLoadedFiles();
+				_loadedFiles.insert(loadedFiles.begin(), loadedFiles.end());
+				_hostPool.Release(std::move(host));
+
 				auto runBeforeList = ValueList();
 				for (const auto& value : currentTask->RunBeforeList)
 					runBeforeList.push_back(Value(value));
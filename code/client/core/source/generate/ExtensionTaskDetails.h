@@ -6,6 +6,9 @@
 
 namespace Soup::Core::Generate
 {
+	#ifdef SOUP_BUILD
+	export
+	#endif
 	class ExtensionTaskDetails
 	{
 	public:
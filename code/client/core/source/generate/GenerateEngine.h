@@ -4,27 +4,74 @@
 
 #pragma once
 #include "ExtensionManager.h"
+#include "GenerateHostPool.h"
 #include "GenerateState.h"
+#include "build/BuildConstants.h"
+#include "build/MacroManager.h"
+#include "local-user-config/LocalUserConfigExtensions.h"
+#include "operation-graph/OperationGraphManager.h"
+#include "recipe/RecipeBuildStateConverter.h"
+#include "recipe/RecipeExtensions.h"
+#include "value-table/ValueTableManager.h"
 
 namespace Soup::Core::Generate
 {
+	/// <summary>
+	/// The generate engine that runs the build extensions for a single package, either from the
+	/// standalone generate executable or in process with the build runner
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
 	class GenerateEngine
 	{
 	private:
-		FileSystemState _fileSystemState;
+		FileSystemState& _fileSystemState;
+		GenerateHostPool& _hostPool;
+
+		// The files read and written during the last run
+		std::vector<Path> _readFiles;
+		std::vector<Path> _writeFiles;
+
 	public:
-		GenerateEngine() :
-			_fileSystemState()
+		GenerateEngine(FileSystemState& fileSystemState, GenerateHostPool& hostPool) :
+			_fileSystemState(fileSystemState),
+			_hostPool(hostPool),
+			_readFiles(),
+			_writeFiles()
+		{
+		}
+
+		/// <summary>
+		/// Get the files read during the last run, these are the inputs of the generate phase
+		/// </summary>
+		const std::vector<Path>& GetReadFiles() const
+		{
+			return _readFiles;
+		}
+
+		/// <summary>
+		/// Get the files written during the last run
+		/// </summary>
+		const std::vector<Path>& GetWriteFiles() const
 		{
+			return _writeFiles;
 		}
 
-		void Run(const Path& soupTargetDirectory)
+		/// <summary>
+		/// Generate the evaluate operation graph for the package, the graph is saved alongside
+		/// the shared state and also returned so an in-process caller does not have to load it again
+		/// </summary>
+		OperationGraph Run(const Path& soupTargetDirectory)
 		{
 			// Run all build operations in the correct order with incremental build checks
 			Log::Diag("Build generate start: {}", soupTargetDirectory.ToString());
+			_readFiles.clear();
+			_writeFiles.clear();
 
 			// Load the input file
 			auto inputFile = soupTargetDirectory + BuildConstants::GenerateInputFileName();
+			_readFiles.push_back(inputFile);
 			auto inputTable = ValueTable();
 			if (!ValueTableManager::TryLoadState(inputFile, inputTable))
 			{
@@ -38,10 +85,12 @@ namespace Soup::Core::Generate
 			// Load the local user config and any sdk content
 			auto sdkParameters = ValueList();
 			auto sdkReadAccess = std::vector<Path>();
+			_readFiles.push_back(userDataPath + BuildConstants::LocalUserConfigFileName());
 			LoadLocalUserConfig(userDataPath, sdkParameters, sdkReadAccess);
 
 			// Load the recipe file
 			auto recipeFile = packageRoot + BuildConstants::RecipeFileName();
+			_readFiles.push_back(recipeFile);
 			Recipe recipe;
 			if (!RecipeExtensions::TryLoadRecipeFromFile(recipeFile, recipe))
 			{
@@ -123,7 +172,7 @@ namespace Soup::Core::Generate
 			}
 
 			// Create a new build system for the requested build
-			auto extensionManager = ExtensionManager();
+			auto extensionManager = ExtensionManager(_hostPool);
 
 			// Run all build extension register callbacks
 			for (auto buildExtension : buildExtensionLibraries)
@@ -134,15 +183,18 @@ namespace Soup::Core::Generate
 					Log::Info("Bundles: {}", buildExtension.second.value().ToString());
 				}
 
-				// Create a temporary Wren Host to discover all build extensions
-				auto host = std::make_unique<GenerateHost>(buildExtension.first, buildExtension.second);
-				host->InterpretMain();
+				// Use a warm Wren Host to discover all build extensions
+				auto host = _hostPool.Acquire(buildExtension.first, buildExtension.second);
 				auto extensions = host->DiscoverExtensions();
 
 				for (auto& extension : extensions)
 				{
 					extensionManager.RegisterExtensionTask(std::move(extension));
 				}
+
+				auto& loadedFiles = host->GetLoadedFiles();
+				_readFiles.insert(_readFiles.end(), loadedFiles.begin(), loadedFiles.end());
+				_hostPool.Release(std::move(host));
 			}
 
 			// Evaluate the build extensions
@@ -153,6 +205,10 @@ namespace Soup::Core::Generate
 				evaluateAllowedWriteAccess);
 			extensionManager.Execute(buildState);
 
+			// Modules imported while running a task are inputs as well
+			auto& taskLoadedFiles = extensionManager.GetLoadedFiles();
+			_readFiles.insert(_readFiles.end(), taskLoadedFiles.begin(), taskLoadedFiles.end());
+
 			// Grab the build results
 			auto generateInfoTable = buildState.GetGenerateInfo();
 			auto evaluateGraph = buildState.BuildOperationGraph();
@@ -162,20 +218,28 @@ namespace Soup::Core::Generate
 			auto generateInfoStateFile = soupTargetDirectory + BuildConstants::GenerateInfoFileName();
 			Log::Info("Save Generate Info State: {}", generateInfoStateFile.ToString());
 			ValueTableManager::SaveState(generateInfoStateFile, generateInfoTable);
+			_writeFiles.push_back(std::move(generateInfoStateFile));
 
 			// Resolve macros before saving evaluate graph
 			Log::Diag("Resolve build macros in evaluate graph");
 			ResolveMacros(evaluateMacroManager, evaluateGraph);
 
+			// The commands were resolved in place so the lookup must be rebuilt on next use
+			evaluateGraph.InvalidateOperationLookup();
+
 			// Save the operation graph so the evaluate phase can load it
 			auto evaluateGraphFile = soupTargetDirectory + BuildConstants::EvaluateGraphFileName();
 			OperationGraphManager::SaveState(evaluateGraphFile, evaluateGraph, _fileSystemState);
+			_writeFiles.push_back(std::move(evaluateGraphFile));
 
 			// Save the shared state that is to be passed to the downstream builds
 			auto sharedStateFile = soupTargetDirectory + BuildConstants::GenerateSharedStateFileName();
 			ValueTableManager::SaveState(sharedStateFile, sharedState);
+			_writeFiles.push_back(std::move(sharedStateFile));
 
 			Log::Diag("Build generate end");
+
+			return evaluateGraph;
 		}
 
 	private:
@@ -231,7 +295,7 @@ namespace Soup::Core::Generate
 		/// Using the parameters to resolve the dependency output folders, load up the shared state table and
 		/// combine them into a single value table to be used as input the this generate phase.
 		/// </summary>
-		static ValueTable LoadDependenciesSharedState(
+		ValueTable LoadDependenciesSharedState(
 			MacroManager& generateSubGraphMacroManager,
 			const ValueTable& inputTable)
 		{
@@ -256,6 +320,7 @@ namespace Soup::Core::Generate
 						auto& dependency = dependencyValue.AsTable();
 						auto soupTargetDirectory = Path(dependency.at("SoupTargetDirectory").AsString());
 						auto sharedStateFile = soupTargetDirectory + BuildConstants::GenerateSharedStateFileName();
+						_readFiles.push_back(sharedStateFile);
 
 						// Load the shared state file
 						auto sharedStateTable = ValueTable();
@@ -398,6 +463,8 @@ namespace Soup::Core::Generate
 			MacroManager& macroManager,
 			OperationGraph& operationGraph)
 		{
+			// Resolve each shared access set once and keep the original alive so the address is never reused
+			auto resolvedAccessSets = std::unordered_map<const std::vector<FileId>*, std::pair<AccessSet, AccessSet>>();
 			for (auto& [operationId, operation] : operationGraph.GetOperations())
 			{
 				ResolveMacros(macroManager, operation.Command.Arguments);
@@ -405,11 +472,28 @@ namespace Soup::Core::Generate
 				operation.Command.Executable = macroManager.ResolveMacros(std::move(operation.Command.Executable));
 				ResolveMacros(macroManager, operation.DeclaredInput);
 				ResolveMacros(macroManager, operation.DeclaredOutput);
-				ResolveMacros(macroManager, operation.ReadAccess);
-				ResolveMacros(macroManager, operation.WriteAccess);
+				operation.ReadAccess = ResolveMacros(macroManager, operation.ReadAccess, resolvedAccessSets);
+				operation.WriteAccess = ResolveMacros(macroManager, operation.WriteAccess, resolvedAccessSets);
 			}
 		}
 
+		AccessSet ResolveMacros(
+			MacroManager& macroManager,
+			const AccessSet& value,
+			std::unordered_map<const std::vector<FileId>*, std::pair<AccessSet, AccessSet>>& resolvedAccessSets)
+		{
+			auto findResult = resolvedAccessSets.find(&value.GetFiles());
+			if (findResult != resolvedAccessSets.end())
+				return findResult->second.second;
+
+			auto files = value.GetFiles();
+			ResolveMacros(macroManager, files);
+			auto resolvedValue = AccessSet(std::move(files));
+			resolvedAccessSets.emplace(&value.GetFiles(), std::make_pair(value, resolvedValue));
+
+			return resolvedValue;
+		}
+
 		void ResolveMacros(MacroManager& macroManager, std::vector<std::string>& value)
 		{
 			for(size_t i = 0; i < value.size(); i++)
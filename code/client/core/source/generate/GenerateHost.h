@@ -0,0 +1,1110 @@
+#pragma once
+
+#include "ExtensionTaskDetails.h"
+#include "GenerateState.h"
+#include "wren/WrenHost.h"
+#include "wren/WrenValueTable.h"
+
+namespace Soup::Core::Generate
+{
+	/// <summary>
+	/// The Wren host that runs the build extension tasks. A host interprets its script once and runs every
+	/// task from it, only the Soup state is reset between tasks. Tasks must keep their state in the Soup
+	/// state tables: a task that assigns a module level variable fails, because the next task on the same
+	/// host would see the new value.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class GenerateHost : public WrenHost
+	{
+	private:
+		static inline const char* SoupModuleName = "soup";
+		static inline const char* SoupClassName = "Soup";
+		static inline const char* SoupTaskClassName = "SoupTask";
+
+		static inline const char* StateTableReferenceClassName = "StateTableReference";
+
+	private:
+		/// <summary>
+		/// The foreign data behind a Wren state table, a view into a table owned by the current state.
+		/// The generation invalidates any reference a script kept after the state was replaced.
+		/// </summary>
+		struct StateTableReference
+		{
+			const ValueTable* Table;
+			uint64_t Generation;
+		};
+
+	private:
+		GenerateState* _state;
+		uint64_t _stateGeneration;
+
+		// The values of the script module variables before the first task ran
+		std::vector<WrenHandle*> _moduleVariables;
+
+	public:
+		GenerateHost(Path scriptFile, std::optional<Path> bundlesFile) :
+			WrenHost(std::move(scriptFile), std::move(bundlesFile)),
+			_state(nullptr),
+			_stateGeneration(0),
+			_moduleVariables()
+		{
+		}
+
+		~GenerateHost()
+		{
+			// Handles must be released before the base frees the virtual machine
+			for (auto handle : _moduleVariables)
+				wrenReleaseHandle(_vm, handle);
+		}
+
+		void SetState(GenerateState& state)
+		{
+			_state = &state;
+			_stateGeneration++;
+		}
+
+		/// <summary>
+		/// Detach the state and drop the tables the soup module cached from it so the next task
+		/// loads its own state when the host is reused
+		/// </summary>
+		void ResetState()
+		{
+			_state = nullptr;
+			_stateGeneration++;
+
+			// Nothing is cached until the script has imported the soup module
+			if (!wrenHasModule(_vm, SoupModuleName))
+				return;
+
+			wrenEnsureSlots(_vm, 1);
+			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
+
+			auto soupClassType = wrenGetSlotType(_vm, 0);
+			if (soupClassType != WREN_TYPE_UNKNOWN) {
+				throw std::runtime_error("Missing Class Soup");
+			}
+
+			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Call Reset
+			auto resetMethodHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "reset_()"));
+			wrenSetSlotHandle(_vm, 0, soupClassHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, resetMethodHandle));
+		}
+
+		std::vector<ExtensionTaskDetails> DiscoverExtensions()
+		{
+			auto extensions = std::vector<ExtensionTaskDetails>();
+
+			// Discover all class types
+			wrenEnsureSlots(_vm, 1);
+			auto variableCount = wrenGetVariableCount(_vm, _scriptFile.ToString().c_str());
+			for (auto i = 0; i < variableCount; i++)
+			{
+				wrenGetVariableAt(_vm, _scriptFile.ToString().c_str(), i, 0);
+
+				// Check if a class
+				auto type = wrenGetSlotType(_vm, 0);
+				if (type == WREN_TYPE_UNKNOWN)
+				{
+					auto classHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+					if (WrenHelpers::HasParentType(_vm, classHandle, SoupTaskClassName))
+					{
+						Log::Diag("Found Build Task");
+						auto className = WrenHelpers::GetClassName(_vm, classHandle);
+						auto runBeforeList = CallRunBeforeGetter(classHandle);
+						auto runAfterList = CallRunAfterGetter(classHandle);
+
+						extensions.push_back(
+							ExtensionTaskDetails(
+								std::move(className),
+								_scriptFile,
+								_bundlesFile,
+								std::move(runBeforeList),
+								std::move(runAfterList)));
+					}
+				}
+			}
+
+			return extensions;
+		}
+
+		void EvaluateTask(const std::string& className)
+		{
+			// Load up the class
+			wrenEnsureSlots(_vm, 1);
+			wrenGetVariable(_vm, _scriptFile.ToString().c_str(), className.c_str(), 0);
+
+			// Check if a class
+			auto type = wrenGetSlotType(_vm, 0);
+			if (type != WREN_TYPE_UNKNOWN) {
+				throw std::runtime_error("Extension class name was not a class");
+			}
+
+			auto classHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Capture the module before any task can change it
+			if (_moduleVariables.empty())
+				SnapshotModuleVariables();
+
+			// Call Evaluate
+			auto evaluateMethodHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "evaluate()"));
+
+			wrenSetSlotHandle(_vm, 0, classHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, evaluateMethodHandle));
+
+			VerifyModuleVariables(className);
+		}
+
+		ValueTable GetUpdatedActiveState()
+		{
+			Log::Diag("GetUpdatedActiveState");
+			if (_state == nullptr)
+				throw std::runtime_error("Cannot get the updated ActiveState at this time");
+
+			wrenEnsureSlots(_vm, 1);
+			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
+
+			auto soupClassType = wrenGetSlotType(_vm, 0);
+			if (soupClassType != WREN_TYPE_UNKNOWN) {
+				throw std::runtime_error("Missing Class Soup");
+			}
+
+			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Call ActiveStateChanges
+			auto activeStateChangesGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "activeStateChanges_"));
+			wrenSetSlotHandle(_vm, 0, soupClassHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, activeStateChangesGetterHandle));
+
+			try
+			{
+				// Only the entries the task modified are converted back from Wren
+				auto result = _state->GetActiveState();
+				WrenValueTable::ApplySlotTableChanges(_vm, 0, result);
+				return result;
+			}
+			catch(const InvalidTypeException& exception)
+			{
+				// Unwrap the type error
+				auto stringBuilder = std::stringstream();
+				stringBuilder << "Invalid type in ActiveState:" << exception.what();
+				throw std::runtime_error(stringBuilder.str());
+			}
+		}
+
+		ValueTable GetUpdatedSharedState()
+		{
+			Log::Diag("GetUpdatedSharedState");
+			if (_state == nullptr)
+				throw std::runtime_error("Cannot get the updated SharedState at this time");
+
+			wrenEnsureSlots(_vm, 1);
+			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
+
+			auto soupClassType = wrenGetSlotType(_vm, 0);
+			if (soupClassType != WREN_TYPE_UNKNOWN) {
+				throw std::runtime_error("Missing Class Soup");
+			}
+
+			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Call SharedStateChanges
+			auto sharedStateChangesGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "sharedStateChanges_"));
+			wrenSetSlotHandle(_vm, 0, soupClassHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, sharedStateChangesGetterHandle));
+
+			try
+			{
+				// Only the entries the task modified are converted back from Wren
+				auto result = _state->GetSharedState();
+				WrenValueTable::ApplySlotTableChanges(_vm, 0, result);
+				return result;
+			}
+			catch(const InvalidTypeException& exception)
+			{
+				// Unwrap the type error
+				auto stringBuilder = std::stringstream();
+				stringBuilder << "Invalid type in SharedState:" << exception.what();
+				throw std::runtime_error(stringBuilder.str());
+			}
+		}
+
+	private:
+		virtual bool IsBuiltInModule(std::string_view moduleName) override final
+		{
+			if (moduleName == std::string_view(SoupModuleName))
+			{
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		virtual bool TryGetBuiltInModule(std::string_view moduleName, const char*& source) override final
+		{
+			// Inject Soup module
+			if (moduleName == SoupModuleName)
+			{
+				source = GetSoupModuleSource();
+				return true;
+			}
+			else
+			{
+				source = nullptr;
+				return false;
+			}
+		}
+
+		virtual WrenForeignMethodFn TryBindForeignMethod(
+			std::string_view moduleName,
+			std::string_view className,
+			bool isStatic,
+			std::string_view signature) override final
+		{
+			if (moduleName == SoupModuleName)
+			{
+				if (className == StateTableReferenceClassName && !isStatic)
+				{
+					if (signature == "keys")
+						return StateTableKeys;
+					else if (signature == "[_]")
+						return StateTableGet;
+					else if (signature == "containsKey(_)")
+						return StateTableContainsKey;
+					else if (signature == "isUnchanged_(_,_)")
+						return StateTableIsUnchanged;
+				}
+				else if (className == SoupClassName && isStatic)
+				{
+					if (signature == "loadGlobalState_()")
+						return SoupLoadGlobalState;
+					else if (signature == "loadActiveState_()")
+						return SoupLoadActiveState;
+					else if (signature == "loadSharedState_()")
+						return SoupLoadSharedState;
+					else if (signature == "createOperation_(_,_,_,_,_,_)")
+						return SoupCreateOperation;
+					else if (signature == "createOperations_(_,_,_,_,_)")
+						return SoupCreateOperations;
+					else if (signature == "info_(_)")
+						return SoupLogInfo;
+					else if (signature == "warning_(_)")
+						return SoupLogWarning;
+					else if (signature == "error_(_)")
+						return SoupLogError;
+				}
+			}
+
+			return nullptr;
+		}
+
+		virtual WrenForeignClassMethods TryBindForeignClass(
+			std::string_view moduleName,
+			std::string_view className) override final
+		{
+			if (moduleName == SoupModuleName && className == StateTableReferenceClassName)
+				return WrenForeignClassMethods({ AllocateStateTableReference, nullptr });
+
+			return WrenForeignClassMethods({ nullptr, nullptr });
+		}
+
+		void SnapshotModuleVariables()
+		{
+			auto moduleName = _scriptFile.ToString();
+			auto variableCount = wrenGetVariableCount(_vm, moduleName.c_str());
+
+			wrenEnsureSlots(_vm, 1);
+			_moduleVariables.reserve(variableCount);
+			for (auto i = 0; i < variableCount; i++)
+			{
+				wrenGetVariableAt(_vm, moduleName.c_str(), i, 0);
+				_moduleVariables.push_back(wrenGetSlotHandle(_vm, 0));
+			}
+		}
+
+		/// <summary>
+		/// Ensure the task did not assign a module level variable that would leak into the next task on this host.
+		/// A container that is changed in place still holds the same object and cannot be detected.
+		/// </summary>
+		void VerifyModuleVariables(std::string_view className)
+		{
+			auto moduleName = _scriptFile.ToString();
+			auto variableCount = wrenGetVariableCount(_vm, moduleName.c_str());
+			if (variableCount != static_cast<int>(_moduleVariables.size()))
+				ThrowModuleStateChanged(className);
+
+			auto sameMethodHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "same(_,_)"));
+
+			wrenEnsureSlots(_vm, 3);
+			for (auto i = 0; i < variableCount; i++)
+			{
+				// Compare identity with Object.same
+				wrenGetVariable(_vm, moduleName.c_str(), "Object", 0);
+				wrenSetSlotHandle(_vm, 1, _moduleVariables[i]);
+				wrenGetVariableAt(_vm, moduleName.c_str(), i, 2);
+				WrenHelpers::ThrowIfFailed(wrenCall(_vm, sameMethodHandle));
+
+				if (!wrenGetSlotBool(_vm, 0))
+					ThrowModuleStateChanged(className);
+			}
+		}
+
+		[[noreturn]] static void ThrowModuleStateChanged(std::string_view className)
+		{
+			throw std::runtime_error(
+				std::format(
+					"Task {0} assigned a module level variable, build tasks must keep their state in the Soup state tables",
+					className));
+		}
+
+		std::vector<std::string> CallRunBeforeGetter(WrenHandle* classHandle)
+		{
+			// Call RunBefore
+			auto runBeforeGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "runBefore"));
+
+			wrenSetSlotHandle(_vm, 0, classHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, runBeforeGetterHandle));
+
+			return WrenHelpers::GetSlotStringList(_vm, 0, 1);
+		}
+
+		std::vector<std::string> CallRunAfterGetter(WrenHandle* classHandle)
+		{
+			// Call RunAfter
+			auto runBeforeGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "runAfter"));
+
+			wrenSetSlotHandle(_vm, 0, classHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, runBeforeGetterHandle));
+
+			return WrenHelpers::GetSlotStringList(_vm, 0, 1);
+		}
+
+		void SoupLoadGlobalState()
+		{
+			try
+			{
+				Log::Diag("SoupLoadGlobalState");
+				if (_state == nullptr)
+					throw std::runtime_error("Cannot load GlobalState at this time");
+
+				SetSlotStateTableReference(0, _state->GetGlobalState());
+			}
+			catch(const std::exception& ex)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, ex.what());
+			}
+		}
+
+		void SoupLoadActiveState()
+		{
+			try
+			{
+				Log::Diag("SoupLoadActiveState");
+				if (_state == nullptr)
+					throw std::runtime_error("Cannot load ActiveState at this time");
+
+				SetSlotStateTableReference(0, _state->GetActiveState());
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		void SoupLoadSharedState()
+		{
+			try
+			{
+				Log::Diag("SoupLoadSharedState");
+				if (_state == nullptr)
+					throw std::runtime_error("Cannot load SharedState at this time");
+
+				SetSlotStateTableReference(0, _state->GetSharedState());
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		void SoupCreateOperation()
+		{
+			try
+			{
+				Log::Diag("SoupCreateOperation");
+				if (_state == nullptr)
+					throw std::runtime_error("Cannot CreateOperation at this time");
+
+				auto parameter1 = wrenGetSlotType(_vm, 1);
+				if (parameter1 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperation parameter 1 must be of type string");
+				}
+				auto title = std::string(wrenGetSlotString(_vm, 1));
+
+				auto parameter2 = wrenGetSlotType(_vm, 2);
+				if (parameter2 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperation parameter 2 must be of type string");
+				}
+				auto executable = std::string(wrenGetSlotString(_vm, 2));
+
+				auto parameter3 = wrenGetSlotType(_vm, 3);
+				if (parameter3 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperation parameter 3 must be of type list");
+				}
+				auto arguments = WrenHelpers::GetSlotStringList(_vm, 3, 7);
+				
+				auto parameter4 = wrenGetSlotType(_vm, 4);
+				if (parameter4 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperation parameter 4 must be of type string");
+				}
+				auto workingDirectory = std::string(wrenGetSlotString(_vm, 4));
+
+				auto parameter5 = wrenGetSlotType(_vm, 5);
+				if (parameter5 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperation parameter 5 must be of type list");
+				}
+				auto declaredInput = WrenHelpers::GetSlotStringList(_vm, 5, 7);
+
+				auto parameter6 = wrenGetSlotType(_vm, 6);
+				if (parameter6 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperation parameter 6 must be of type list");
+				}
+				auto declaredOutput = WrenHelpers::GetSlotStringList(_vm, 6, 7);
+
+				_state->CreateOperation(
+					std::move(title),
+					std::move(executable),
+					std::move(arguments),
+					std::move(workingDirectory),
+					std::move(declaredInput),
+					std::move(declaredOutput));
+
+				// No return value
+				wrenEnsureSlots(_vm, 1);
+				wrenSetSlotNull(_vm, 0);
+			}
+			catch(const std::exception& ex)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, ex.what());
+			}
+		}
+
+		void SetSlotStateTableReference(int slot, const ValueTable& table)
+		{
+			// Use the slot above the result to hold the foreign class
+			wrenEnsureSlots(_vm, slot + 2);
+			wrenGetVariable(_vm, SoupModuleName, StateTableReferenceClassName, slot + 1);
+			auto reference = (StateTableReference*)wrenSetSlotNewForeign(_vm, slot, slot + 1, sizeof(StateTableReference));
+			reference->Table = &table;
+			reference->Generation = _stateGeneration;
+		}
+
+		const ValueTable& GetSlotStateTableReference(int slot)
+		{
+			auto reference = (StateTableReference*)wrenGetSlotForeign(_vm, slot);
+			if (_state == nullptr || reference->Table == nullptr || reference->Generation != _stateGeneration)
+				throw std::runtime_error("State table is no longer available");
+
+			return *reference->Table;
+		}
+
+		void StateTableKeys()
+		{
+			try
+			{
+				auto& table = GetSlotStateTableReference(0);
+
+				wrenEnsureSlots(_vm, 2);
+				wrenSetSlotNewList(_vm, 0);
+				for (const auto& [key, value] : table)
+				{
+					wrenSetSlotString(_vm, 1, key.c_str());
+					wrenInsertInList(_vm, 0, -1, 1);
+				}
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		void StateTableGet()
+		{
+			try
+			{
+				auto& table = GetSlotStateTableReference(0);
+
+				if (wrenGetSlotType(_vm, 1) != WREN_TYPE_STRING) {
+					throw std::runtime_error("State table key must be of type string");
+				}
+
+				auto findResult = table.find(std::string(wrenGetSlotString(_vm, 1)));
+				if (findResult == table.end())
+				{
+					// Values are never null so null marks a missing key
+					wrenSetSlotNull(_vm, 0);
+				}
+				else if (findResult->second.GetType() == ValueType::Table)
+				{
+					// Nested tables stay behind a reference until they are accessed
+					SetSlotStateTableReference(0, findResult->second.AsTable());
+				}
+				else
+				{
+					WrenValueTable::SetSlotValue(_vm, 0, findResult->second);
+				}
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		void StateTableContainsKey()
+		{
+			try
+			{
+				auto& table = GetSlotStateTableReference(0);
+
+				if (wrenGetSlotType(_vm, 1) != WREN_TYPE_STRING) {
+					throw std::runtime_error("State table key must be of type string");
+				}
+
+				auto result = table.contains(std::string(wrenGetSlotString(_vm, 1)));
+				wrenSetSlotBool(_vm, 0, result);
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		void StateTableIsUnchanged()
+		{
+			try
+			{
+				auto& table = GetSlotStateTableReference(0);
+
+				if (wrenGetSlotType(_vm, 1) != WREN_TYPE_STRING) {
+					throw std::runtime_error("State table key must be of type string");
+				}
+
+				auto findResult = table.find(std::string(wrenGetSlotString(_vm, 1)));
+				auto result = findResult != table.end() && IsSlotValueEqual(2, findResult->second);
+				wrenSetSlotBool(_vm, 0, result);
+			}
+			catch(const std::exception& exception)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+			}
+		}
+
+		/// <summary>
+		/// Compare a Wren value against the original state value, using the slots above it for the items.
+		/// Any type that does not round trip from the state is treated as a change.
+		/// </summary>
+		bool IsSlotValueEqual(int slot, const Value& value)
+		{
+			switch (wrenGetSlotType(_vm, slot))
+			{
+				case WREN_TYPE_BOOL:
+					return value.GetType() == ValueType::Boolean &&
+						value.AsBoolean() == wrenGetSlotBool(_vm, slot);
+				case WREN_TYPE_NUM:
+					if (value.GetType() == ValueType::Integer)
+						return static_cast<double>(value.AsInteger()) == wrenGetSlotDouble(_vm, slot);
+					else if (value.GetType() == ValueType::Float)
+						return value.AsFloat() == wrenGetSlotDouble(_vm, slot);
+					else
+						return false;
+				case WREN_TYPE_STRING:
+					return value.GetType() == ValueType::String &&
+						value.AsString() == wrenGetSlotString(_vm, slot);
+				case WREN_TYPE_LIST:
+				{
+					if (value.GetType() != ValueType::List)
+						return false;
+
+					auto& list = value.AsList();
+					auto count = wrenGetListCount(_vm, slot);
+					if (static_cast<size_t>(count) != list.size())
+						return false;
+
+					wrenEnsureSlots(_vm, slot + 2);
+					for (auto i = 0; i < count; i++)
+					{
+						wrenGetListElement(_vm, slot, i, slot + 1);
+						if (!IsSlotValueEqual(slot + 1, list[i]))
+							return false;
+					}
+
+					return true;
+				}
+				case WREN_TYPE_MAP:
+				{
+					if (value.GetType() != ValueType::Table)
+						return false;
+
+					auto& table = value.AsTable();
+					if (static_cast<size_t>(wrenGetMapCount(_vm, slot)) != table.size())
+						return false;
+
+					wrenEnsureSlots(_vm, slot + 3);
+					for (const auto& [key, item] : table)
+					{
+						wrenSetSlotString(_vm, slot + 1, key.c_str());
+						if (!wrenGetMapContainsKey(_vm, slot, slot + 1))
+							return false;
+
+						wrenGetMapValue(_vm, slot, slot + 1, slot + 2);
+						if (!IsSlotValueEqual(slot + 2, item))
+							return false;
+					}
+
+					return true;
+				}
+				default:
+					return false;
+			}
+		}
+
+		void SoupCreateOperations()
+		{
+			try
+			{
+				Log::Diag("SoupCreateOperations");
+				if (_state == nullptr)
+					throw std::runtime_error("Cannot CreateOperations at this time");
+
+				auto parameter1 = wrenGetSlotType(_vm, 1);
+				if (parameter1 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperations parameter 1 must be of type string");
+				}
+				auto executable = std::string(wrenGetSlotString(_vm, 1));
+
+				auto parameter2 = wrenGetSlotType(_vm, 2);
+				if (parameter2 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperations parameter 2 must be of type string");
+				}
+				auto workingDirectory = std::string(wrenGetSlotString(_vm, 2));
+
+				auto parameter3 = wrenGetSlotType(_vm, 3);
+				if (parameter3 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperations parameter 3 must be of type list");
+				}
+				auto commonArguments = WrenHelpers::GetSlotStringList(_vm, 3, 9);
+
+				auto parameter4 = wrenGetSlotType(_vm, 4);
+				if (parameter4 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperations parameter 4 must be of type list");
+				}
+				auto commonInput = WrenHelpers::GetSlotStringList(_vm, 4, 9);
+
+				auto parameter5 = wrenGetSlotType(_vm, 5);
+				if (parameter5 != WREN_TYPE_LIST) {
+					throw std::runtime_error("SoupCreateOperations parameter 5 must be of type list");
+				}
+
+				// Each operation is a map with a required Title and optional Arguments, DeclaredInput and DeclaredOutput
+				wrenEnsureSlots(_vm, 10);
+				auto operationCount = wrenGetListCount(_vm, 5);
+				auto operations = std::vector<OperationBatchEntry>();
+				operations.reserve(operationCount);
+				for (auto i = 0; i < operationCount; i++)
+				{
+					wrenGetListElement(_vm, 5, i, 6);
+					if (wrenGetSlotType(_vm, 6) != WREN_TYPE_MAP) {
+						throw std::runtime_error(std::format("SoupCreateOperations operation {} must be of type map", i));
+					}
+
+					auto operation = OperationBatchEntry();
+					if (!TryGetMapValue(6, "Title", 7, 8) || wrenGetSlotType(_vm, 8) != WREN_TYPE_STRING) {
+						throw std::runtime_error(std::format("SoupCreateOperations operation {} Title must be of type string", i));
+					}
+					operation.Title = std::string(wrenGetSlotString(_vm, 8));
+
+					if (TryGetMapValue(6, "Arguments", 7, 8))
+						operation.Arguments = WrenHelpers::GetSlotStringList(_vm, 8, 9);
+
+					if (TryGetMapValue(6, "DeclaredInput", 7, 8))
+					{
+						for (auto& value : WrenHelpers::GetSlotStringList(_vm, 8, 9))
+							operation.DeclaredInput.push_back(Path(std::move(value)));
+					}
+
+					if (TryGetMapValue(6, "DeclaredOutput", 7, 8))
+					{
+						for (auto& value : WrenHelpers::GetSlotStringList(_vm, 8, 9))
+							operation.DeclaredOutput.push_back(Path(std::move(value)));
+					}
+
+					operations.push_back(std::move(operation));
+				}
+
+				_state->CreateOperations(
+					std::move(executable),
+					std::move(workingDirectory),
+					std::move(commonArguments),
+					std::move(commonInput),
+					std::move(operations));
+
+				// No return value
+				wrenEnsureSlots(_vm, 1);
+				wrenSetSlotNull(_vm, 0);
+			}
+			catch(const std::exception& ex)
+			{
+				WrenHelpers::GenerateRuntimeError(_vm, ex.what());
+			}
+		}
+
+		bool TryGetMapValue(int mapSlot, const char* key, int keySlot, int valueSlot)
+		{
+			wrenSetSlotString(_vm, keySlot, key);
+			if (!wrenGetMapContainsKey(_vm, mapSlot, keySlot))
+				return false;
+
+			wrenGetMapValue(_vm, mapSlot, keySlot, valueSlot);
+			return true;
+		}
+
+		void SoupLogInfo()
+		{
+			auto message = wrenGetSlotString(_vm, 1);
+			Log::Info(message);
+			wrenSetSlotNull(_vm, 0);
+		}
+
+		void SoupLogWarning()
+		{
+			auto message = wrenGetSlotString(_vm, 1);
+			Log::Warning(message);
+			wrenSetSlotNull(_vm, 0);
+		}
+
+		void SoupLogError()
+		{
+			auto message = wrenGetSlotString(_vm, 1);
+			Log::Error(message);
+			wrenSetSlotNull(_vm, 0);
+		}
+
+		static void SoupLoadGlobalState(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLoadGlobalState();
+		}
+
+		static void SoupLoadActiveState(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLoadActiveState();
+		}
+
+		static void SoupLoadSharedState(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLoadSharedState();
+		}
+
+		static void SoupCreateOperation(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupCreateOperation();
+		}
+
+		static void AllocateStateTableReference(WrenVM* vm)
+		{
+			// References are only created by the host, one constructed from a script has no table
+			auto reference = (StateTableReference*)wrenSetSlotNewForeign(vm, 0, 0, sizeof(StateTableReference));
+			reference->Table = nullptr;
+			reference->Generation = 0;
+		}
+
+		static void StateTableKeys(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->StateTableKeys();
+		}
+
+		static void StateTableGet(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->StateTableGet();
+		}
+
+		static void StateTableContainsKey(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->StateTableContainsKey();
+		}
+
+		static void StateTableIsUnchanged(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->StateTableIsUnchanged();
+		}
+
+		static void SoupCreateOperations(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupCreateOperations();
+		}
+
+		static void SoupLogInfo(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLogInfo();
+		}
+
+		static void SoupLogWarning(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLogWarning();
+		}
+
+		static void SoupLogError(WrenVM* vm)
+		{
+			auto host = (GenerateHost*)wrenGetUserData(vm);
+			host->SoupLogError();
+		}
+
+		static const char* GetSoupModuleSource()
+		{
+			return soupModuleSource.c_str();
+		}
+
+	public:
+		/// <summary>
+		/// The Wren state table class, written against a StateTableReference class with keys, [key], containsKey(key)
+		/// and isUnchanged_(key, value) that each host provides over its own state
+		/// </summary>
+		static inline const char* StateTableSource =
+			"class StateTable is Sequence {\n"
+			"	construct new_(reference) {\n"
+			"		_reference = reference\n"
+			"		_values = {}\n"
+			"		_assigned = {}\n"
+			"		_removed = {}\n"
+			"	}\n"
+			"\n"
+			"	[key] {\n"
+			"		if (_values.containsKey(key)) return _values[key]\n"
+			"		if (_removed.containsKey(key)) return null\n"
+			"		var value = _reference[key]\n"
+			"		if (value is StateTableReference) value = StateTable.new_(value)\n"
+			"		if (value != null) _values[key] = value\n"
+			"		return value\n"
+			"	}\n"
+			"\n"
+			"	[key]=(value) {\n"
+			"		_values[key] = value\n"
+			"		_assigned[key] = true\n"
+			"		_removed.remove(key)\n"
+			"	}\n"
+			"\n"
+			"	containsKey(key) {\n"
+			"		if (_values.containsKey(key)) return true\n"
+			"		if (_removed.containsKey(key)) return false\n"
+			"		return _reference.containsKey(key)\n"
+			"	}\n"
+			"\n"
+			"	remove(key) {\n"
+			"		var value = this[key]\n"
+			"		_values.remove(key)\n"
+			"		_assigned.remove(key)\n"
+			"		if (_reference.containsKey(key)) _removed[key] = true\n"
+			"		return value\n"
+			"	}\n"
+			"\n"
+			"	clear() {\n"
+			"		for (key in keys) remove(key)\n"
+			"	}\n"
+			"\n"
+			"	keys {\n"
+			"		var result = []\n"
+			"		for (key in _reference.keys) {\n"
+			"			if (!_removed.containsKey(key)) result.add(key)\n"
+			"		}\n"
+			"		for (key in _assigned.keys) {\n"
+			"			if (!_reference.containsKey(key)) result.add(key)\n"
+			"		}\n"
+			"		return result\n"
+			"	}\n"
+			"\n"
+			"	values { keys.map {|key| this[key] } }\n"
+			"	count { keys.count }\n"
+			"	isEmpty { count == 0 }\n"
+			"\n"
+			"	iterate(iterator) {\n"
+			"		// The iterator carries its own keys and position so nested loops over one table stay independent\n"
+			"		if (iterator == null) {\n"
+			"			var keys = this.keys\n"
+			"			return keys.isEmpty ? false : [keys, 0]\n"
+			"		}\n"
+			"		iterator[1] = iterator[1] + 1\n"
+			"		return iterator[1] < iterator[0].count ? iterator : false\n"
+			"	}\n"
+			"\n"
+			"	iteratorValue(iterator) {\n"
+			"		var key = iterator[0][iterator[1]]\n"
+			"		return MapEntry.new(key, this[key])\n"
+			"	}\n"
+			"\n"
+			"	toMap {\n"
+			"		var result = {}\n"
+			"		for (key in keys) result[key] = StateTable.toValue_(this[key])\n"
+			"		return result\n"
+			"	}\n"
+			"\n"
+			"	toString { toMap.toString }\n"
+			"\n"
+			"	changes_ {\n"
+			"		var changes = {}\n"
+			"		for (key in _removed.keys) changes[key] = [1]\n"
+			"		for (key in _values.keys) {\n"
+			"			var value = _values[key]\n"
+			"			if (_assigned.containsKey(key)) {\n"
+			"				changes[key] = [0, StateTable.toValue_(value)]\n"
+			"			} else if (value is StateTable) {\n"
+			"				var tableChanges = value.changes_\n"
+			"				if (!tableChanges.isEmpty) changes[key] = [2, tableChanges]\n"
+			"			} else if (value is List && !_reference.isUnchanged_(key, value)) {\n"
+			"				// A list read from the state may have been changed in place\n"
+			"				changes[key] = [0, StateTable.toValue_(value)]\n"
+			"			}\n"
+			"		}\n"
+			"		return changes\n"
+			"	}\n"
+			"\n"
+			"	static toValue_(value) {\n"
+			"		if (value is StateTable) return value.toMap\n"
+			"		if (value is List) {\n"
+			"			var result = value\n"
+			"			for (i in 0...value.count) {\n"
+			"				var item = toValue_(value[i])\n"
+			"				if (!Object.same(item, value[i])) {\n"
+			"					if (Object.same(result, value)) result = value.toList\n"
+			"					result[i] = item\n"
+			"				}\n"
+			"			}\n"
+			"			return result\n"
+			"		}\n"
+			"		if (value is Map) {\n"
+			"			var result = value\n"
+			"			for (key in value.keys) {\n"
+			"				var item = toValue_(value[key])\n"
+			"				if (!Object.same(item, value[key])) {\n"
+			"					if (Object.same(result, value)) {\n"
+			"						result = {}\n"
+			"						for (entry in value) result[entry.key] = entry.value\n"
+			"					}\n"
+			"					result[key] = item\n"
+			"				}\n"
+			"			}\n"
+			"			return result\n"
+			"		}\n"
+			"		return value\n"
+			"	}\n"
+			"}\n";
+
+	private:
+		static inline const std::string soupModuleSource =
+			std::string(
+				"foreign class StateTableReference {\n"
+				"	foreign keys\n"
+				"	foreign [key]\n"
+				"	foreign containsKey(key)\n"
+				"	foreign isUnchanged_(key, value)\n"
+				"}\n"
+				"\n") +
+			StateTableSource +
+			"\n"
+			"class SoupTask {\n"
+			"	static runBefore { [] }\n"
+			"	static runAfter { [] }\n"
+			"	static evaluate() {}\n"
+			"}\n"
+			"\n"
+			"class Soup {\n"
+			"	static globalState {\n"
+			"		if (__globalState is Null) __globalState = StateTable.new_(loadGlobalState_())\n"
+			"		return __globalState\n"
+			"	}\n"
+			"\n"
+			"	static activeState {\n"
+			"		if (__activeState is Null) __activeState = StateTable.new_(loadActiveState_())\n"
+			"		return __activeState\n"
+			"	}\n"
+			"\n"
+			"	static sharedState {\n"
+			"		if (__sharedState is Null) __sharedState = StateTable.new_(loadSharedState_())\n"
+			"		return __sharedState\n"
+			"	}\n"
+			"\n"
+			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput) {\n"
+			"		if (!(title is String)) Fiber.abort(\"Title must be a string.\")\n"
+			"		if (!(executable is String)) Fiber.abort(\"Executable must be a string.\")\n"
+			"		if (!(arguments is List)) Fiber.abort(\"Arguments must be a list.\")\n"
+			"		if (!(workingDirectory is String)) Fiber.abort(\"WorkingDirectory must be a string.\")\n"
+			"		if (!(declaredInput is List)) Fiber.abort(\"DeclaredInput must be a list.\")\n"
+			"		if (!(declaredOutput is List)) Fiber.abort(\"DeclaredOutput must be a list.\")\n"
+			"		createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
+			"	}\n"
+			"\n"
+			"	static createOperations(executable, workingDirectory, arguments, declaredInput, operations) {\n"
+			"		if (!(executable is String)) Fiber.abort(\"Executable must be a string.\")\n"
+			"		if (!(workingDirectory is String)) Fiber.abort(\"WorkingDirectory must be a string.\")\n"
+			"		if (!(arguments is List)) Fiber.abort(\"Arguments must be a list.\")\n"
+			"		if (!(declaredInput is List)) Fiber.abort(\"DeclaredInput must be a list.\")\n"
+			"		if (!(operations is List)) Fiber.abort(\"Operations must be a list.\")\n"
+			"		createOperations_(executable, workingDirectory, arguments, declaredInput, operations)\n"
+			"	}\n"
+			"\n"
+			"	static info(message) {\n"
+			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
+			"		info_(message)\n"
+			"	}\n"
+			"\n"
+			"	static warning(message) {\n"
+			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
+			"		warning_(message)\n"
+			"	}\n"
+			"\n"
+			"	static error(message) {\n"
+			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
+			"		error_(message)\n"
+			"	}\n"
+			"\n"
+			"	static activeStateChanges_ {\n"
+			"		if (__activeState is Null) return {}\n"
+			"		return __activeState.changes_\n"
+			"	}\n"
+			"\n"
+			"	static sharedStateChanges_ {\n"
+			"		if (__sharedState is Null) return {}\n"
+			"		return __sharedState.changes_\n"
+			"	}\n"
+			"\n"
+			"	static reset_() {\n"
+			"		__globalState = null\n"
+			"		__activeState = null\n"
+			"		__sharedState = null\n"
+			"	}\n"
+			"\n"
+			"	foreign static loadGlobalState_()\n"
+			"	foreign static loadActiveState_()\n"
+			"	foreign static loadSharedState_()\n"
+			"	foreign static createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
+			"	foreign static createOperations_(executable, workingDirectory, arguments, declaredInput, operations)\n"
+			"	foreign static info_(message)\n"
+			"	foreign static warning_(message)\n"
+			"	foreign static error_(message)\n"
+			"}\n";
+	};
+}
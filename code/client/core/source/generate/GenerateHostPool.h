@@ -0,0 +1,80 @@
+// <copyright file="GenerateHostPool.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "GenerateHost.h"
+
+namespace Soup::Core::Generate
+{
+	/// <summary>
+	/// A shared pool of Wren hosts that have already interpreted their extension script.
+	/// Every package that references the same build extension can reuse a warm host instead of
+	/// creating a new virtual machine and compiling the script and its imports again.
+	/// Only the Soup state is reset between tasks, the host rejects a task that assigns module level state.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class GenerateHostPool
+	{
+	private:
+		std::mutex _mutex;
+		std::map<std::string, std::vector<std::unique_ptr<GenerateHost>>> _idleHosts;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateHostPool"/> class.
+		/// </summary>
+		GenerateHostPool() :
+			_mutex(),
+			_idleHosts()
+		{
+		}
+
+		GenerateHostPool(const GenerateHostPool&) = delete;
+		GenerateHostPool& operator=(const GenerateHostPool&) = delete;
+
+		/// <summary>
+		/// Take an idle host for the script, or create and initialize a new one when none are available.
+		/// A host is only ever used by a single caller until it is released.
+		/// </summary>
+		std::unique_ptr<GenerateHost> Acquire(const Path& scriptFile, const std::optional<Path>& bundlesFile)
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				auto findResult = _idleHosts.find(GetKey(scriptFile, bundlesFile));
+				if (findResult != _idleHosts.end() && !findResult->second.empty())
+				{
+					auto host = std::move(findResult->second.back());
+					findResult->second.pop_back();
+					return host;
+				}
+			}
+
+			// Initialize outside of the lock so independent packages do not wait on each other
+			auto host = std::make_unique<GenerateHost>(scriptFile, bundlesFile);
+			host->InterpretMain();
+			return host;
+		}
+
+		/// <summary>
+		/// Return a host to the pool so it can be reused by the next package
+		/// </summary>
+		void Release(std::unique_ptr<GenerateHost> host)
+		{
+			auto key = GetKey(host->GetScriptFile(), host->GetBundlesFile());
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_idleHosts[key].push_back(std::move(host));
+		}
+
+	private:
+		static std::string GetKey(const Path& scriptFile, const std::optional<Path>& bundlesFile)
+		{
+			if (bundlesFile.has_value())
+				return std::format("{}|{}", scriptFile.ToString(), bundlesFile.value().ToString());
+			else
+				return scriptFile.ToString();
+		}
+	};
+}
@@ -10,6 +10,9 @@ namespace Soup::Core::Generate
 	/// <summary>
 	/// Generate State used to track all context for state and operation graph creation
 	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
 	class GenerateState
 	{
 	private:
@@ -102,6 +105,29 @@ namespace Soup::Core::Generate
 				std::move(declaredOutputPaths));
 		}
 
+		/// <summary>
+		/// Create a batch of build operations that share the executable, working directory,
+		/// leading arguments and declared input
+		/// </summary>
+		void CreateOperations(
+			std::string executable,
+			std::string workingDirectory,
+			std::vector<std::string> commonArguments,
+			std::vector<std::string> commonInput,
+			std::vector<OperationBatchEntry> operations)
+		{
+			auto commonInputPaths = std::vector<Path>();
+			for (auto& value : commonInput)
+				commonInputPaths.push_back(Path(std::move(value)));
+
+			_graphGenerator.CreateOperations(
+				Path(std::move(executable)),
+				Path(std::move(workingDirectory)),
+				std::move(commonArguments),
+				std::move(commonInputPaths),
+				std::move(operations));
+		}
+
 		void Update(ValueTable activeState, ValueTable sharedState)
 		{
 			_activeState = std::move(activeState);
@@ -3,13 +3,33 @@
 // </copyright>
 
 #pragma once
+#include "build/FileSystemState.h"
+#include "operation-graph/OperationGraph.h"
 
 namespace Soup::Core::Generate
 {
+	/// <summary>
+	/// The fields unique to a single operation in a batch that shares the executable, working directory,
+	/// leading arguments and declared input
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct OperationBatchEntry
+	{
+		std::string Title;
+		std::vector<std::string> Arguments;
+		std::vector<Path> DeclaredInput;
+		std::vector<Path> DeclaredOutput;
+	};
+
 	/// <summary>
 	/// The cached operation graph that is used to track input/output mappings for previous build
 	/// executions to support incremental builds
 	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
 	class OperationGraphGenerator
 	{
 	private:
@@ -24,6 +44,9 @@ namespace Soup::Core::Generate
 		std::map<FileId, OperationId> _outputFileLookup;
 		std::map<FileId, OperationId> _outputDirectoryLookup;
 
+		// The access sets only depend on the working directory so they are resolved once and shared
+		std::map<Path, std::pair<AccessSet, AccessSet>> _accessSetLookup;
+
 	public:
 		OperationGraphGenerator(
 			FileSystemState& fileSystemState,
@@ -36,7 +59,8 @@ namespace Soup::Core::Generate
 			_graph(),
 			_inputFileLookup(),
 			_outputFileLookup(),
-			_outputDirectoryLookup()
+			_outputDirectoryLookup(),
+			_accessSetLookup()
 		{
 		}
 
@@ -89,29 +113,127 @@ namespace Soup::Core::Generate
 			for (auto& file : _writeAccessList)
 				Log::Diag(file.ToString());
 
-			// Generate a unique id for this new operation
-			_uniqueId++;
-			auto operationId = _uniqueId;
-
 			// Resolve the requested files to unique ids
 			auto declaredInputFileIds = _fileSystemState.ToFileIds(declaredInput, commandInfo.WorkingDirectory);
 			auto declaredOutputFileIds = _fileSystemState.ToFileIds(declaredOutput, commandInfo.WorkingDirectory);
-			auto readAccessFileIds = _fileSystemState.ToFileIds(_readAccessList, commandInfo.WorkingDirectory);
-			auto writeAccessFileIds = _fileSystemState.ToFileIds(_writeAccessList, commandInfo.WorkingDirectory);
+			auto& [readAccess, writeAccess] = GetAccessSets(commandInfo.WorkingDirectory);
+
+			AddOperation(
+				std::move(title),
+				std::move(commandInfo),
+				std::move(declaredInputFileIds),
+				std::move(declaredOutputFileIds),
+				readAccess,
+				writeAccess);
+		}
 
-			// Build up the declared build operation
-			auto operationInfo = OperationInfo(
-				operationId,
-				title,
-				commandInfo,
-				declaredInputFileIds,
-				declaredOutputFileIds,
-				readAccessFileIds,
-				writeAccessFileIds);
-			auto& operationInfoReference = _graph.AddOperation(std::move(operationInfo));
+		/// <summary>
+		/// Create a batch of operations that share the executable, working directory, leading arguments and
+		/// declared input. The shared fields are validated and resolved once and every operation is checked
+		/// before any is added to the graph.
+		/// </summary>
+		void CreateOperations(
+			Path executable,
+			Path workingDirectory,
+			std::vector<std::string> commonArguments,
+			std::vector<Path> commonInput,
+			std::vector<OperationBatchEntry> operations)
+		{
+			Log::Diag("Create Operations: {}", operations.size());
 
-			StoreLookupInfo(operationInfoReference);
-			ResolveDependencies(operationInfoReference);
+			if (!workingDirectory.HasRoot())
+				throw std::runtime_error("Working directory must be an absolute path.");
+
+			// Verify allowed read access for the shared input
+			if (!IsAllowedAccess(_readAccessList, commonInput, workingDirectory))
+			{
+				throw std::runtime_error("Operation does not have permission to read requested input.");
+			}
+
+			Log::Diag("Read Access Subset:");
+			for (auto& file : _readAccessList)
+				Log::Diag(file.ToString());
+
+			Log::Diag("Write Access Subset:");
+			for (auto& file : _writeAccessList)
+				Log::Diag(file.ToString());
+
+			auto commonInputFileIds = _fileSystemState.ToFileIds(commonInput, workingDirectory);
+			auto& [readAccess, writeAccess] = GetAccessSets(workingDirectory);
+
+			struct PendingOperation
+			{
+				std::string Title;
+				CommandInfo Command;
+				std::vector<FileId> DeclaredInput;
+				std::vector<FileId> DeclaredOutput;
+			};
+
+			// Validate the entire batch up front so a failure does not leave a partial graph
+			auto pendingOperations = std::vector<PendingOperation>();
+			pendingOperations.reserve(operations.size());
+			auto batchCommands = std::unordered_set<CommandInfo>();
+			for (auto& operation : operations)
+			{
+				Log::Diag("Create Operation: {}", operation.Title);
+
+				auto arguments = commonArguments;
+				arguments.insert(
+					arguments.end(),
+					std::make_move_iterator(operation.Arguments.begin()),
+					std::make_move_iterator(operation.Arguments.end()));
+
+				// Build up the operation unique command
+				auto commandInfo = CommandInfo(
+					workingDirectory,
+					executable,
+					std::move(arguments));
+
+				// Ensure this is the a unique operation
+				if (_graph.HasCommand(commandInfo) || !batchCommands.insert(commandInfo).second)
+				{
+					throw std::runtime_error("Operation with this command already exists.");
+				}
+
+				// Verify allowed read access
+				if (!IsAllowedAccess(_readAccessList, operation.DeclaredInput, workingDirectory))
+				{
+					throw std::runtime_error("Operation does not have permission to read requested input.");
+				}
+
+				// Verify allowed write access
+				if (!IsAllowedAccess(_writeAccessList, operation.DeclaredOutput, workingDirectory))
+				{
+					throw std::runtime_error("Operation does not have permission to write requested output.");
+				}
+
+				// Resolve the requested files to unique ids
+				auto declaredInputFileIds = commonInputFileIds;
+				auto operationInputFileIds = _fileSystemState.ToFileIds(operation.DeclaredInput, workingDirectory);
+				declaredInputFileIds.insert(
+					declaredInputFileIds.end(),
+					operationInputFileIds.begin(),
+					operationInputFileIds.end());
+				auto declaredOutputFileIds = _fileSystemState.ToFileIds(operation.DeclaredOutput, workingDirectory);
+
+				pendingOperations.push_back(PendingOperation({
+					std::move(operation.Title),
+					std::move(commandInfo),
+					std::move(declaredInputFileIds),
+					std::move(declaredOutputFileIds),
+				}));
+			}
+
+			for (auto& operation : pendingOperations)
+			{
+				AddOperation(
+					std::move(operation.Title),
+					std::move(operation.Command),
+					std::move(operation.DeclaredInput),
+					std::move(operation.DeclaredOutput),
+					readAccess,
+					writeAccess);
+			}
 		}
 
 		OperationGraph FinalizeGraph()
@@ -130,50 +252,165 @@ namespace Soup::Core::Generate
 			_graph.SetRootOperationIds(std::move(rootOperations));
 
 			// Remove extra dependency references that are already covered by upstream references
-			auto recursiveChildren = std::map<OperationId, std::set<OperationId>>();
-			BuildRecursiveChildSets(recursiveChildren, _graph.GetRootOperationIds());
-			for (auto& [_, operation] : _graph.GetOperations())
+			RemoveTransitiveChildren(_graph);
+
+			return std::move(_graph);
+		}
+
+		/// <summary>
+		/// Remove each child reference that is already reachable through another child
+		/// The reachable sets are bitsets over the operations in reverse topological order, built one block
+		/// of target operations at a time to bound the memory used by large graphs
+		/// </summary>
+		static void RemoveTransitiveChildren(OperationGraph& graph)
+		{
+			// Number the operations so that every child comes before all of its parents
+			auto order = GetReverseTopologicalOrder(graph);
+			auto operationCount = order.size();
+			if (operationCount == 0)
+				return;
+
+			auto positions = std::vector<uint32_t>(graph.GetOperations().rbegin()->first + 1);
+			for (auto i = 0u; i < operationCount; i++)
+				positions[order[i]->Id] = i;
+
+			auto childPositions = std::vector<std::vector<uint32_t>>(operationCount);
+			auto redundantChildren = std::vector<std::vector<bool>>(operationCount);
+			for (auto i = 0u; i < operationCount; i++)
 			{
-				// Check each child to see if it is already covered by another child
-				for (auto iterator = operation.Children.begin(); iterator != operation.Children.end();)
+				auto& children = order[i]->Children;
+				childPositions[i].reserve(children.size());
+				for (auto childId : children)
+					childPositions[i].push_back(positions[childId]);
+
+				// Only an operation with multiple children can have a redundant reference
+				if (children.size() > 1)
+					redundantChildren[i].resize(children.size());
+			}
+
+			constexpr size_t WordBitCount = 64;
+			constexpr size_t BlockWordCount = 16;
+			constexpr size_t BlockBitCount = BlockWordCount * WordBitCount;
+			auto reachable = std::vector<uint64_t>(operationCount * BlockWordCount);
+			for (size_t blockStart = 0; blockStart < operationCount; blockStart += BlockBitCount)
+			{
+				auto blockEnd = std::min(blockStart + BlockBitCount, operationCount);
+
+				// An operation can only reach the operations that come before it in the order
+				for (auto position = blockStart; position < operationCount; position++)
 				{
-					auto childId = *iterator;
-					auto isDuplicate = std::any_of(
-						operation.Children.cbegin(),
-						operation.Children.cend(),
-						[&](OperationId secondChildId)
+					auto row = reachable.data() + position * BlockWordCount;
+					std::fill(row, row + BlockWordCount, 0);
+
+					// Combine everything reachable through each child, not yet including the children themselves
+					auto& children = childPositions[position];
+					for (auto childPosition : children)
+					{
+						if (childPosition < blockStart)
+							continue;
+
+						auto childRow = reachable.data() + childPosition * BlockWordCount;
+						for (auto word = 0u; word < BlockWordCount; word++)
+							row[word] |= childRow[word];
+					}
+
+					// A child that is reachable through any child is redundant, a child never reaches itself
+					// so a repeated reference to the same child is kept
+					if (children.size() > 1)
+					{
+						for (auto i = 0u; i < children.size(); i++)
 						{
-							if (secondChildId != childId)
-							{
-								auto childRecursiveSet = recursiveChildren[secondChildId];
-								return childRecursiveSet.contains(childId);
-							}
-							else
-							{
-								return false;
-							}
-						});
-
-					if (isDuplicate)
+							auto childPosition = children[i];
+							if (childPosition < blockStart || childPosition >= blockEnd)
+								continue;
+
+							auto bit = childPosition - blockStart;
+							if ((row[bit / WordBitCount] & (uint64_t(1) << (bit % WordBitCount))) != 0)
+								redundantChildren[position][i] = true;
+						}
+					}
+
+					// The parents reach the children themselves as well
+					for (auto childPosition : children)
 					{
-						// Update the child dependency count
-						auto& childOperation = _graph.GetOperationInfo(childId);
-						childOperation.DependencyCount--;
+						if (childPosition < blockStart || childPosition >= blockEnd)
+							continue;
 
-						// Remove the duplicate
-						iterator = operation.Children.erase(iterator);
+						auto bit = childPosition - blockStart;
+						row[bit / WordBitCount] |= uint64_t(1) << (bit % WordBitCount);
+					}
+				}
+			}
+
+			// Drop the redundant references
+			for (auto position = 0u; position < operationCount; position++)
+			{
+				auto& redundant = redundantChildren[position];
+				if (std::find(redundant.begin(), redundant.end(), true) == redundant.end())
+					continue;
+
+				auto& operation = *order[position];
+				auto children = std::vector<OperationId>();
+				for (auto i = 0u; i < operation.Children.size(); i++)
+				{
+					if (redundant[i])
+					{
+						// Update the child dependency count
+						order[childPositions[position][i]]->DependencyCount--;
 					}
 					else
 					{
-						iterator++;
+						children.push_back(operation.Children[i]);
 					}
 				}
-			}
 
-			return _graph;
+				operation.Children = std::move(children);
+			}
 		}
 
 	private:
+		void AddOperation(
+			std::string title,
+			CommandInfo commandInfo,
+			std::vector<FileId> declaredInput,
+			std::vector<FileId> declaredOutput,
+			const AccessSet& readAccess,
+			const AccessSet& writeAccess)
+		{
+			// Generate a unique id for this new operation
+			_uniqueId++;
+			auto operationId = _uniqueId;
+
+			// Build up the declared build operation
+			auto operationInfo = OperationInfo(
+				operationId,
+				std::move(title),
+				std::move(commandInfo),
+				std::move(declaredInput),
+				std::move(declaredOutput),
+				readAccess,
+				writeAccess);
+			auto& operationInfoReference = _graph.AddOperation(std::move(operationInfo));
+
+			StoreLookupInfo(operationInfoReference);
+			ResolveDependencies(operationInfoReference);
+		}
+
+		const std::pair<AccessSet, AccessSet>& GetAccessSets(const Path& workingDirectory)
+		{
+			auto findResult = _accessSetLookup.find(workingDirectory);
+			if (findResult != _accessSetLookup.end())
+				return findResult->second;
+
+			auto readAccess = AccessSet(_fileSystemState.ToFileIds(_readAccessList, workingDirectory));
+			auto writeAccess = AccessSet(_fileSystemState.ToFileIds(_writeAccessList, workingDirectory));
+			auto [insertIterator, wasInserted] = _accessSetLookup.emplace(
+				workingDirectory,
+				std::make_pair(std::move(readAccess), std::move(writeAccess)));
+
+			return insertIterator->second;
+		}
+
 		void StoreLookupInfo(const OperationInfo& operationInfo)
 		{
 			// Store the operation in the required file lookups to ensure single target
@@ -302,32 +539,56 @@ namespace Soup::Core::Generate
 			}
 		}
 
-		void BuildRecursiveChildSets(
-			std::map<OperationId, std::set<OperationId>>& recursiveChildren,
-			const std::vector<OperationId>& operations)
+		/// <summary>
+		/// Get all operations ordered so that every child comes before its parents
+		/// </summary>
+		static std::vector<OperationInfo*> GetReverseTopologicalOrder(OperationGraph& graph)
 		{
-			for (auto operationId : operations)
+			auto& operations = graph.GetOperations();
+			auto result = std::vector<OperationInfo*>();
+			result.reserve(operations.size());
+			if (operations.empty())
+				return result;
+
+			// Walk the graph without recursion to support deep dependency chains
+			enum class VisitState : uint8_t { None, Active, Done };
+			auto visitStates = std::vector<VisitState>(operations.rbegin()->first + 1, VisitState::None);
+			auto stack = std::vector<std::pair<OperationInfo*, size_t>>();
+			for (auto& [operationId, operation] : operations)
 			{
-				auto& operation = _graph.GetOperationInfo(operationId);
-				BuildRecursiveChildSets(recursiveChildren, operation.Children);
+				if (visitStates[operationId] != VisitState::None)
+					continue;
 
-				// Check if this node was already handled in a different branch
-				if (!recursiveChildren.contains(operationId))
+				visitStates[operationId] = VisitState::Active;
+				stack.emplace_back(&operation, 0);
+				while (!stack.empty())
 				{
-					auto childSet = std::set<OperationId>();
-					std::copy(operation.Children.begin(), operation.Children.end(), std::inserter(childSet, childSet.end()));
-					for (auto childId : operation.Children)
+					auto [activeOperation, childIndex] = stack.back();
+					if (childIndex < activeOperation->Children.size())
 					{
-						auto findChildRecursiveSet = recursiveChildren.find(childId);
-						if (findChildRecursiveSet == recursiveChildren.end())
-							throw std::runtime_error("Recursive child was missing");
-						auto& childRecursiveSet = findChildRecursiveSet->second;
-						std::copy(childRecursiveSet.begin(), childRecursiveSet.end(), std::inserter(childSet, childSet.end()));
-					}
+						stack.back().second++;
+
+						auto childId = activeOperation->Children[childIndex];
+						auto& childState = visitStates[childId];
+						if (childState == VisitState::Active)
+							throw std::runtime_error("Operation introduced circular reference");
 
-					recursiveChildren.emplace(operationId, std::move(childSet));
+						if (childState == VisitState::None)
+						{
+							childState = VisitState::Active;
+							stack.emplace_back(&graph.GetOperationInfo(childId), 0);
+						}
+					}
+					else
+					{
+						visitStates[activeOperation->Id] = VisitState::Done;
+						result.push_back(activeOperation);
+						stack.pop_back();
+					}
 				}
 			}
+
+			return result;
 		}
 
 		bool IsAllowedAccess(
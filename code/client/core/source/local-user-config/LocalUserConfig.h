@@ -18,6 +18,7 @@ namespace Soup::Core
 	{
 	private:
 		static constexpr const char* Property_SDKs = "SDKs";
+		static constexpr const char* Property_ImmutableRoots = "ImmutableRoots";
 
 	public:
 		/// <summary>
@@ -59,6 +60,29 @@ namespace Soup::Core
 			return result;
 		}
 
+		/// <summary>
+		/// Gets or sets the list of directories that never change between builds
+		/// </summary>
+		bool HasImmutableRoots()
+		{
+			return HasValue(Property_ImmutableRoots);
+		}
+
+		std::vector<Path> GetImmutableRoots()
+		{
+			if (!HasImmutableRoots())
+				throw std::runtime_error("No ImmutableRoots.");
+
+			auto& values = GetValue(Property_ImmutableRoots).AsList();
+			auto result = std::vector<Path>();
+			for (auto& value : values)
+			{
+				result.push_back(Path(value.AsString()));
+			}
+
+			return result;
+		}
+
 		/// <summary>
 		/// Raw access
 		/// </summary>
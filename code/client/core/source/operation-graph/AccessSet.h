@@ -0,0 +1,70 @@
+﻿// <copyright file="AccessSet.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "build/FileSystemState.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// An immutable set of files that an operation is allowed to access
+	/// Operations that were declared with the same access share a single instance
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class AccessSet
+	{
+	private:
+		std::shared_ptr<const std::vector<FileId>> _files;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="AccessSet"/> class.
+		/// </summary>
+		AccessSet() :
+			_files(GetEmptyFiles())
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="AccessSet"/> class.
+		/// </summary>
+		AccessSet(std::vector<FileId> files) :
+			_files(std::make_shared<const std::vector<FileId>>(std::move(files)))
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="AccessSet"/> class.
+		/// </summary>
+		AccessSet(std::initializer_list<FileId> files) :
+			_files(std::make_shared<const std::vector<FileId>>(files))
+		{
+		}
+
+		/// <summary>
+		/// Get the files, the address is stable and unique for each shared set
+		/// </summary>
+		const std::vector<FileId>& GetFiles() const
+		{
+			return *_files;
+		}
+
+		/// <summary>
+		/// Equality operator
+		/// </summary>
+		bool operator ==(const AccessSet& rhs) const
+		{
+			return _files == rhs._files || *_files == *rhs._files;
+		}
+
+	private:
+		static const std::shared_ptr<const std::vector<FileId>>& GetEmptyFiles()
+		{
+			static const auto value = std::make_shared<const std::vector<FileId>>();
+			return value;
+		}
+	};
+}
@@ -0,0 +1,87 @@
+﻿// <copyright file="FileIdMap.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "build/FileSystemState.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The mapping from the file ids stored in a binary file to the active file system state ids
+	/// The writers emit the files in ascending id order which allows a flat sorted lookup
+	/// without hashing every referenced id
+	/// </summary>
+	class FileIdMap
+	{
+	private:
+		std::vector<std::pair<FileId, FileId>> _entries;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="FileIdMap"/> class.
+		/// </summary>
+		FileIdMap(size_t capacity) :
+			_entries()
+		{
+			_entries.reserve(capacity);
+		}
+
+		/// <summary>
+		/// Add a new mapping, must be followed by a call to Seal before lookups
+		/// </summary>
+		void Add(FileId fileId, FileId activeFileId)
+		{
+			_entries.emplace_back(fileId, activeFileId);
+		}
+
+		/// <summary>
+		/// Insert a new mapping into an already sealed map while keeping it sorted
+		/// </summary>
+		void Insert(FileId fileId, FileId activeFileId)
+		{
+			auto insertPosition = std::lower_bound(
+				_entries.begin(),
+				_entries.end(),
+				fileId,
+				[](const auto& entry, FileId value) { return entry.first < value; });
+			if (insertPosition != _entries.end() && insertPosition->first == fileId)
+				throw std::runtime_error("Failed to insert file id lookup");
+
+			_entries.emplace(insertPosition, fileId, activeFileId);
+		}
+
+		/// <summary>
+		/// Ensure the entries are sorted and unique
+		/// </summary>
+		void Seal()
+		{
+			auto compareFileId = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+			if (!std::is_sorted(_entries.begin(), _entries.end(), compareFileId))
+				std::sort(_entries.begin(), _entries.end(), compareFileId);
+
+			auto duplicate = std::adjacent_find(
+				_entries.begin(),
+				_entries.end(),
+				[](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; });
+			if (duplicate != _entries.end())
+				throw std::runtime_error("Failed to insert file id lookup");
+		}
+
+		/// <summary>
+		/// Find the active file id that maps to the cached file id
+		/// </summary>
+		FileId Get(FileId fileId) const
+		{
+			auto findResult = std::lower_bound(
+				_entries.begin(),
+				_entries.end(),
+				fileId,
+				[](const auto& entry, FileId value) { return entry.first < value; });
+			if (findResult == _entries.end() || findResult->first != fileId)
+				throw std::runtime_error("Could not find file id in active map");
+
+			return findResult->second;
+		}
+	};
+}
@@ -0,0 +1,212 @@
+﻿// <copyright file="InputSet.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "build/FileSystemState.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The set of files an operation observed as input, stored as a base list that is shared with other operations
+	/// along with the small list of files that are unique to this operation
+	/// Iteration visits the base files followed by the delta files
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class InputSet
+	{
+	public:
+		/// <summary>
+		/// A forward iterator across the base and delta files
+		/// </summary>
+		class Iterator
+		{
+		private:
+			const InputSet* _set;
+			size_t _index;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = FileId;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const FileId*;
+			using reference = const FileId&;
+
+			Iterator() :
+				_set(nullptr),
+				_index(0)
+			{
+			}
+
+			Iterator(const InputSet* set, size_t index) :
+				_set(set),
+				_index(index)
+			{
+			}
+
+			reference operator*() const
+			{
+				auto baseSize = _set->_base->size();
+				return _index < baseSize ? (*_set->_base)[_index] : _set->_delta[_index - baseSize];
+			}
+
+			pointer operator->() const
+			{
+				return &**this;
+			}
+
+			Iterator& operator++()
+			{
+				_index++;
+				return *this;
+			}
+
+			Iterator operator++(int)
+			{
+				auto result = *this;
+				_index++;
+				return result;
+			}
+
+			bool operator ==(const Iterator& rhs) const
+			{
+				return _index == rhs._index;
+			}
+		};
+
+	private:
+		std::shared_ptr<const std::vector<FileId>> _base;
+		std::vector<FileId> _delta;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="InputSet"/> class.
+		/// </summary>
+		InputSet() :
+			_base(GetEmptyFiles()),
+			_delta()
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="InputSet"/> class.
+		/// </summary>
+		InputSet(std::vector<FileId> files) :
+			_base(GetEmptyFiles()),
+			_delta(std::move(files))
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="InputSet"/> class.
+		/// </summary>
+		InputSet(std::initializer_list<FileId> files) :
+			_base(GetEmptyFiles()),
+			_delta(files)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="InputSet"/> class.
+		/// </summary>
+		InputSet(
+			std::shared_ptr<const std::vector<FileId>> base,
+			std::vector<FileId> delta) :
+			_base(std::move(base)),
+			_delta(std::move(delta))
+		{
+		}
+
+		/// <summary>
+		/// Get the shared base files, the address is stable and unique for each shared base
+		/// </summary>
+		const std::vector<FileId>& GetBase() const
+		{
+			return *_base;
+		}
+
+		/// <summary>
+		/// Get the shared base files to allow other sets to reference the same list
+		/// </summary>
+		const std::shared_ptr<const std::vector<FileId>>& GetSharedBase() const
+		{
+			return _base;
+		}
+
+		/// <summary>
+		/// Get the files that are unique to this set
+		/// </summary>
+		const std::vector<FileId>& GetDelta() const
+		{
+			return _delta;
+		}
+
+		Iterator begin() const
+		{
+			return Iterator(this, 0);
+		}
+
+		Iterator end() const
+		{
+			return Iterator(this, size());
+		}
+
+		size_t size() const
+		{
+			return _base->size() + _delta.size();
+		}
+
+		bool empty() const
+		{
+			return _base->empty() && _delta.empty();
+		}
+
+		/// <summary>
+		/// Remove a single file, a file that lives in the shared base moves the set to a private copy
+		/// </summary>
+		bool Remove(FileId file)
+		{
+			auto findDelta = std::find(_delta.begin(), _delta.end(), file);
+			if (findDelta != _delta.end())
+			{
+				_delta.erase(findDelta);
+				return true;
+			}
+
+			if (std::find(_base->begin(), _base->end(), file) == _base->end())
+				return false;
+
+			auto files = std::vector<FileId>();
+			files.reserve(size() - 1);
+			std::copy_if(
+				begin(),
+				end(),
+				std::back_inserter(files),
+				[file](FileId value) { return value != file; });
+
+			_base = GetEmptyFiles();
+			_delta = std::move(files);
+			return true;
+		}
+
+		/// <summary>
+		/// Equality operator
+		/// </summary>
+		bool operator ==(const InputSet& rhs) const
+		{
+			if (_base == rhs._base)
+				return _delta == rhs._delta;
+
+			return size() == rhs.size() && std::equal(begin(), end(), rhs.begin());
+		}
+
+	private:
+		static const std::shared_ptr<const std::vector<FileId>>& GetEmptyFiles()
+		{
+			static const auto value = std::make_shared<const std::vector<FileId>>();
+			return value;
+		}
+	};
+}
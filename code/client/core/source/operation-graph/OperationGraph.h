@@ -18,7 +18,10 @@ namespace Soup::Core
 	private:
 		std::vector<OperationId> _rootOperations;
 		std::map<OperationId, OperationInfo> _operations;
-		std::unordered_map<CommandInfo, OperationId> _operationLookup;
+		// The command lookup is only required when generating or merging graphs
+		// so it is built on first use to keep loading an existing graph cheap
+		mutable std::unordered_map<CommandInfo, OperationId> _operationLookup;
+		mutable bool _isLookupLoaded;
 
 	public:
 		/// <summary>
@@ -27,7 +30,8 @@ namespace Soup::Core
 		OperationGraph() :
 			_rootOperations(),
 			_operations(),
-			_operationLookup()
+			_operationLookup(),
+			_isLookupLoaded(true)
 		{
 		}
 
@@ -39,9 +43,9 @@ namespace Soup::Core
 			std::vector<OperationInfo> operations) :
 			_rootOperations(std::move(rootOperations)),
 			_operations(),
-			_operationLookup()
+			_operationLookup(),
+			_isLookupLoaded(false)
 		{
-			// Store the incoming vector of operations as a lookup for fast checks
 			for (auto& info : operations)
 			{
 				AddOperation(std::move(info));
@@ -80,11 +84,21 @@ namespace Soup::Core
 			return _operations;
 		}
 
+		/// <summary>
+		/// Drop the command lookup after commands were modified in place, it is rebuilt on next use
+		/// </summary>
+		void InvalidateOperationLookup()
+		{
+			_operationLookup.clear();
+			_isLookupLoaded = false;
+		}
+
 		/// <summary>
 		/// Find an operation info
 		/// </summary>
 		bool HasCommand(const CommandInfo& command)
 		{
+			EnsureOperationLookupLoaded();
 			return _operationLookup.contains(command);
 		}
 
@@ -95,6 +109,7 @@ namespace Soup::Core
 			const CommandInfo& command,
 			OperationId& operationId) const
 		{
+			EnsureOperationLookupLoaded();
 			auto findResult = _operationLookup.find(command);
 			if (findResult != _operationLookup.end())
 			{
@@ -140,9 +155,12 @@ namespace Soup::Core
 		/// </summary>
 		OperationInfo& AddOperation(OperationInfo info)
 		{
-			auto insertLookupResult = _operationLookup.emplace(info.Command, info.Id);
-			if (!insertLookupResult.second)
-				throw std::runtime_error("The provided command already exists in the graph");
+			if (_isLookupLoaded)
+			{
+				auto insertLookupResult = _operationLookup.emplace(info.Command, info.Id);
+				if (!insertLookupResult.second)
+					throw std::runtime_error("The provided command already exists in the graph");
+			}
 
 			auto [insertIterator, wasInserted] = _operations.emplace(info.Id, std::move(info));
 			if (!wasInserted)
@@ -167,5 +185,25 @@ namespace Soup::Core
 		{
 			return !(*this == rhs);
 		}
+
+	private:
+		/// <summary>
+		/// Build the command lookup for all known operations
+		/// </summary>
+		void EnsureOperationLookupLoaded() const
+		{
+			if (_isLookupLoaded)
+				return;
+
+			_operationLookup.reserve(_operations.size());
+			for (auto& [operationId, info] : _operations)
+			{
+				auto insertLookupResult = _operationLookup.emplace(info.Command, operationId);
+				if (!insertLookupResult.second)
+					throw std::runtime_error("The provided command already exists in the graph");
+			}
+
+			_isLookupLoaded = true;
+		}
 	};
 }
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "utilities/MappedFile.h"
 #include "OperationGraph.h"
 #include "OperationGraphReader.h"
 #include "OperationGraphWriter.h"
@@ -26,9 +27,9 @@ namespace Soup::Core
 			OperationGraph& result,
 			FileSystemState& fileSystemState)
 		{
-			// Open the file to read from
-			std::shared_ptr<System::IInputFile> file;
-			if (!System::IFileSystem::Current().TryOpenRead(operationGraphFile, true, file))
+			// Load the file into an input buffer, mapped directly when it lives on the local disk
+			auto mappedFile = MappedFile();
+			if (!mappedFile.TryOpen(operationGraphFile))
 			{
 				Log::Info("Operation graph file does not exist");
 				return false;
@@ -37,7 +38,7 @@ namespace Soup::Core
 			// Read the contents of the build state file
 			try
 			{
-				result = OperationGraphReader::Deserialize(file->GetInStream(), fileSystemState);
+				result = OperationGraphReader::Deserialize(mappedFile.GetData(), mappedFile.GetSize(), fileSystemState);
 				return true;
 			}
 			catch(std::runtime_error& ex)
@@ -64,13 +65,19 @@ namespace Soup::Core
 
 			// Update the operation graph referenced files
 			auto files = std::set<FileId>();
+			auto accessSets = std::unordered_set<const std::vector<FileId>*>();
 			for (auto& operationReference : state.GetOperations())
 			{
 				auto& operation = operationReference.second;
 				files.insert(operation.DeclaredInput.begin(), operation.DeclaredInput.end());
 				files.insert(operation.DeclaredOutput.begin(), operation.DeclaredOutput.end());
-				files.insert(operation.ReadAccess.begin(), operation.ReadAccess.end());
-				files.insert(operation.WriteAccess.begin(), operation.WriteAccess.end());
+
+				// Shared access sets only need to be visited once
+				for (auto accessSet : { &operation.ReadAccess.GetFiles(), &operation.WriteAccess.GetFiles() })
+				{
+					if (accessSets.insert(accessSet).second)
+						files.insert(accessSet->begin(), accessSet->end());
+				}
 			}
 
 			// Open the file to write to
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "FileIdMap.h"
 #include "OperationGraph.h"
 
 namespace Soup::Core
@@ -17,7 +18,7 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation Graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = 7;
 
 	public:
 		static OperationGraph Deserialize(std::istream& stream, FileSystemState& fileSystemState)
@@ -29,12 +30,20 @@ namespace Soup::Core
 
 			auto contentBuffer = std::vector<char>(size);
 			stream.read(contentBuffer.data(), size);
-			auto data = contentBuffer.data();
+
+			return Deserialize(contentBuffer.data(), contentBuffer.size(), fileSystemState);
+		}
+
+		/// <summary>
+		/// Deserialize from a block of memory, such as a memory mapped input buffer, without copying it first.
+		/// Every operation is still materialized up front.
+		/// </summary>
+		static OperationGraph Deserialize(const char* data, size_t size, FileSystemState& fileSystemState)
+		{
 			size_t offset = 0;
-			
 			auto result = Deserialize(data, size, offset, fileSystemState);
 
-			if (offset != contentBuffer.size())
+			if (offset != size)
 			{
 				throw std::runtime_error("Value Table file corrupted - Did not read the entire file");
 			}
@@ -44,11 +53,8 @@ namespace Soup::Core
 
 	private:
 		static OperationGraph Deserialize(
-			char* data, size_t size, size_t& offset, FileSystemState& fileSystemState)
+			const char* data, size_t size, size_t& offset, FileSystemState& fileSystemState)
 		{
-			// BUG: Why does this need to be at the start of the file?
-			auto activeFileIdMap = std::unordered_map<FileId, FileId>();
-
 			// Read the File Header with version
 			auto headerBuffer = std::array<char, 4>();
 			Read(data, size, offset, headerBuffer.data(), 4);
@@ -78,6 +84,7 @@ namespace Soup::Core
 
 			// Map up the incoming file ids to the active file system state ids
 			auto fileCount = ReadUInt32(data, size, offset);
+			auto activeFileIdMap = FileIdMap(fileCount);
 			for (auto i = 0u; i < fileCount; i++)
 			{
 				// Read the command working directory
@@ -87,9 +94,28 @@ namespace Soup::Core
 				auto file = Path(std::move(fileString));
 
 				auto activeFileId = fileSystemState.ToFileId(file);
-				auto insertResult = activeFileIdMap.emplace(fileId, activeFileId);
-				if (!insertResult.second)
-					throw std::runtime_error("Failed to insert file id lookup");
+				activeFileIdMap.Add(fileId, activeFileId);
+			}
+
+			activeFileIdMap.Seal();
+
+			// Read the set of access sets
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'A' ||
+				headerBuffer[1] != 'C' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid operation graph access sets header");
+			}
+
+			// Each access set is decoded once and shared by every operation that references it
+			auto accessSetCount = ReadUInt32(data, size, offset);
+			auto accessSets = std::vector<AccessSet>();
+			accessSets.reserve(accessSetCount);
+			for (auto i = 0u; i < accessSetCount; i++)
+			{
+				accessSets.push_back(AccessSet(ReadFileIdList(data, size, offset, activeFileIdMap)));
 			}
 
 			// Read the set of operations
@@ -119,7 +145,7 @@ namespace Soup::Core
 			auto operations = std::vector<OperationInfo>(operationCount);
 			for (auto i = 0u; i < operationCount; i++)
 			{
-				operations[i] = ReadOperationInfo(data, size, offset, activeFileIdMap);
+				operations[i] = ReadOperationInfo(data, size, offset, activeFileIdMap, accessSets);
 			}
 
 			return OperationGraph(
@@ -128,7 +154,11 @@ namespace Soup::Core
 		}
 
 		static OperationInfo ReadOperationInfo(
-			char* data, size_t size, size_t& offset, const std::unordered_map<FileId, FileId>& activeFileIdMap)
+			const char* data,
+			size_t size,
+			size_t& offset,
+			const FileIdMap& activeFileIdMap,
+			const std::vector<AccessSet>& accessSets)
 		{
 			// Write out the operation id
 			auto id = ReadUInt32(data, size, offset);
@@ -151,11 +181,11 @@ namespace Soup::Core
 			// Write out the declared output files
 			auto declaredOutput = ReadFileIdList(data, size, offset, activeFileIdMap);
 
-			// Write out the read access list
-			auto readAccess = ReadFileIdList(data, size, offset, activeFileIdMap);
+			// Write out the read access set
+			auto readAccess = ReadAccessSet(data, size, offset, accessSets);
 
-			// Write out the write access list
-			auto writeAccess = ReadFileIdList(data, size, offset, activeFileIdMap);
+			// Write out the write access set
+			auto writeAccess = ReadAccessSet(data, size, offset, accessSets);
 
 			// Write out the child operation ids
 			auto children = ReadOperationIdList(data, size, offset);
@@ -178,7 +208,7 @@ namespace Soup::Core
 				dependencyCount);
 		}
 
-		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		static uint32_t ReadUInt32(const char* data, size_t size, size_t& offset)
 		{
 			uint32_t result = 0;
 			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
@@ -186,16 +216,20 @@ namespace Soup::Core
 			return result;
 		}
 
-		static std::string ReadString(char* data, size_t size, size_t& offset)
+		static std::string ReadString(const char* data, size_t size, size_t& offset)
 		{
 			auto stringLength = ReadUInt32(data, size, offset);
-			auto result = std::string(stringLength, '\0');
-			Read(data, size, offset, result.data(), stringLength);
+			if (offset + stringLength > size)
+				throw std::runtime_error("Tried to read past end of data");
+
+			// Construct directly from the source data to avoid initializing the buffer twice
+			auto result = std::string(data + offset, stringLength);
+			offset += stringLength;
 
 			return result;
 		}
 
-		static std::vector<std::string> ReadStringList(char* data, size_t size, size_t& offset)
+		static std::vector<std::string> ReadStringList(const char* data, size_t size, size_t& offset)
 		{
 			auto listSize = ReadUInt32(data, size, offset);
 			auto result = std::vector<std::string>(listSize);
@@ -208,26 +242,30 @@ namespace Soup::Core
 		}
 
 		static std::vector<FileId> ReadFileIdList(
-			char* data, size_t size, size_t& offset, const std::unordered_map<FileId, FileId>& activeFileIdMap)
+			const char* data, size_t size, size_t& offset, const FileIdMap& activeFileIdMap)
 		{
 			auto listSize = ReadUInt32(data, size, offset);
 			auto result = std::vector<FileId>(listSize);
 			for (auto i = 0u; i < listSize; i++)
 			{
 				auto fileId = ReadUInt32(data, size, offset);
-
-				// Find the active file id that maps to the cached file id
-				auto findActiveFileId = activeFileIdMap.find(fileId);
-				if (findActiveFileId == activeFileIdMap.end())
-					throw std::runtime_error("Could not find file id in active map");
-
-				result[i] = findActiveFileId->second;
+				result[i] = activeFileIdMap.Get(fileId);
 			}
 
 			return result;
 		}
 
-		static std::vector<OperationId> ReadOperationIdList(char* data, size_t size, size_t& offset)
+		static AccessSet ReadAccessSet(
+			const char* data, size_t size, size_t& offset, const std::vector<AccessSet>& accessSets)
+		{
+			auto accessSetIndex = ReadUInt32(data, size, offset);
+			if (accessSetIndex >= accessSets.size())
+				throw std::runtime_error("Operation graph access set index out of range");
+
+			return accessSets[accessSetIndex];
+		}
+
+		static std::vector<OperationId> ReadOperationIdList(const char* data, size_t size, size_t& offset)
 		{
 			auto listSize = ReadUInt32(data, size, offset);
 			auto result = std::vector<OperationId>(listSize);
@@ -239,7 +277,7 @@ namespace Soup::Core
 			return result;
 		}
 
-		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		static void Read(const char* data, size_t size, size_t& offset, char* buffer, size_t count)
 		{
 			if (offset + count > size)
 				throw new std::runtime_error("Tried to read past end of data");
@@ -13,7 +13,7 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = 7;
 
 	public:
 		static void Serialize(
@@ -36,6 +36,24 @@ namespace Soup::Core
 				WriteValue(stream, fileSystemState.GetFilePath(fileId).ToString());
 			}
 
+			// Intern the access sets so identical sets are only written once
+			auto accessSetLookup = std::map<std::vector<FileId>, uint32_t>();
+			auto sharedAccessSetLookup = std::unordered_map<const std::vector<FileId>*, uint32_t>();
+			auto accessSets = std::vector<const std::vector<FileId>*>();
+			for (auto& [operationId, operation] : state.GetOperations())
+			{
+				InternAccessSet(operation.ReadAccess, accessSetLookup, sharedAccessSetLookup, accessSets);
+				InternAccessSet(operation.WriteAccess, accessSetLookup, sharedAccessSetLookup, accessSets);
+			}
+
+			// Write out the set of access sets
+			stream.write("ACS\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(accessSets.size()));
+			for (auto accessSet : accessSets)
+			{
+				WriteValues(stream, *accessSet);
+			}
+
 			// Write out the root operation ids
 			stream.write("ROP\0", 4);
 			WriteValues(stream, state.GetRootOperationIds());
@@ -46,12 +64,33 @@ namespace Soup::Core
 			WriteValue(stream, static_cast<uint32_t>(operations.size()));
 			for (auto& operationValue : state.GetOperations())
 			{
-				WriteOperationInfo(stream, operationValue.second);
+				WriteOperationInfo(stream, operationValue.second, sharedAccessSetLookup);
 			}
 		}
 
 	private:
-		static void WriteOperationInfo(std::ostream& stream, const OperationInfo& operation)
+		static void InternAccessSet(
+			const AccessSet& accessSet,
+			std::map<std::vector<FileId>, uint32_t>& accessSetLookup,
+			std::unordered_map<const std::vector<FileId>*, uint32_t>& sharedAccessSetLookup,
+			std::vector<const std::vector<FileId>*>& accessSets)
+		{
+			// Operations that already share a set skip the content comparison
+			auto& files = accessSet.GetFiles();
+			if (sharedAccessSetLookup.contains(&files))
+				return;
+
+			auto [insertIterator, wasInserted] = accessSetLookup.emplace(files, static_cast<uint32_t>(accessSets.size()));
+			if (wasInserted)
+				accessSets.push_back(&files);
+
+			sharedAccessSetLookup.emplace(&files, insertIterator->second);
+		}
+
+		static void WriteOperationInfo(
+			std::ostream& stream,
+			const OperationInfo& operation,
+			const std::unordered_map<const std::vector<FileId>*, uint32_t>& sharedAccessSetLookup)
 		{
 			// Write out the operation id
 			WriteValue(stream, operation.Id);
@@ -74,11 +113,11 @@ namespace Soup::Core
 			// Write out the declared output files
 			WriteValues(stream, operation.DeclaredOutput);
 
-			// Write out the read access list
-			WriteValues(stream, operation.ReadAccess);
+			// Write out the read access set index
+			WriteValue(stream, sharedAccessSetLookup.at(&operation.ReadAccess.GetFiles()));
 
-			// Write out the write access list
-			WriteValues(stream, operation.WriteAccess);
+			// Write out the write access set index
+			WriteValue(stream, sharedAccessSetLookup.at(&operation.WriteAccess.GetFiles()));
 
 			// Write out the child operation ids
 			WriteValues(stream, operation.Children);
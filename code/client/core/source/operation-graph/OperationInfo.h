@@ -4,6 +4,7 @@
 
 #pragma once
 #include "build/FileSystemState.h"
+#include "AccessSet.h"
 #include "CommandInfo.h"
 
 using namespace std::chrono_literals;
@@ -26,8 +27,8 @@ namespace Soup::Core
 		CommandInfo Command;
 		std::vector<FileId> DeclaredInput;
 		std::vector<FileId> DeclaredOutput;
-		std::vector<FileId> ReadAccess;
-		std::vector<FileId> WriteAccess;
+		AccessSet ReadAccess;
+		AccessSet WriteAccess;
 		std::vector<OperationId> Children;
 		uint32_t DependencyCount;
 
@@ -51,8 +52,8 @@ namespace Soup::Core
 			CommandInfo command,
 			std::vector<FileId> declaredInput,
 			std::vector<FileId> declaredOutput,
-			std::vector<FileId> readAccess,
-			std::vector<FileId> writeAccess) :
+			AccessSet readAccess,
+			AccessSet writeAccess) :
 			Id(id),
 			Title(std::move(title)),
 			Command(std::move(command)),
@@ -71,8 +72,8 @@ namespace Soup::Core
 			CommandInfo command,
 			std::vector<FileId> declaredInput,
 			std::vector<FileId> declaredOutput,
-			std::vector<FileId> readAccess,
-			std::vector<FileId> writeAccess,
+			AccessSet readAccess,
+			AccessSet writeAccess,
 			std::vector<OperationId> children,
 			uint32_t dependencyCount) :
 			Id(id),
@@ -4,11 +4,31 @@
 
 #pragma once
 #include "CommandInfo.h"
+#include "InputSet.h"
 
 using namespace std::chrono_literals;
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// The resources consumed by the last run of an operation
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct OperationResourceUsage
+	{
+		std::chrono::microseconds WallTime = 0us;
+		std::chrono::microseconds UserTime = 0us;
+		std::chrono::microseconds SystemTime = 0us;
+		uint64_t MaxResidentSetSize = 0;
+		uint64_t VoluntaryContextSwitches = 0;
+		uint64_t InvoluntaryContextSwitches = 0;
+		uint64_t MonitorEventCount = 0;
+
+		bool operator ==(const OperationResourceUsage& rhs) const = default;
+	};
+
 	/// <summary>
 	/// A node result that tacks the observed output from previous runs
 	/// </summary>
@@ -20,27 +40,69 @@ namespace Soup::Core
 	public:
 		bool WasSuccessfulRun;
 		std::chrono::time_point<std::chrono::file_clock> EvaluateTime;
-		std::vector<FileId> ObservedInput;
+		InputSet ObservedInput;
 		std::vector<FileId> ObservedOutput;
 
+		// The content digest for each observed input when content based checks are enabled
+		std::vector<uint64_t> ObservedInputDigests;
+
+		// The resources used by the run, left empty when the process was not monitored
+		OperationResourceUsage ResourceUsage;
+
 	public:
 		OperationResult() :
 			WasSuccessfulRun(false),
 			EvaluateTime(std::chrono::time_point<std::chrono::file_clock>::min()),
 			ObservedInput(),
-			ObservedOutput()
+			ObservedOutput(),
+			ObservedInputDigests(),
+			ResourceUsage()
 		{
 		}
 
 		OperationResult(
 			bool wasSuccessfulRun,
 			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
-			std::vector<FileId> observedInput,
+			InputSet observedInput,
 			std::vector<FileId> observedOutput) :
+			OperationResult(
+				wasSuccessfulRun,
+				evaluateTime,
+				std::move(observedInput),
+				std::move(observedOutput),
+				{})
+		{
+		}
+
+		OperationResult(
+			bool wasSuccessfulRun,
+			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
+			InputSet observedInput,
+			std::vector<FileId> observedOutput,
+			std::vector<uint64_t> observedInputDigests) :
+			OperationResult(
+				wasSuccessfulRun,
+				evaluateTime,
+				std::move(observedInput),
+				std::move(observedOutput),
+				std::move(observedInputDigests),
+				OperationResourceUsage())
+		{
+		}
+
+		OperationResult(
+			bool wasSuccessfulRun,
+			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
+			InputSet observedInput,
+			std::vector<FileId> observedOutput,
+			std::vector<uint64_t> observedInputDigests,
+			OperationResourceUsage resourceUsage) :
 			WasSuccessfulRun(wasSuccessfulRun),
 			EvaluateTime(evaluateTime),
 			ObservedInput(std::move(observedInput)),
-			ObservedOutput(std::move(observedOutput))
+			ObservedOutput(std::move(observedOutput)),
+			ObservedInputDigests(std::move(observedInputDigests)),
+			ResourceUsage(resourceUsage)
 		{
 		}
 
@@ -49,7 +111,9 @@ namespace Soup::Core
 			return WasSuccessfulRun == rhs.WasSuccessfulRun &&
 				EvaluateTime == rhs.EvaluateTime &&
 				ObservedInput == rhs.ObservedInput &&
-				ObservedOutput == rhs.ObservedOutput;
+				ObservedOutput == rhs.ObservedOutput &&
+				ObservedInputDigests == rhs.ObservedInputDigests &&
+				ResourceUsage == rhs.ResourceUsage;
 		}
 	};
 }
\ No newline at end of file
@@ -18,14 +18,26 @@ namespace Soup::Core
 	class OperationResults
 	{
 	private:
+		// Small input sets are not worth sharing
+		static constexpr size_t MinSharedInputCount = 16;
+
+		// Bound the number of bases that each new input set is compared against
+		static constexpr size_t MaxObservedInputBaseCount = 256;
+
 		std::map<OperationId, OperationResult> _results;
 
+		// The shared observed input base lists that new results can reference
+		std::vector<std::shared_ptr<const std::vector<FileId>>> _observedInputBases;
+		bool _isObservedInputBasesLoaded;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="OperationResults"/> class.
 		/// </summary>
 		OperationResults() :
-			_results()
+			_results(),
+			_observedInputBases(),
+			_isObservedInputBasesLoaded(false)
 		{
 		}
 
@@ -34,7 +46,9 @@ namespace Soup::Core
 		/// </summary>
 		OperationResults(
 			std::map<OperationId, OperationResult> results) :
-			_results(std::move(results))
+			_results(std::move(results)),
+			_observedInputBases(),
+			_isObservedInputBasesLoaded(false)
 		{
 		}
 
@@ -78,6 +92,70 @@ namespace Soup::Core
 			return insertIterator->second;
 		}
 
+		/// <summary>
+		/// Create the observed input for a new result, sharing a base list with the existing results when they overlap
+		/// Operations that observe the same system and toolchain files only keep a small per operation delta
+		/// </summary>
+		InputSet InternObservedInput(std::vector<FileId> files)
+		{
+			if (files.size() < MinSharedInputCount)
+				return InputSet(std::move(files));
+
+			EnsureObservedInputBasesLoaded();
+
+			auto fileLookup = std::unordered_set<FileId>(files.begin(), files.end());
+
+			// Find the largest base that is fully contained and the base with the largest overlap
+			std::shared_ptr<const std::vector<FileId>> containedBase = nullptr;
+			std::shared_ptr<const std::vector<FileId>> overlapBase = nullptr;
+			size_t overlapCount = 0;
+			for (auto& base : _observedInputBases)
+			{
+				auto count = static_cast<size_t>(std::count_if(
+					base->begin(),
+					base->end(),
+					[&fileLookup](FileId fileId) { return fileLookup.contains(fileId); }));
+
+				if (count == base->size() && (containedBase == nullptr || count > containedBase->size()))
+					containedBase = base;
+
+				if (count > overlapCount)
+				{
+					overlapBase = base;
+					overlapCount = count;
+				}
+			}
+
+			// Reuse an existing base when it covers the majority of the files
+			if (containedBase != nullptr && containedBase->size() * 2 >= files.size())
+				return CreateInputSet(std::move(containedBase), std::move(files));
+
+			if (_observedInputBases.size() >= MaxObservedInputBaseCount)
+				return InputSet(std::move(files));
+
+			// Split the files in common with the closest base into a new base,
+			// otherwise the entire set becomes a base for the results that follow
+			auto baseFiles = std::vector<FileId>();
+			if (overlapBase != nullptr && overlapCount * 2 >= files.size())
+			{
+				baseFiles.reserve(overlapCount);
+				std::copy_if(
+					overlapBase->begin(),
+					overlapBase->end(),
+					std::back_inserter(baseFiles),
+					[&fileLookup](FileId fileId) { return fileLookup.contains(fileId); });
+			}
+			else
+			{
+				baseFiles = files;
+			}
+
+			auto base = std::make_shared<const std::vector<FileId>>(std::move(baseFiles));
+			_observedInputBases.push_back(base);
+
+			return CreateInputSet(std::move(base), std::move(files));
+		}
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -93,5 +171,35 @@ namespace Soup::Core
 		{
 			return !(*this == rhs);
 		}
+
+	private:
+		/// <summary>
+		/// Collect the bases from the loaded results the first time a new input set is shared
+		/// </summary>
+		void EnsureObservedInputBasesLoaded()
+		{
+			if (_isObservedInputBasesLoaded)
+				return;
+
+			auto knownBases = std::unordered_set<const std::vector<FileId>*>();
+			for (auto& [operationId, result] : _results)
+			{
+				auto& base = result.ObservedInput.GetSharedBase();
+				if (!base->empty() && knownBases.insert(base.get()).second)
+					_observedInputBases.push_back(base);
+			}
+
+			_isObservedInputBasesLoaded = true;
+		}
+
+		static InputSet CreateInputSet(
+			std::shared_ptr<const std::vector<FileId>> base,
+			std::vector<FileId> files)
+		{
+			auto baseLookup = std::unordered_set<FileId>(base->begin(), base->end());
+			std::erase_if(files, [&baseLookup](FileId fileId) { return baseLookup.contains(fileId); });
+
+			return InputSet(std::move(base), std::move(files));
+		}
 	};
 }
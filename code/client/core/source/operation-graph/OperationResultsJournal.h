@@ -0,0 +1,198 @@
+﻿// <copyright file="OperationResultsJournal.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "OperationResultsManager.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The append only journal of operation results that sits on top of the last full results snapshot
+	/// Each result is written as soon as the operation finishes so an interrupted build keeps all completed work,
+	/// and the snapshot is only rewritten once the journal grows large enough to compact
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class OperationResultsJournal
+	{
+	private:
+		// Compact once the journal holds this many records even if it is still smaller than the snapshot
+		static constexpr size_t MaxRecordCount = 4096;
+
+		Path _operationResultsFile;
+		Path _journalFile;
+		const OperationResults& _results;
+		const FileSystemState& _fileSystemState;
+
+		// The operations that are only persisted in the existing journal file
+		std::set<OperationId> _journaledOperations;
+
+		// The snapshot no longer matches the current results, the ids were remapped or it failed to load
+		bool _isSnapshotStale;
+
+		// Records are appended by the evaluate workers without holding the shared evaluation state
+		std::mutex _mutex;
+		std::shared_ptr<System::IOutputFile> _file;
+		std::unordered_set<FileId> _journaledFiles;
+		std::unordered_map<std::shared_ptr<const std::vector<FileId>>, uint32_t> _journaledObservedInputBases;
+		size_t _recordCount;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationResultsJournal"/> class.
+		/// </summary>
+		OperationResultsJournal(
+			Path operationResultsFile,
+			Path journalFile,
+			const OperationResults& results,
+			std::set<OperationId> journaledOperations,
+			bool isSnapshotStale,
+			const FileSystemState& fileSystemState) :
+			_operationResultsFile(std::move(operationResultsFile)),
+			_journalFile(std::move(journalFile)),
+			_results(results),
+			_fileSystemState(fileSystemState),
+			_journaledOperations(std::move(journaledOperations)),
+			_isSnapshotStale(isSnapshotStale),
+			_mutex(),
+			_file(nullptr),
+			_journaledFiles(),
+			_journaledObservedInputBases(),
+			_recordCount(_journaledOperations.size())
+		{
+		}
+
+		/// <summary>
+		/// Start the journal file if it is not already open
+		/// Rewriting the previous records reads the results, so the caller must ensure they are not being updated
+		/// </summary>
+		void EnsureOpen()
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+
+			// Defer touching the journal file until there is something to record
+			if (_file == nullptr)
+				Open();
+		}
+
+		/// <summary>
+		/// Append the updated result for a single operation
+		/// Only the given result is read, so it can be called while other results are being updated once the journal is open
+		/// </summary>
+		void Append(OperationId operationId, const OperationResult& result)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			if (_file == nullptr)
+				Open();
+
+			WriteRecord(operationId, result);
+		}
+
+		/// <summary>
+		/// Get a value indicating if the snapshot must be rewritten
+		/// </summary>
+		bool RequiresCompaction() const
+		{
+			return _isSnapshotStale ||
+				_recordCount >= MaxRecordCount ||
+				_recordCount > _results.GetResults().size();
+		}
+
+		/// <summary>
+		/// Write the full results snapshot and start a new empty journal
+		/// </summary>
+		void Compact()
+		{
+			// Always save the snapshot before clearing the journal so an interruption never loses results
+			OperationResultsManager::SaveState(_operationResultsFile, _results, _fileSystemState);
+
+			StartJournal();
+			_journaledOperations.clear();
+			_isSnapshotStale = false;
+		}
+
+	private:
+		void Open()
+		{
+			if (_isSnapshotStale)
+			{
+				Compact();
+				return;
+			}
+
+			// The file system abstraction cannot append, rewrite the records the previous journal held
+			StartJournal();
+			for (auto operationId : _journaledOperations)
+			{
+				const OperationResult* result;
+				if (TryFindResult(operationId, result))
+					WriteRecord(operationId, *result);
+			}
+
+			_journaledOperations.clear();
+		}
+
+		void StartJournal()
+		{
+			_file = System::IFileSystem::Current().OpenWrite(_journalFile, true);
+			_journaledFiles.clear();
+			_journaledObservedInputBases.clear();
+			_recordCount = 0;
+
+			auto& stream = _file->GetOutStream();
+			OperationResultsWriter::SerializeJournalHeader(stream);
+			stream.flush();
+		}
+
+		void WriteRecord(OperationId operationId, const OperationResult& result)
+		{
+			// Only write out the paths for files this journal has not seen yet
+			auto newFiles = std::vector<FileId>();
+			for (auto fileId : result.ObservedInput)
+			{
+				if (_journaledFiles.insert(fileId).second)
+					newFiles.push_back(fileId);
+			}
+
+			for (auto fileId : result.ObservedOutput)
+			{
+				if (_journaledFiles.insert(fileId).second)
+					newFiles.push_back(fileId);
+			}
+
+			// Hold on to the base so its index stays valid for the lifetime of the journal
+			auto [observedInputBase, isNewObservedInputBase] = _journaledObservedInputBases.try_emplace(
+				result.ObservedInput.GetSharedBase(),
+				static_cast<uint32_t>(_journaledObservedInputBases.size()));
+
+			auto& stream = _file->GetOutStream();
+			OperationResultsWriter::SerializeJournalRecord(
+				operationId,
+				result,
+				newFiles,
+				observedInputBase->second,
+				isNewObservedInputBase,
+				_fileSystemState,
+				stream);
+			stream.flush();
+
+			_recordCount++;
+		}
+
+		bool TryFindResult(OperationId operationId, const OperationResult*& result) const
+		{
+			auto findResult = _results.GetResults().find(operationId);
+			if (findResult != _results.GetResults().end())
+			{
+				result = &findResult->second;
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+	};
+}
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "utilities/MappedFile.h"
 #include "OperationResultsReader.h"
 #include "OperationResultsWriter.h"
 
@@ -25,9 +26,9 @@ namespace Soup::Core
 			OperationResults& result,
 			FileSystemState& fileSystemState)
 		{
-			// Open the file to read from
-			std::shared_ptr<System::IInputFile> file;
-			if (!System::IFileSystem::Current().TryOpenRead(operationResultsFile, true, file))
+			// Load the file into an input buffer, mapped directly when it lives on the local disk
+			auto mappedFile = MappedFile();
+			if (!mappedFile.TryOpen(operationResultsFile))
 			{
 				Log::Info("Operation results file does not exist");
 				return false;
@@ -36,7 +37,7 @@ namespace Soup::Core
 			// Read the contents of the build state file
 			try
 			{
-				result = OperationResultsReader::Deserialize(file->GetInStream(), fileSystemState);
+				result = OperationResultsReader::Deserialize(mappedFile.GetData(), mappedFile.GetSize(), fileSystemState);
 				return true;
 			}
 			catch(std::runtime_error& ex)
@@ -51,6 +52,37 @@ namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Apply the journal records that were appended since the last full save
+		/// Returns the set of operations that were updated by the journal
+		/// </summary>
+		static std::set<OperationId> TryLoadJournal(
+			const Path& journalFile,
+			OperationResults& result,
+			FileSystemState& fileSystemState)
+		{
+			try
+			{
+				// Load the entire journal for fastest read operation
+				auto mappedFile = MappedFile();
+				if (!mappedFile.TryOpen(journalFile) || mappedFile.GetSize() == 0)
+					return {};
+
+				return OperationResultsReader::DeserializeJournal(
+					mappedFile.GetData(), mappedFile.GetSize(), result, fileSystemState);
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Warning("Failed to apply operation results journal: {}", ex.what());
+				return {};
+			}
+			catch(...)
+			{
+				Log::Warning("Failed to apply operation results journal");
+				return {};
+			}
+		}
+
 		/// <summary>
 		/// Save the operation state for the provided directory
 		/// </summary>
@@ -62,12 +94,17 @@ namespace Soup::Core
 			// Open the file to write to
 			auto file = System::IFileSystem::Current().OpenWrite(operationResultsFile, true);
 
-			// Update the operation graph referenced files
+			// Update the operation graph referenced files, visiting each shared input base once
 			auto files = std::set<FileId>();
+			auto visitedBases = std::unordered_set<const std::vector<FileId>*>();
 			for (auto& resultReference : state.GetResults())
 			{
 				auto& result = resultReference.second;
-				files.insert(result.ObservedInput.begin(), result.ObservedInput.end());
+				auto& observedInputBase = result.ObservedInput.GetBase();
+				if (visitedBases.insert(&observedInputBase).second)
+					files.insert(observedInputBase.begin(), observedInputBase.end());
+
+				files.insert(result.ObservedInput.GetDelta().begin(), result.ObservedInput.GetDelta().end());
 				files.insert(result.ObservedOutput.begin(), result.ObservedOutput.end());
 			}
 
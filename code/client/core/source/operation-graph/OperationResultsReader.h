@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "FileIdMap.h"
 #include "OperationResult.h"
 
 namespace Soup::Core
@@ -17,7 +18,7 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation Results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 5;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -34,12 +35,20 @@ namespace Soup::Core
 
 			auto contentBuffer = std::vector<char>(size);
 			stream.read(contentBuffer.data(), size);
-			auto data = contentBuffer.data();
-			size_t offset = 0;
 
+			return Deserialize(contentBuffer.data(), contentBuffer.size(), fileSystemState);
+		}
+
+		/// <summary>
+		/// Deserialize from a block of memory, such as a memory mapped input buffer, without copying it first.
+		/// Every result is still materialized up front.
+		/// </summary>
+		static OperationResults Deserialize(const char* data, size_t size, FileSystemState& fileSystemState)
+		{
+			size_t offset = 0;
 			auto result = Deserialize(data, size, offset, fileSystemState);
 
-			if (offset != contentBuffer.size())
+			if (offset != size)
 			{
 				throw std::runtime_error("Operation results file corrupted - Did not read the entire file");
 			}
@@ -47,9 +56,97 @@ namespace Soup::Core
 			return result;
 		}
 
+		/// <summary>
+		/// Apply the records from an operation results journal on top of the snapshot results
+		/// Reading stops at the first record that was only partially written or is corrupted,
+		/// every record before it is applied and nothing from it or after it is
+		/// Returns the set of operations that were updated by the journal
+		/// </summary>
+		static std::set<OperationId> DeserializeJournal(
+			const char* data,
+			size_t size,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			size_t offset = 0;
+
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'O' ||
+				headerBuffer[2] != 'J' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid operation results journal header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Operation results journal version does not match expected");
+			}
+
+			// The file ids and observed input bases accumulate over the lifetime of the journal
+			auto activeFileIdMap = FileIdMap(0);
+			auto observedInputBases = std::vector<std::shared_ptr<const std::vector<FileId>>>();
+			auto journaledOperations = std::set<OperationId>();
+			while (size - offset >= sizeof(uint32_t))
+			{
+				auto recordSize = ReadUInt32(data, size, offset);
+				if (recordSize > size - offset)
+					break;
+
+				// Stage the record so a corrupted record never leaves a partial result behind
+				auto recordEnd = offset + recordSize;
+				auto recordResults = OperationResults();
+				OperationId operationId;
+				try
+				{
+					auto fileCount = ReadUInt32(data, recordEnd, offset);
+					for (auto i = 0u; i < fileCount; i++)
+					{
+						auto fileId = ReadUInt32(data, recordEnd, offset);
+
+						auto fileString = ReadString(data, recordEnd, offset);
+						auto file = Path(std::move(fileString));
+
+						auto activeFileId = fileSystemState.ToFileId(file);
+						activeFileIdMap.Insert(fileId, activeFileId);
+					}
+
+					auto isNewObservedInputBase = ReadBoolean(data, recordEnd, offset);
+					if (isNewObservedInputBase)
+					{
+						observedInputBases.push_back(std::make_shared<const std::vector<FileId>>(
+							ReadFileIdList(data, recordEnd, offset, activeFileIdMap)));
+					}
+
+					operationId = ReadOperationResult(
+						data, recordEnd, offset, activeFileIdMap, observedInputBases, recordResults);
+					if (offset != recordEnd)
+					{
+						throw std::runtime_error("Operation results journal corrupted - Record size does not match");
+					}
+				}
+				catch (std::runtime_error& ex)
+				{
+					// Keep the records that were already applied, the next journal only carries those forward
+					Log::Warning("Truncated operation results journal at corrupted record: {}", ex.what());
+					break;
+				}
+
+				auto& result = recordResults.GetResults().at(operationId);
+				results.AddOrUpdateOperationResult(operationId, std::move(result));
+				journaledOperations.insert(operationId);
+			}
+
+			return journaledOperations;
+		}
+
 	private:
 		static OperationResults Deserialize(
-			char* data,
+			const char* data,
 			size_t size,
 			size_t& offset,
 			FileSystemState& fileSystemState)
@@ -83,7 +180,7 @@ namespace Soup::Core
 
 			// Map up the incoming file ids to the active file system state ids
 			auto fileCount = ReadUInt32(data, size, offset);
-			auto activeFileIdMap = std::unordered_map<FileId, FileId>();
+			auto activeFileIdMap = FileIdMap(fileCount);
 			for (auto i = 0u; i < fileCount; i++)
 			{
 				// Read the command working directory
@@ -93,9 +190,28 @@ namespace Soup::Core
 				auto file = Path(std::move(fileString));
 
 				auto activeFileId = fileSystemState.ToFileId(file);
-				auto insertMapResult = activeFileIdMap.emplace(fileId, activeFileId);
-				if (!insertMapResult.second)
-					throw std::runtime_error("Failed to insert file id lookup");
+				activeFileIdMap.Add(fileId, activeFileId);
+			}
+
+			activeFileIdMap.Seal();
+
+			// Read the shared observed input bases
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'O' ||
+				headerBuffer[1] != 'I' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid operation results observed input header");
+			}
+
+			auto observedInputBaseCount = ReadUInt32(data, size, offset);
+			auto observedInputBases = std::vector<std::shared_ptr<const std::vector<FileId>>>();
+			observedInputBases.reserve(observedInputBaseCount);
+			for (auto i = 0u; i < observedInputBaseCount; i++)
+			{
+				observedInputBases.push_back(std::make_shared<const std::vector<FileId>>(
+					ReadFileIdList(data, size, offset, activeFileIdMap)));
 			}
 
 			// Read the set of operations
@@ -112,17 +228,18 @@ namespace Soup::Core
 			auto results = OperationResults();
 			for (auto i = 0u; i < resultCount; i++)
 			{
-				ReadOperationResult(data, size, offset, activeFileIdMap, results);
+				ReadOperationResult(data, size, offset, activeFileIdMap, observedInputBases, results);
 			}
 
 			return results;
 		}
 
-		static void ReadOperationResult(
-			char* data,
+		static OperationId ReadOperationResult(
+			const char* data,
 			size_t size,
 			size_t& offset,
-			const std::unordered_map<FileId, FileId>& activeFileIdMap,
+			const FileIdMap& activeFileIdMap,
+			const std::vector<std::shared_ptr<const std::vector<FileId>>>& observedInputBases,
 			OperationResults& results)
 		{
 			// Read the operation id
@@ -143,22 +260,50 @@ namespace Soup::Core
 			auto evaluateTimeFile = std::chrono::file_clock::from_sys(evaluateTimeSystem);
 			#endif
 
-			// Read the observed input files
-			auto observedInput = ReadFileIdList(data, size, offset, activeFileIdMap);
+			// Read the observed input files as the shared base and the files unique to this result
+			auto observedInputBaseIndex = ReadUInt32(data, size, offset);
+			if (observedInputBaseIndex >= observedInputBases.size())
+				throw std::runtime_error("Operation results observed input base index out of range");
+
+			auto observedInputDelta = ReadFileIdList(data, size, offset, activeFileIdMap);
+			auto observedInput = InputSet(
+				observedInputBases[observedInputBaseIndex],
+				std::move(observedInputDelta));
 
 			// Read the observed output files
 			auto observedOutput = ReadFileIdList(data, size, offset, activeFileIdMap);
 
+			// Read the observed input content digests
+			auto observedInputDigests = ReadUInt64List(data, size, offset);
+
+			// Read the optional resource usage
+			auto resourceUsage = OperationResourceUsage();
+			auto hasResourceUsage = ReadBoolean(data, size, offset);
+			if (hasResourceUsage)
+			{
+				resourceUsage.WallTime = std::chrono::microseconds(ReadInt64(data, size, offset));
+				resourceUsage.UserTime = std::chrono::microseconds(ReadInt64(data, size, offset));
+				resourceUsage.SystemTime = std::chrono::microseconds(ReadInt64(data, size, offset));
+				resourceUsage.MaxResidentSetSize = ReadUInt64(data, size, offset);
+				resourceUsage.VoluntaryContextSwitches = ReadUInt64(data, size, offset);
+				resourceUsage.InvoluntaryContextSwitches = ReadUInt64(data, size, offset);
+				resourceUsage.MonitorEventCount = ReadUInt64(data, size, offset);
+			}
+
 			auto result = OperationResult(
 				wasSuccessfulRun,
 				evaluateTimeFile,
 				std::move(observedInput),
-				std::move(observedOutput));
+				std::move(observedOutput),
+				std::move(observedInputDigests),
+				resourceUsage);
 
 			results.AddOrUpdateOperationResult(operationId, std::move(result));
+
+			return operationId;
 		}
 
-		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		static uint32_t ReadUInt32(const char* data, size_t size, size_t& offset)
 		{
 			uint32_t result = 0;
 			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
@@ -166,7 +311,7 @@ namespace Soup::Core
 			return result;
 		}
 
-		static int64_t ReadInt64(char* data, size_t size, size_t& offset)
+		static int64_t ReadInt64(const char* data, size_t size, size_t& offset)
 		{
 			int64_t result = 0;
 			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(int64_t));
@@ -174,7 +319,15 @@ namespace Soup::Core
 			return result;
 		}
 
-		static bool ReadBoolean(char* data, size_t size, size_t& offset)
+		static uint64_t ReadUInt64(const char* data, size_t size, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
+		static bool ReadBoolean(const char* data, size_t size, size_t& offset)
 		{
 			uint32_t result = 0;
 			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
@@ -182,37 +335,48 @@ namespace Soup::Core
 			return result != 0;
 		}
 
-		static std::string ReadString(char* data, size_t size, size_t& offset)
+		static std::string ReadString(const char* data, size_t size, size_t& offset)
 		{
 			auto stringLength = ReadUInt32(data, size, offset);
-			auto result = std::string(stringLength, '\0');
-			Read(data, size, offset, result.data(), stringLength);
+			if (offset + stringLength > size)
+				throw std::runtime_error("Tried to read past end of data");
+
+			// Construct directly from the source data to avoid initializing the buffer twice
+			auto result = std::string(data + offset, stringLength);
+			offset += stringLength;
 
 			return result;
 		}
 
 		static std::vector<FileId> ReadFileIdList(
-			char* data, size_t size, size_t& offset, const std::unordered_map<FileId, FileId>& activeFileIdMap)
+			const char* data, size_t size, size_t& offset, const FileIdMap& activeFileIdMap)
 		{
 			auto listLength = ReadUInt32(data, size, offset);
 			auto result = std::vector<FileId>(listLength);
 			for (auto i = 0u; i < listLength; i++)
 			{
 				auto fileId = ReadUInt32(data, size, offset);
+				result[i] = activeFileIdMap.Get(fileId);
+			}
 
-				// Find the active file id that maps to the cached file id
-				auto findActiveFileId = activeFileIdMap.find(fileId);
-				if (findActiveFileId == activeFileIdMap.end())
-					throw std::runtime_error("Could not find file id in active map");
+			return result;
+		}
 
-				result[i] = findActiveFileId->second;
+		static std::vector<uint64_t> ReadUInt64List(
+			const char* data, size_t size, size_t& offset)
+		{
+			auto listLength = ReadUInt32(data, size, offset);
+			auto result = std::vector<uint64_t>(listLength);
+			for (auto i = 0u; i < listLength; i++)
+			{
+				result[i] = ReadUInt64(data, size, offset);
 			}
 
 			return result;
 		}
 
 		static std::vector<OperationId> ReadOperationIdList(
-			char* data, size_t size, size_t& offset)
+			const char* data, size_t size, size_t& offset)
 		{
 			auto listLength = ReadUInt32(data, size, offset);
 			auto result = std::vector<OperationId>(listLength);
@@ -224,7 +388,7 @@ namespace Soup::Core
 			return result;
 		}
 
-		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		static void Read(const char* data, size_t size, size_t& offset, char* buffer, size_t count)
 		{
 			if (offset + count > size)
 				throw new std::runtime_error("Tried to read past end of data");
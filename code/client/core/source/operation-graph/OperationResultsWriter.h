@@ -17,7 +17,7 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 5;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -45,18 +45,84 @@ namespace Soup::Core
 				WriteValue(stream, fileSystemState.GetFilePath(fileId).ToString());
 			}
 
-			// Write out the set of results
+			// Write out the shared observed input bases once and reference them by index from each result
 			auto& results = state.GetResults();
+			auto observedInputBases = std::vector<const std::vector<FileId>*>();
+			auto observedInputBaseLookup = std::unordered_map<const std::vector<FileId>*, uint32_t>();
+			for (const auto& [key, value] : results)
+			{
+				auto& base = value.ObservedInput.GetBase();
+				if (observedInputBaseLookup.try_emplace(&base, static_cast<uint32_t>(observedInputBases.size())).second)
+					observedInputBases.push_back(&base);
+			}
+
+			stream.write("OIS\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(observedInputBases.size()));
+			for (auto base : observedInputBases)
+			{
+				WriteValues(stream, *base);
+			}
+
+			// Write out the set of results
 			stream.write("RTS\0", 4);
 			WriteValue(stream, static_cast<uint32_t>(results.size()));
 			for (const auto& [key, value] : results)
 			{
-				WriteOperationResult(stream, key, value);
+				auto observedInputBaseIndex = observedInputBaseLookup.at(&value.ObservedInput.GetBase());
+				WriteOperationResult(stream, key, value, observedInputBaseIndex);
+			}
+		}
+
+		/// <summary>
+		/// Write the header for a new operation results journal
+		/// </summary>
+		static void SerializeJournalHeader(std::ostream& stream)
+		{
+			// Write the File Header with version, the journal records share the results file version
+			stream.write("BOJ\0", 4);
+			WriteValue(stream, FileVersion);
+		}
+
+		/// <summary>
+		/// Write a single self contained journal record along with the files and observed input base
+		/// that have not been written to this journal yet
+		/// The record is prefixed with its size so a partially written record can be detected and ignored
+		/// </summary>
+		static void SerializeJournalRecord(
+			OperationId operationId,
+			const OperationResult& result,
+			const std::vector<FileId>& newFiles,
+			uint32_t observedInputBaseIndex,
+			bool isNewObservedInputBase,
+			const FileSystemState& fileSystemState,
+			std::ostream& stream)
+		{
+			auto recordStream = std::stringstream();
+			WriteValue(recordStream, static_cast<uint32_t>(newFiles.size()));
+			for (auto fileId : newFiles)
+			{
+				WriteValue(recordStream, fileId);
+				WriteValue(recordStream, fileSystemState.GetFilePath(fileId).ToString());
 			}
+
+			// A new base is assigned the next index in the journal
+			WriteValue(recordStream, isNewObservedInputBase);
+			if (isNewObservedInputBase)
+				WriteValues(recordStream, result.ObservedInput.GetBase());
+
+			WriteOperationResult(recordStream, operationId, result, observedInputBaseIndex);
+
+			auto record = recordStream.str();
+			WriteValue(stream, static_cast<uint32_t>(record.size()));
+			stream.write(record.data(), record.size());
 		}
 
 	private:
-		static void WriteOperationResult(std::ostream& stream, OperationId operationId, const OperationResult& result)
+		static void WriteOperationResult(
+			std::ostream& stream,
+			OperationId operationId,
+			const OperationResult& result,
+			uint32_t observedInputBaseIndex)
 		{
 			// Write out the operation id
 			WriteValue(stream, operationId);
@@ -76,11 +142,30 @@ namespace Soup::Core
 			int64_t evaluateTimeCount = evaluateTimeDuration.count();
 			WriteValue(stream, evaluateTimeCount);
 
-			// Write out the observed input files
-			WriteValues(stream, result.ObservedInput);
+			// Write out the observed input files as the shared base index and the files unique to this result
+			WriteValue(stream, observedInputBaseIndex);
+			WriteValues(stream, result.ObservedInput.GetDelta());
 
 			// Write out the observed output files
 			WriteValues(stream, result.ObservedOutput);
+
+			// Write out the observed input content digests
+			WriteValues(stream, result.ObservedInputDigests);
+
+			// Write out the resource usage, skipped entirely for runs that did not report any
+			auto& resourceUsage = result.ResourceUsage;
+			auto hasResourceUsage = resourceUsage != OperationResourceUsage();
+			WriteValue(stream, hasResourceUsage);
+			if (hasResourceUsage)
+			{
+				WriteValue(stream, static_cast<int64_t>(resourceUsage.WallTime.count()));
+				WriteValue(stream, static_cast<int64_t>(resourceUsage.UserTime.count()));
+				WriteValue(stream, static_cast<int64_t>(resourceUsage.SystemTime.count()));
+				WriteValue(stream, resourceUsage.MaxResidentSetSize);
+				WriteValue(stream, resourceUsage.VoluntaryContextSwitches);
+				WriteValue(stream, resourceUsage.InvoluntaryContextSwitches);
+				WriteValue(stream, resourceUsage.MonitorEventCount);
+			}
 		}
 
 		static void WriteValue(std::ostream& stream, uint32_t value)
@@ -93,6 +178,11 @@ namespace Soup::Core
 			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
 		}
 
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+
 		static void WriteValue(std::ostream& stream, bool value)
 		{
 			uint32_t integerValue = value ? 1u : 0u;
@@ -113,5 +203,14 @@ namespace Soup::Core
 				WriteValue(stream, value);
 			}
 		}
+
+		static void WriteValues(std::ostream& stream, const std::vector<uint64_t>& values)
+		{
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& value : values)
+			{
+				WriteValue(stream, value);
+			}
+		}
 	};
 }
@@ -0,0 +1,236 @@
+﻿// <copyright file="ContentHash.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A fast non-cryptographic content digest (XXH64)
+	/// The four independent accumulator lanes allow the compiler to keep the main loop fully pipelined
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class ContentHash
+	{
+	private:
+		static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+		static constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+		static constexpr uint64_t Prime3 = 0x165667B19E3779F9ull;
+		static constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+		static constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+
+	public:
+		/// <summary>
+		/// Compute the digest for the provided content
+		/// </summary>
+		static uint64_t Compute(std::string_view content, uint64_t seed = 0)
+		{
+			auto data = reinterpret_cast<const uint8_t*>(content.data());
+			auto size = content.size();
+			auto end = data + size;
+
+			uint64_t result;
+			if (size >= 32)
+			{
+				auto lane1 = seed + Prime1 + Prime2;
+				auto lane2 = seed + Prime2;
+				auto lane3 = seed;
+				auto lane4 = seed - Prime1;
+
+				// Consume full 32 byte stripes across all four lanes
+				auto stripeEnd = end - 32;
+				do
+				{
+					lane1 = Round(lane1, Read64(data));
+					lane2 = Round(lane2, Read64(data + 8));
+					lane3 = Round(lane3, Read64(data + 16));
+					lane4 = Round(lane4, Read64(data + 24));
+					data += 32;
+				} while (data <= stripeEnd);
+
+				result = std::rotl(lane1, 1) + std::rotl(lane2, 7) + std::rotl(lane3, 12) + std::rotl(lane4, 18);
+				result = MergeRound(result, lane1);
+				result = MergeRound(result, lane2);
+				result = MergeRound(result, lane3);
+				result = MergeRound(result, lane4);
+			}
+			else
+			{
+				result = seed + Prime5;
+			}
+
+			result += static_cast<uint64_t>(size);
+
+			return Finish(result, data, end);
+		}
+
+		/// <summary>
+		/// Incrementally computes the same digest as <see cref="Compute"/> over content that arrives in chunks
+		/// so large files never have to be held in memory at once
+		/// </summary>
+		class Stream
+		{
+		private:
+			uint64_t _lane1;
+			uint64_t _lane2;
+			uint64_t _lane3;
+			uint64_t _lane4;
+			uint64_t _seed;
+			uint64_t _size;
+			std::array<uint8_t, 32> _buffer;
+			size_t _bufferSize;
+
+		public:
+			/// <summary>
+			/// Initializes a new instance of the <see cref="Stream"/> class.
+			/// </summary>
+			Stream(uint64_t seed = 0) :
+				_lane1(seed + Prime1 + Prime2),
+				_lane2(seed + Prime2),
+				_lane3(seed),
+				_lane4(seed - Prime1),
+				_seed(seed),
+				_size(0),
+				_buffer(),
+				_bufferSize(0)
+			{
+			}
+
+			/// <summary>
+			/// Append the next chunk of content
+			/// </summary>
+			void Update(std::string_view content)
+			{
+				auto data = reinterpret_cast<const uint8_t*>(content.data());
+				auto end = data + content.size();
+				_size += content.size();
+
+				// Complete a partial stripe left over from the previous chunk
+				if (_bufferSize > 0)
+				{
+					auto count = std::min(static_cast<size_t>(end - data), _buffer.size() - _bufferSize);
+					memcpy(_buffer.data() + _bufferSize, data, count);
+					_bufferSize += count;
+					data += count;
+					if (_bufferSize < _buffer.size())
+						return;
+
+					ConsumeStripe(_buffer.data());
+					_bufferSize = 0;
+				}
+
+				while (data + 32 <= end)
+				{
+					ConsumeStripe(data);
+					data += 32;
+				}
+
+				_bufferSize = static_cast<size_t>(end - data);
+				if (_bufferSize > 0)
+					memcpy(_buffer.data(), data, _bufferSize);
+			}
+
+			/// <summary>
+			/// Get the digest for all of the content appended so far
+			/// </summary>
+			uint64_t Finalize() const
+			{
+				uint64_t result;
+				if (_size >= 32)
+				{
+					result = std::rotl(_lane1, 1) + std::rotl(_lane2, 7) + std::rotl(_lane3, 12) + std::rotl(_lane4, 18);
+					result = MergeRound(result, _lane1);
+					result = MergeRound(result, _lane2);
+					result = MergeRound(result, _lane3);
+					result = MergeRound(result, _lane4);
+				}
+				else
+				{
+					result = _seed + Prime5;
+				}
+
+				result += _size;
+
+				return Finish(result, _buffer.data(), _buffer.data() + _bufferSize);
+			}
+
+		private:
+			void ConsumeStripe(const uint8_t* data)
+			{
+				_lane1 = Round(_lane1, Read64(data));
+				_lane2 = Round(_lane2, Read64(data + 8));
+				_lane3 = Round(_lane3, Read64(data + 16));
+				_lane4 = Round(_lane4, Read64(data + 24));
+			}
+		};
+
+	private:
+		/// <summary>
+		/// Consume the remaining tail that does not fill a stripe and mix the final result
+		/// </summary>
+		static uint64_t Finish(uint64_t result, const uint8_t* data, const uint8_t* end)
+		{
+			while (data + 8 <= end)
+			{
+				result ^= Round(0, Read64(data));
+				result = std::rotl(result, 27) * Prime1 + Prime4;
+				data += 8;
+			}
+
+			if (data + 4 <= end)
+			{
+				result ^= static_cast<uint64_t>(Read32(data)) * Prime1;
+				result = std::rotl(result, 23) * Prime2 + Prime3;
+				data += 4;
+			}
+
+			while (data < end)
+			{
+				result ^= static_cast<uint64_t>(*data) * Prime5;
+				result = std::rotl(result, 11) * Prime1;
+				data++;
+			}
+
+			// Final avalanche
+			result ^= result >> 33;
+			result *= Prime2;
+			result ^= result >> 29;
+			result *= Prime3;
+			result ^= result >> 32;
+
+			return result;
+		}
+
+		static uint64_t Round(uint64_t accumulator, uint64_t input)
+		{
+			accumulator += input * Prime2;
+			accumulator = std::rotl(accumulator, 31);
+			accumulator *= Prime1;
+			return accumulator;
+		}
+
+		static uint64_t MergeRound(uint64_t accumulator, uint64_t lane)
+		{
+			accumulator ^= Round(0, lane);
+			accumulator = accumulator * Prime1 + Prime4;
+			return accumulator;
+		}
+
+		static uint64_t Read64(const uint8_t* data)
+		{
+			uint64_t result;
+			memcpy(&result, data, sizeof(uint64_t));
+			return result;
+		}
+
+		static uint32_t Read32(const uint8_t* data)
+		{
+			uint32_t result;
+			memcpy(&result, data, sizeof(uint32_t));
+			return result;
+		}
+	};
+}
@@ -0,0 +1,187 @@
+﻿// <copyright file="MappedFile.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A memory mapped input buffer that holds the entire content of a file. The file is mapped directly when it
+	/// lives on the local disk and read through the registered file system otherwise. The readers still
+	/// deserialize every value out of the buffer, it only replaces the stream copy.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class MappedFile
+	{
+	private:
+		const char* _data;
+		size_t _size;
+		bool _isMapped;
+
+		// The content read through the file system when the file is not mapped
+		std::string _buffer;
+
+	#ifdef _WIN32
+		HANDLE _mapping;
+	#endif
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MappedFile"/> class.
+		/// </summary>
+		MappedFile() :
+			_data(nullptr),
+			_size(0),
+			_isMapped(false),
+			_buffer()
+		#ifdef _WIN32
+			, _mapping(nullptr)
+		#endif
+		{
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		~MappedFile()
+		{
+			Close();
+		}
+
+		/// <summary>
+		/// Attempt to load the entire file, returns false if the file does not exist
+		/// </summary>
+		bool TryOpen(const Path& file)
+		{
+			Close();
+
+			// Only the local disk can be mapped, any other file system (such as the test mock) is read as a stream
+			auto isLocalFileSystem = dynamic_cast<System::STLFileSystem*>(&System::IFileSystem::Current()) != nullptr;
+			if (isLocalFileSystem && TryMap(file))
+				return true;
+
+			return TryRead(file);
+		}
+
+		/// <summary>
+		/// Get the content
+		/// </summary>
+		const char* GetData() const
+		{
+			return _data;
+		}
+
+		/// <summary>
+		/// Get the size of the content
+		/// </summary>
+		size_t GetSize() const
+		{
+			return _size;
+		}
+
+	private:
+		bool TryMap(const Path& file)
+		{
+		#if defined(_WIN32)
+			auto fileHandle = CreateFileA(
+				file.ToString().c_str(),
+				GENERIC_READ,
+				FILE_SHARE_READ,
+				nullptr,
+				OPEN_EXISTING,
+				FILE_FLAG_SEQUENTIAL_SCAN,
+				nullptr);
+			if (fileHandle == INVALID_HANDLE_VALUE)
+				return false;
+
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+			{
+				CloseHandle(fileHandle);
+				return false;
+			}
+
+			// The mapping keeps a reference to the file
+			_mapping = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(fileHandle);
+			if (_mapping == nullptr)
+				return false;
+
+			_data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+			if (_data == nullptr)
+			{
+				CloseHandle(_mapping);
+				_mapping = nullptr;
+				return false;
+			}
+
+			_size = static_cast<size_t>(fileSize.QuadPart);
+			_isMapped = true;
+			return true;
+		#elif defined(__linux__)
+			auto fileHandle = open(file.ToString().c_str(), O_RDONLY | O_CLOEXEC);
+			if (fileHandle < 0)
+				return false;
+
+			struct stat fileInfo;
+			if (fstat(fileHandle, &fileInfo) != 0 || fileInfo.st_size == 0)
+			{
+				close(fileHandle);
+				return false;
+			}
+
+			// The mapping keeps a reference to the file
+			auto data = mmap(nullptr, fileInfo.st_size, PROT_READ, MAP_PRIVATE, fileHandle, 0);
+			close(fileHandle);
+			if (data == MAP_FAILED)
+				return false;
+
+			madvise(data, fileInfo.st_size, MADV_SEQUENTIAL);
+
+			_data = static_cast<const char*>(data);
+			_size = static_cast<size_t>(fileInfo.st_size);
+			_isMapped = true;
+			return true;
+		#else
+			#error "Unknown platform"
+		#endif
+		}
+
+		bool TryRead(const Path& file)
+		{
+			std::shared_ptr<System::IInputFile> inputFile;
+			if (!System::IFileSystem::Current().TryOpenRead(file, true, inputFile))
+				return false;
+
+			auto& stream = inputFile->GetInStream();
+			_buffer = std::string(
+				std::istreambuf_iterator<char>(stream),
+				std::istreambuf_iterator<char>());
+			_data = _buffer.data();
+			_size = _buffer.size();
+			return true;
+		}
+
+		void Close()
+		{
+			if (_isMapped)
+			{
+			#if defined(_WIN32)
+				UnmapViewOfFile(_data);
+				CloseHandle(_mapping);
+				_mapping = nullptr;
+			#elif defined(__linux__)
+				munmap(const_cast<char*>(_data), _size);
+			#endif
+				_isMapped = false;
+			}
+
+			_buffer.clear();
+			_data = nullptr;
+			_size = 0;
+		}
+	};
+}
@@ -4,8 +4,8 @@
 
 #pragma once
 
-#include "sml/SML.h"
 #include "WrenHelpers.h"
+#include "WrenModuleCache.h"
 
 #ifdef SOUP_BUILD
 export
@@ -18,7 +18,13 @@ namespace Soup::Core
 		static inline const char BundleSeparator = ':';
 
 	private:
-		std::map<std::string, Path> _bundles;
+		std::shared_ptr<const WrenModuleCache::BundleMap> _bundles;
+
+		// Keep the cached module sources alive until the virtual machine has compiled them
+		std::vector<std::shared_ptr<const std::string>> _moduleSources;
+
+		// Every file read to initialize the host, used to track the inputs of an in-process generate
+		std::vector<Path> _loadedFiles;
 
 	protected:
 		Path _scriptFile;
@@ -30,6 +36,8 @@ namespace Soup::Core
 			_scriptFile(std::move(scriptFile)),
 			_bundlesFile(std::move(bundlesFile)),
 			_bundles(),
+			_moduleSources(),
+			_loadedFiles(),
 			_vm(nullptr)
 		{
 			// Configure the Wren Virtual Machine
@@ -38,6 +46,7 @@ namespace Soup::Core
 			config.resolveModuleFn = &WrenResolveModule;
 			config.loadModuleFn = &WrenLoadModule;
 			config.bindForeignMethodFn = &WrenBindForeignMethod;
+			config.bindForeignClassFn = &WrenBindForeignClass;
 			config.writeFn = &WrenWriteCallback;
 			config.errorFn = &WrenErrorCallback;
 			config.userData = this;
@@ -52,44 +61,45 @@ namespace Soup::Core
 			_vm = nullptr;
 		}
 
+		const Path& GetScriptFile() const
+		{
+			return _scriptFile;
+		}
+
+		const std::optional<Path>& GetBundlesFile() const
+		{
+			return _bundlesFile;
+		}
+
+		/// <summary>
+		/// Get the script, bundles and module files that were read by this host
+		/// </summary>
+		const std::vector<Path>& GetLoadedFiles() const
+		{
+			return _loadedFiles;
+		}
+
 		void InterpretMain()
 		{
 			// Load the bundles
 			if (_bundlesFile.has_value())
 			{
-				std::ifstream bundlesFile(_bundlesFile.value().ToString());
-				if (!bundlesFile.is_open())
+				_bundles = WrenModuleCache::Current().TryGetBundles(_bundlesFile.value());
+				if (_bundles == nullptr)
 					throw std::runtime_error("Bundles does not exist");
 
-				auto bundlesDocument = SMLDocument::Parse(bundlesFile);
-				if (!bundlesDocument.GetRoot().Contains("Bundles"))
-				{
-					throw std::runtime_error("Bundles file is missing Bundles element");
-				}
-
-				for (auto& [bundleName, bundle] : bundlesDocument.GetRoot()["Bundles"].AsTable().GetValue())
-				{
-					auto& bundleTable = bundle.AsTable();
-					if (!bundleTable.Contains("Root"))
-					{
-						throw std::runtime_error("Bundle missing Root property");
-					}
-
-					_bundles.emplace(bundleName, Path(bundleTable["Root"].AsString()));
-				}
+				_loadedFiles.push_back(_bundlesFile.value());
 			}
 
 			// Load the script
-			std::ifstream scriptFile(_scriptFile.ToString());
-			if (!scriptFile.is_open())
+			auto script = WrenModuleCache::Current().TryGetSource(_scriptFile);
+			if (script == nullptr)
 				throw std::runtime_error(std::format("Script does not exist {0}", _scriptFile.ToString()));
 
-			auto script = std::string(
-				std::istreambuf_iterator<char>(scriptFile),
-				std::istreambuf_iterator<char>());
+			_loadedFiles.push_back(_scriptFile);
 
 			// Interpret the script
-			WrenHelpers::ThrowIfFailed(wrenInterpret(_vm, _scriptFile.ToString().c_str(), script.c_str()));
+			WrenHelpers::ThrowIfFailed(wrenInterpret(_vm, _scriptFile.ToString().c_str(), script->c_str()));
 		}
 
 	private:
@@ -101,6 +111,14 @@ namespace Soup::Core
 			bool isStatic,
 			std::string_view signature) = 0;
 
+		virtual WrenForeignClassMethods TryBindForeignClass(
+			std::string_view /*moduleName*/,
+			std::string_view /*className*/)
+		{
+			// No foreign classes unless the host provides them
+			return WrenForeignClassMethods({ nullptr, nullptr });
+		}
+
 		WrenForeignMethodFn BindForeignMethod(
 			std::string_view moduleName,
 			std::string_view className,
@@ -131,15 +149,15 @@ namespace Soup::Core
 			auto bundleSeparator = moduleName.find_first_of(BundleSeparator);
 			if (bundleSeparator != std::string::npos)
 			{
-				if (!_bundlesFile.has_value())
+				if (!_bundlesFile.has_value() || _bundles == nullptr)
 				{
 					// Nothing we can do about it
 					return moduleName.data();
 				}
 
 				auto bundleName = moduleName.substr(0, bundleSeparator);
-				auto findBundle = _bundles.find(std::string(bundleName));
-				if (findBundle == _bundles.end())
+				auto findBundle = _bundles->find(std::string(bundleName));
+				if (findBundle == _bundles->end())
 				{
 					// Nothing we can do about it
 					return moduleName.data();
@@ -191,15 +209,15 @@ namespace Soup::Core
 			else
 			{
 				// Attempt to load the module as a script file
-				std::ifstream scriptFile(moduleName.data());
-				if (scriptFile.is_open())
+				auto modulePath = Path(moduleName);
+				auto script = WrenModuleCache::Current().TryGetSource(modulePath);
+				if (script != nullptr)
 				{
-					auto script = std::string(
-						std::istreambuf_iterator<char>(scriptFile),
-						std::istreambuf_iterator<char>());
-						
-					result.onComplete = &FreeSourceOnLoaded;
-					result.source = ReturnRawString(script);
+					_loadedFiles.push_back(std::move(modulePath));
+
+					// The host holds the source so the cached copy can be handed over without another allocation
+					result.source = script->c_str();
+					_moduleSources.push_back(std::move(script));
 				}
 			}
 
@@ -245,12 +263,6 @@ namespace Soup::Core
 			return rawString;
 		}
 
-		static void FreeSourceOnLoaded(WrenVM* /*vm*/, const char* /*name*/, struct WrenLoadModuleResult result)
-		{
-			if (result.source != nullptr)
-				free((void*)result.source);
-		}
-
 		static WrenForeignMethodFn WrenBindForeignMethod(
 			WrenVM* vm,
 			const char* moduleName,
@@ -262,6 +274,15 @@ namespace Soup::Core
 			return host->BindForeignMethod(moduleName, className, isStatic, signature);
 		}
 
+		static WrenForeignClassMethods WrenBindForeignClass(
+			WrenVM* vm,
+			const char* moduleName,
+			const char* className)
+		{
+			auto host = (WrenHost*)wrenGetUserData(vm);
+			return host->TryBindForeignClass(moduleName, className);
+		}
+
 		static const char* WrenResolveModule(
 			WrenVM* vm,
 			const char* importer,
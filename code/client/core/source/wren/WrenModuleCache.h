@@ -0,0 +1,151 @@
+// <copyright file="WrenModuleCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+#include "sml/SML.h"
+
+#ifdef SOUP_BUILD
+export
+#endif
+namespace Soup::Core
+{
+	/// <summary>
+	/// A process wide cache of the script sources and parsed bundles files read by the Wren hosts.
+	/// Every package built with the same extension imports the same modules, so the content is kept
+	/// keyed by the file path and reused for as long as the last write time and size do not change.
+	/// Note: Wren cannot share compiled modules between virtual machines, each host still compiles the source.
+	/// </summary>
+	class WrenModuleCache
+	{
+	public:
+		using BundleMap = std::map<std::string, Path>;
+
+	private:
+		template<typename T>
+		struct CacheEntry
+		{
+			std::chrono::time_point<std::chrono::file_clock> LastWriteTime;
+			uint64_t Size;
+			std::shared_ptr<const T> Value;
+		};
+
+		std::mutex _mutex;
+		std::map<std::string, CacheEntry<std::string>> _sources;
+		std::map<std::string, CacheEntry<BundleMap>> _bundles;
+
+	public:
+		/// <summary>
+		/// Get the cache shared by every host in the process
+		/// </summary>
+		static WrenModuleCache& Current()
+		{
+			static WrenModuleCache cache;
+			return cache;
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="WrenModuleCache"/> class.
+		/// </summary>
+		WrenModuleCache() :
+			_mutex(),
+			_sources(),
+			_bundles()
+		{
+		}
+
+		WrenModuleCache(const WrenModuleCache&) = delete;
+		WrenModuleCache& operator=(const WrenModuleCache&) = delete;
+
+		/// <summary>
+		/// Get the source for a script file, returns null if the file does not exist
+		/// </summary>
+		std::shared_ptr<const std::string> TryGetSource(const Path& file)
+		{
+			return TryGetOrLoad<std::string>(
+				_sources,
+				file,
+				[](std::istream& stream)
+				{
+					return std::string(
+						std::istreambuf_iterator<char>(stream),
+						std::istreambuf_iterator<char>());
+				});
+		}
+
+		/// <summary>
+		/// Get the bundle roots declared in a bundles file, returns null if the file does not exist
+		/// </summary>
+		std::shared_ptr<const BundleMap> TryGetBundles(const Path& file)
+		{
+			return TryGetOrLoad<BundleMap>(
+				_bundles,
+				file,
+				[](std::istream& stream)
+				{
+					auto bundlesDocument = SMLDocument::Parse(stream);
+					if (!bundlesDocument.GetRoot().Contains("Bundles"))
+					{
+						throw std::runtime_error("Bundles file is missing Bundles element");
+					}
+
+					auto bundles = BundleMap();
+					for (auto& [bundleName, bundle] : bundlesDocument.GetRoot()["Bundles"].AsTable().GetValue())
+					{
+						auto& bundleTable = bundle.AsTable();
+						if (!bundleTable.Contains("Root"))
+						{
+							throw std::runtime_error("Bundle missing Root property");
+						}
+
+						bundles.emplace(bundleName, Path(bundleTable["Root"].AsString()));
+					}
+
+					return bundles;
+				});
+		}
+
+	private:
+		template<typename T, typename TLoad>
+		std::shared_ptr<const T> TryGetOrLoad(
+			std::map<std::string, CacheEntry<T>>& entries,
+			const Path& file,
+			TLoad load)
+		{
+			auto& fileSystem = System::IFileSystem::Current();
+			std::chrono::time_point<std::chrono::file_clock> lastWriteTime;
+			if (!fileSystem.TryGetLastWriteTime(file, lastWriteTime))
+				return nullptr;
+
+			std::shared_ptr<System::IInputFile> inputFile;
+			if (!fileSystem.TryOpenRead(file, true, inputFile))
+				return nullptr;
+
+			// The size catches a rewrite that lands within the write time resolution of the file system
+			auto& stream = inputFile->GetInStream();
+			stream.seekg(0, std::ios::end);
+			auto size = static_cast<uint64_t>(stream.tellg());
+			stream.seekg(0, std::ios::beg);
+
+			auto key = file.ToString();
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				auto findResult = entries.find(key);
+				if (findResult != entries.end() &&
+					findResult->second.LastWriteTime == lastWriteTime &&
+					findResult->second.Size == size)
+				{
+					return findResult->second.Value;
+				}
+			}
+
+			// Load outside of the lock, a concurrent miss for the same file only costs a second read
+			auto value = std::make_shared<const T>(load(stream));
+
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			entries.insert_or_assign(key, CacheEntry<T>({ lastWriteTime, size, value }));
+			return value;
+		}
+	};
+}
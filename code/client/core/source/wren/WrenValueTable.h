@@ -22,6 +22,13 @@ namespace Soup::Core
 	class WrenValueTable
 	{
 	public:
+		/// <summary>
+		/// The kinds of change recorded for a single key in a table change set
+		/// </summary>
+		static constexpr int SetValueChange = 0;
+		static constexpr int RemoveValueChange = 1;
+		static constexpr int UpdateTableChange = 2;
+
 		static void SetSlotTable(WrenVM* vm, int slot, const ValueTable& table)
 		{
 			// Assume lower slots are in use
@@ -139,6 +146,82 @@ namespace Soup::Core
 			return result;
 		}
 
+		/// <summary>
+		/// Apply a change set to an existing table so only the modified entries are converted.
+		/// The change set is a map from key to a list with the change kind followed by the new value
+		/// for a set or the nested change set for a table update.
+		/// </summary>
+		static void ApplySlotTableChanges(WrenVM* vm, int slot, ValueTable& table)
+		{
+			int mapSlot = slot;
+			int keySlot = slot + 1;
+			int changeSlot = slot + 2;
+			int valueSlot = slot + 3;
+
+			auto mapType = wrenGetSlotType(vm, mapSlot);
+			if (mapType != WREN_TYPE_MAP) {
+				throw std::runtime_error("Changes must be a map");
+			}
+
+			wrenEnsureSlots(vm, slot + 4);
+			auto mapCount = wrenGetMapCount(vm, mapSlot);
+			for (auto i = 0; i < mapCount; i++)
+			{
+				wrenGetMapKeyValueAt(vm, mapSlot, i, keySlot, changeSlot);
+
+				auto keyType = wrenGetSlotType(vm, keySlot);
+				if (keyType != WREN_TYPE_STRING) {
+					auto stringBuilder = std::stringstream();
+					stringBuilder << "KEY[" << i << "]";
+					throw InvalidTypeException(stringBuilder.str());
+				}
+
+				auto key = std::string(wrenGetSlotString(vm, keySlot));
+				if (wrenGetSlotType(vm, changeSlot) != WREN_TYPE_LIST || wrenGetListCount(vm, changeSlot) < 1)
+					throw std::runtime_error("Change must be a list");
+
+				wrenGetListElement(vm, changeSlot, 0, valueSlot);
+				auto changeKind = static_cast<int>(wrenGetSlotDouble(vm, valueSlot));
+				try
+				{
+					switch (changeKind)
+					{
+						case SetValueChange:
+						{
+							wrenGetListElement(vm, changeSlot, 1, valueSlot);
+							table.insert_or_assign(key, GetSlotValue(vm, valueSlot));
+							break;
+						}
+						case RemoveValueChange:
+						{
+							table.erase(key);
+							break;
+						}
+						case UpdateTableChange:
+						{
+							auto findResult = table.find(key);
+							if (findResult == table.end() || findResult->second.GetType() != ValueType::Table)
+								throw std::runtime_error("Updated value must be an existing table");
+
+							// The nested changes only use the slots above the current value
+							wrenGetListElement(vm, changeSlot, 1, valueSlot);
+							ApplySlotTableChanges(vm, valueSlot, findResult->second.AsTable());
+							break;
+						}
+						default:
+							throw std::runtime_error("Unknown table change.");
+					}
+				}
+				catch(const InvalidTypeException& exception)
+				{
+					// Unwrap the type error
+					auto stringBuilder = std::stringstream();
+					stringBuilder << "[" << key << "]" << exception.what();
+					throw InvalidTypeException(stringBuilder.str());
+				}
+			}
+		}
+
 		static ValueList GetSlotList(WrenVM* vm, int slot)
 		{
 			int listSlot = slot;
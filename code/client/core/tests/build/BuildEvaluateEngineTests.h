@@ -57,7 +57,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsFalse(ranOperations, "Verify no operations ran");
 
@@ -153,7 +154,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -218,6 +220,153 @@ namespace Soup::Core::UnitTests
 				"Verify monitor process manager requests match expected.");
 		}
 
+		// [[Fact]]
+		void Execute_OneOperation_ImmutableRootInput_TracksDirectoriesAndExecutable()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileRead(Path("./InputFile2.in"), true, false);
+					monitor.TouchFileRead(Path("C:/Toolchain/include/stdio.h"), true, false);
+					monitor.TouchFileRead(Path("C:/Toolchain/include/missing.h"), false, false);
+					monitor.TouchFileWrite(Path("./OutputFile2.out"), false);
+				});
+
+			// Setup the input build state
+			auto immutableRoots = std::vector<Path>({
+				Path("C:/Toolchain/"),
+			});
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				1,
+				fileSystemState,
+				nullptr,
+				immutableRoots);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 4, 5, 6, },
+							{ 7, })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// The reads under the root collapse to the directory that held them
+			Assert::AreEqual(
+				Path("C:/Toolchain/include/"),
+				fileSystemState.GetFilePath(5),
+				"Verify immutable directory file id.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
 		// [[Fact]]
 		void Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput()
 		{
@@ -284,7 +433,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -419,7 +569,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -563,7 +714,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -710,7 +862,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -857,7 +1010,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -1004,7 +1158,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsTrue(ranOperations, "Verify ran operations");
 
@@ -1148,7 +1303,8 @@ namespace Soup::Core::UnitTests
 				operationResults,
 				temporaryDirectory,
 				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
+				globalAllowedWriteAccess,
+				nullptr);
 
 			Assert::IsFalse(ranOperations, "Verify did not run operations");
 
@@ -1189,42 +1345,51 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Execute_TwoOperations_DuplicateOutputFile_Fails()
+		void Evaluate_OneOperation_Incremental_ContentDigest_NewWriteTime_UpToDate()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
 			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
 
-			// Register the test system
-			auto system = std::make_shared<MockSystem>();
-			auto scopedSystem = ScopedSystemRegister(system);
+			// Setup the input to be rewritten after the output with the same content
+			auto executableTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
 
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/InputFile.in"))->Content = std::stringstream("Input");
+
 			auto fileSystemState = FileSystemState(
 				3,
 				std::unordered_map<FileId, Path>({
-					{ 1, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, outputTime },
+					{ 3, executableTime },
 				}));
 
-			// Register the test process manager
-			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
-			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
-
-			monitorProcessManager->RegisterExecuteCallback(
-				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-				[](Monitor::ISystemAccessMonitor& monitor)
-				{
-					monitor.TouchFileWrite(Path("./OutputFile.out"), false);
-				});
-
 			// Setup the input build state
+			auto fileDigestCache = FileDigestCache();
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
 				false,
-				fileSystemState);
+				1,
+				fileSystemState,
+				&fileDigestCache);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1235,92 +1400,1255 @@ namespace Soup::Core::UnitTests
 						"TestCommand: 1",
 						CommandInfo(
 							Path("C:/TestWorkingDirectory/"),
-							Path("./Command1.exe"),
-							{ "Arguments" }),
-						{ },
-						{ },
-						{ },
-						{ },
-						{ 2 },
-						1),
-					OperationInfo(
-						2,
-						"TestCommand: 2",
-						CommandInfo(
-							Path("C:/TestWorkingDirectory/"),
-							Path("./Command2.exe"),
+							Path("./Command.exe"),
 							{ "Arguments" }),
-						{ },
 						{ 1, },
+						{ 2, },
 						{ },
 						{ },
 						{ },
 						1),
 				});
-			auto operationResults = OperationResults();
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						{ 1, },
+						{ 2, },
+						{ ContentHash::Compute("Input"), })
+				},
+			});
 			auto temporaryDirectory = Path();
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
 
-			auto exception = Assert::Throws<std::runtime_error>([&]()
-			{
-				auto ranOperations = uut.Evaluate(
-					operationGraph,
-					operationResults,
-					temporaryDirectory,
-					globalAllowedReadAccess,
-					globalAllowedWriteAccess);
-				(void)ranOperations;
-			});
-
-			Assert::AreEqual<std::string_view>(
-				"File \"C:/TestWorkingDirectory/OutputFile.out\" observed as output for operation \"TestCommand: 1\" was already written by operation \"TestCommand: 2\"",
-				exception.what(),
-				"Verify Exception message");
-
-			// Verify operation results
-			Assert::AreEqual(
-				std::map<OperationId, OperationResult>(),
-				operationResults.GetResults(),
-				"Verify operation results match expected.");
+			Assert::IsFalse(ranOperations, "Verify did not run operations");
 
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Operation has no successful previous invocation",
-					"HIGH: TestCommand: 1",
-					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
-					"DIAG: Allowed Read Access:",
-					"DIAG: Allowed Write Access:",
+					"INFO: Up to date",
+					"INFO: TestCommand: 1",
+					"DIAG: Build evaluation end",
 				}),
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
+		}
 
-			// Verify expected system requests
-			Assert::AreEqual(
-				std::vector<std::string>({
-					"GetCurrentTime",
-				}),
-				system->GetRequests(),
-				"Verify system requests match expected.");
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_ContentDigest_ChangedContent_OutOfDate()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
 
-			// Verify expected file system requests
-			Assert::AreEqual(
-				std::vector<std::string>({}),
-				fileSystem->GetRequests(),
-				"Verify file system requests match expected.");
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
 
-			// Verify expected process requests
-			Assert::AreEqual(
-				std::vector<std::string>({
-					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-					"ProcessStart: 1",
-					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
-					"GetExitCode: 1",
+			// Setup the input to keep an older write time than the output with new content
+			auto executableTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/InputFile.in"))->Content = std::stringstream("Updated Input");
+
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, outputTime },
+					{ 3, executableTime },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileRead(Path("./InputFile.in"), true, false);
+					monitor.TouchFileWrite(Path("./OutputFile.out"), false);
+				});
+
+			// Setup the input build state
+			auto fileDigestCache = FileDigestCache();
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				1,
+				fileSystemState,
+				&fileDigestCache);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						{ 1, },
+						{ 2, },
+						{ ContentHash::Compute("Input"), })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results record the new content
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 1, },
+							{ 2, },
+							{ ContentHash::Compute("Updated Input"), })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Input content altered after last evaluate [C:/TestWorkingDirectory/InputFile.in]",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_TwoOperations_Incremental_UnchangedParentOutput_SkipsChild()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Setup the parent input to be newer than its output and the child to be built after the parent output
+			auto executableTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 0min);
+			auto generatedTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 15min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 20min);
+			auto rewriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 30min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/InputFile.in"))->Content = std::stringstream("Input");
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/Generated.h"),
+				std::make_shared<MockFile>(generatedTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/Generated.h"))->Content = std::stringstream("#define VALUE 1");
+
+			auto fileSystemState = FileSystemState(
+				5,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/Generated.h") },
+					{ 3, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 4, Path("C:/TestWorkingDirectory/Command1.exe") },
+					{ 5, Path("C:/TestWorkingDirectory/Command2.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, generatedTime },
+					{ 3, outputTime },
+					{ 4, executableTime },
+					{ 5, executableTime },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// The parent rewrites the generated file with the same content
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[&fileSystem, rewriteTime](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileRead(Path("./InputFile.in"), true, false);
+					monitor.TouchFileWrite(Path("./Generated.h"), false);
+					fileSystem->SetLastWriteTime(Path("C:/TestWorkingDirectory/Generated.h"), rewriteTime);
+				});
+
+			// Setup the input build state
+			auto fileDigestCache = FileDigestCache();
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				1,
+				fileSystemState,
+				&fileDigestCache);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ 2, },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ 2, },
+						{ 3, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 12min),
+						{ 1, },
+						{ 2, })
+				},
+				{
+					2,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 16min),
+						{ 2, },
+						{ 3, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results, the child is upgraded to content digests
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 1, },
+							{ 2, },
+							{ ContentHash::Compute("Input"), })
+					},
+					{
+						2,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 16min),
+							{ 2, },
+							{ 3, },
+							{ ContentHash::Compute("#define VALUE 1"), })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Input altered after target [C:/TestWorkingDirectory/InputFile.in] -> [C:/TestWorkingDirectory/Generated.h]",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Output unchanged: C:/TestWorkingDirectory/Generated.h",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Inputs unchanged after parent rebuild",
+					"INFO: Up to date",
+					"INFO: TestCommand: 2",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify the child never ran
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_TwoOperations_Incremental_UnchangedParentOutput_ChildOlderThanPreviousOutput_RunsChild()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Setup the generated file to be written by an earlier build that failed before the child ran
+			auto executableTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 0min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 5min);
+			auto generatedTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 20min);
+			auto rewriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 30min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/InputFile.in"))->Content = std::stringstream("Input");
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/Generated.h"),
+				std::make_shared<MockFile>(generatedTime));
+			fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/Generated.h"))->Content = std::stringstream("#define VALUE 2");
+
+			auto fileSystemState = FileSystemState(
+				5,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/Generated.h") },
+					{ 3, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 4, Path("C:/TestWorkingDirectory/Command1.exe") },
+					{ 5, Path("C:/TestWorkingDirectory/Command2.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, generatedTime },
+					{ 3, outputTime },
+					{ 4, executableTime },
+					{ 5, executableTime },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// The parent rewrites the generated file with the same content
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[&fileSystem, rewriteTime](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileRead(Path("./InputFile.in"), true, false);
+					monitor.TouchFileWrite(Path("./Generated.h"), false);
+					fileSystem->SetLastWriteTime(Path("C:/TestWorkingDirectory/Generated.h"), rewriteTime);
+				});
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileRead(Path("./Generated.h"), true, false);
+					monitor.TouchFileWrite(Path("./OutputFile.out"), false);
+				});
+
+			// Setup the input build state
+			auto fileDigestCache = FileDigestCache();
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				1,
+				fileSystemState,
+				&fileDigestCache);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ 2, },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ 2, },
+						{ 3, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 12min),
+						{ 1, },
+						{ 2, })
+				},
+				{
+					2,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 6min),
+						{ 2, },
+						{ 3, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 1, },
+							{ 2, },
+							{ ContentHash::Compute("Input"), })
+					},
+					{
+						2,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 2, },
+							{ 3, },
+							{ ContentHash::Compute("#define VALUE 2"), })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Input altered after target [C:/TestWorkingDirectory/InputFile.in] -> [C:/TestWorkingDirectory/Generated.h]",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Output unchanged: C:/TestWorkingDirectory/Generated.h",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Input altered after target [C:/TestWorkingDirectory/Generated.h] -> [C:/TestWorkingDirectory/OutputFile.out]",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify the child ran against the rewritten content
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 2",
+					"WaitForExit: 2",
+					"GetStandardOutput: 2",
+					"GetStandardError: 2",
+					"GetExitCode: 2",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_WriteFile_UnchangedContent_SkipsWrite()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system with the file already holding the content
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/Generated.txt"),
+				std::make_shared<MockFile>(std::stringstream("Content")));
+			auto fileSystemState = FileSystemState();
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"WriteFile: ./Generated.txt",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./writefile.exe"),
+							{ "./Generated.txt", "Content" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ 1, })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: WriteFile: ./Generated.txt",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./writefile.exe ./Generated.txt Content",
+					"INFO: Execute InProcess WriteFile",
+					"INFO: WritFile: ./Generated.txt",
+					"INFO: WriteFile content unchanged",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify the file was only read
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenRead: C:/TestWorkingDirectory/Generated.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			Assert::AreEqual(
+				std::string("Content"),
+				fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/Generated.txt"))->Content.str(),
+				"Verify the file content is unchanged.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_DuplicateOutputFile_Fails()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/OutputFile.out") },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					monitor.TouchFileWrite(Path("./OutputFile.out"), false);
+				});
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ 2 },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ 1, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto ranOperations = uut.Evaluate(
+					operationGraph,
+					operationResults,
+					temporaryDirectory,
+					globalAllowedReadAccess,
+					globalAllowedWriteAccess,
+					nullptr);
+				(void)ranOperations;
+			});
+
+			Assert::AreEqual<std::string_view>(
+				"File \"C:/TestWorkingDirectory/OutputFile.out\" observed as output for operation \"TestCommand: 1\" was already written by operation \"TestCommand: 2\"",
+				exception.what(),
+				"Verify Exception message");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_Parallel_RespectsDependencies()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				4,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ 2 },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+					{
+						2,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 2",
+					"WaitForExit: 2",
+					"GetStandardOutput: 2",
+					"GetStandardError: 2",
+					"GetExitCode: 2",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_WideGraph_Parallel_RespectsDependencies()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				4,
+				fileSystemState);
+
+			// A single root that fans out to eight independent operations that all feed a final operation
+			auto createOperation = [](
+				OperationId operationId,
+				std::vector<OperationId> children,
+				uint32_t dependencyCount)
+			{
+				return OperationInfo(
+					operationId,
+					std::format("TestCommand: {}", operationId),
+					CommandInfo(
+						Path("C:/TestWorkingDirectory/"),
+						Path(std::format("./Command{}.exe", operationId)),
+						{ "Arguments" }),
+					{ },
+					{ },
+					{ },
+					{ },
+					std::move(children),
+					dependencyCount);
+			};
+
+			auto operations = std::vector<OperationInfo>();
+			operations.push_back(createOperation(1, { 2, 3, 4, 5, 6, 7, 8, 9 }, 1));
+			for (OperationId operationId = 2; operationId <= 9; operationId++)
+				operations.push_back(createOperation(operationId, { 10 }, 1));
+			operations.push_back(createOperation(10, { }, 8));
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph({ 1, }, std::move(operations));
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				nullptr);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			auto expectedResults = std::map<OperationId, OperationResult>();
+			for (OperationId operationId = 1; operationId <= 10; operationId++)
+			{
+				expectedResults.emplace(
+					operationId,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ }));
+			}
+
+			Assert::AreEqual(
+				expectedResults,
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// The workers may run the independent operations in any order,
+			// but the root must run first and the final operation last
+			auto executedCommands = std::vector<std::string>();
+			for (auto& request : monitorProcessManager->GetRequests())
+			{
+				if (request.starts_with("CreateMonitorProcess: "))
+				{
+					auto commandStart = request.find("./Command");
+					auto commandEnd = request.find(' ', commandStart);
+					executedCommands.push_back(request.substr(commandStart, commandEnd - commandStart));
+				}
+			}
+
+			Assert::AreEqual<size_t>(10, executedCommands.size(), "Verify every operation executed once.");
+			Assert::AreEqual<std::string>("./Command1.exe", executedCommands.front(), "Verify the root ran first.");
+			Assert::AreEqual<std::string>("./Command10.exe", executedCommands.back(), "Verify the final operation ran last.");
+
+			std::sort(executedCommands.begin(), executedCommands.end());
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"./Command1.exe",
+					"./Command10.exe",
+					"./Command2.exe",
+					"./Command3.exe",
+					"./Command4.exe",
+					"./Command5.exe",
+					"./Command6.exe",
+					"./Command7.exe",
+					"./Command8.exe",
+					"./Command9.exe",
+				}),
+				executedCommands,
+				"Verify executed commands match expected.");
+
+			// Verify the evaluation completed
+			auto& messages = testListener->GetMessages();
+			Assert::AreEqual<std::string>("DIAG: Build evaluation start", messages.front(), "Verify first message.");
+			Assert::AreEqual<std::string>("DIAG: Build evaluation end", messages.back(), "Verify last message.");
+		}
+
+		// [[Fact]]
+		void Execute_WideGraph_Parallel_FailureStopsScheduling()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor&)
+				{
+					throw std::runtime_error("Command1 failed");
+				});
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				4,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ 2, 3, },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+					OperationInfo(
+						3,
+						"TestCommand: 3",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command3.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto ranOperations = uut.Evaluate(
+					operationGraph,
+					operationResults,
+					temporaryDirectory,
+					globalAllowedReadAccess,
+					globalAllowedWriteAccess,
+					nullptr);
+				(void)ranOperations;
+			});
+
+			Assert::AreEqual<std::string_view>(
+				"Command1 failed",
+				exception.what(),
+				"Verify Exception message");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify the children of the failed operation never ran
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 				}),
 				monitorProcessManager->GetRequests(),
 				"Verify monitor process manager requests match expected.");
@@ -1407,7 +2735,8 @@ namespace Soup::Core::UnitTests
 					operationResults,
 					temporaryDirectory,
 					globalAllowedReadAccess,
-					globalAllowedWriteAccess);
+					globalAllowedWriteAccess,
+					nullptr);
 				(void)ranOperations;
 			});
 
@@ -1545,7 +2874,8 @@ namespace Soup::Core::UnitTests
 					operationResults,
 					temporaryDirectory,
 					globalAllowedReadAccess,
-					globalAllowedWriteAccess);
+					globalAllowedWriteAccess,
+					nullptr);
 				(void)ranOperations;
 			});
 
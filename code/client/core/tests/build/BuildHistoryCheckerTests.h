@@ -309,6 +309,114 @@ namespace Soup::Core::UnitTests
 				"Verify log messages match expected.");
 		}
 
+		// [[Fact]]
+		void IsOutdated_SingleInput_TargetExists_UnchangedInput()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Create the file state
+			auto previousInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto unchangedInputFiles = std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>({
+				{ 2, previousInputTime },
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsOutdated(targetFiles, inputFiles, unchangedInputFiles);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void IsOutdated_SingleInput_TargetExists_UnchangedInput_PreviousContentNewerThanTarget()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Create the file state, the previous content was written by a build that never updated the target
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto previousInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto unchangedInputFiles = std::unordered_map<FileId, std::chrono::time_point<std::chrono::file_clock>>({
+				{ 2, previousInputTime },
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsOutdated(targetFiles, inputFiles, unchangedInputFiles);
+
+			// Verify the results
+			Assert::IsTrue(result, "Verify the result is true.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Input altered after target [C:/Root/Input.cpp] -> [C:/Root/Output.bin]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
 		// [[Fact]]
 		void IsOutdated_SingleInput_TargetExists_UpToDate()
 		{
@@ -407,5 +515,188 @@ namespace Soup::Core::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 		}
+
+		// [[Fact]]
+		void IsOutdated_SharedBase_RefreshedAfterWrite()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system, the header is deleted when its write time is reloaded
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Create the file state
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				4,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+					{ 3, Path("C:/Input.h") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+					{ 3, inputTime },
+				}));
+
+			// Setup the input parameters with the files in a shared base
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = InputSet(
+				std::make_shared<const std::vector<FileId>>(std::vector<FileId>({ 2, 3 })),
+				std::vector<FileId>());
+
+			// Perform the check before and after a write to a file in the base
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool initialResult = uut.IsOutdated(targetFiles, inputFiles);
+			bool unchangedResult = uut.IsOutdated(targetFiles, inputFiles);
+			fileSystemState.InvalidateFileWriteTimes({ 3 });
+			bool updatedResult = uut.IsOutdated(targetFiles, inputFiles);
+
+			// Verify the results
+			Assert::IsFalse(initialResult, "Verify the initial result is false.");
+			Assert::IsFalse(unchangedResult, "Verify the unchanged result is false.");
+			Assert::IsTrue(updatedResult, "Verify the updated result is true.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Input Missing [C:/Input.h]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void IsContentOutdated_SameContent_NewWriteTime()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Create the file state with the input rewritten after the target
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto inputDigests = std::vector<uint64_t>({
+				ContentHash::Compute("int main() { return 0; }"),
+			});
+
+			// Perform the check
+			auto fileDigestCache = FileDigestCache();
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsContentOutdated(targetFiles, inputFiles, inputDigests, fileDigestCache);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void IsContentOutdated_ChangedContent()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Create the file state with the input older than the target
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(inputTime));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 1; }");
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto inputDigests = std::vector<uint64_t>({
+				ContentHash::Compute("int main() { return 0; }"),
+			});
+
+			// Perform the check
+			auto fileDigestCache = FileDigestCache();
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsContentOutdated(targetFiles, inputFiles, inputDigests, fileDigestCache);
+
+			// Verify the results
+			Assert::IsTrue(result, "Verify the result is true.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Input content altered after last evaluate [C:/Root/Input.cpp]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
 	};
 }
@@ -178,6 +178,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
@@ -534,6 +535,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.boj",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
@@ -549,6 +551,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
@@ -819,6 +822,244 @@ namespace Soup::Core::UnitTests
 				"Verify my package generate results content match expected.");
 		}
 
+		// [[Fact]]
+		void Execute_IndependentDependencies_ParallelPackages()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				0,
+				{},
+				TestHelpers::BuildDirectoryLookup({
+					Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml"),
+					Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml"),
+					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
+				}),
+				{});
+
+			auto targetDirectories = std::vector<Path>({
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+			});
+			for (auto& targetDirectory : targetDirectories)
+			{
+				fileSystem->CreateMockDirectory(
+					targetDirectory,
+					std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+				auto operationGraph = OperationGraph(
+					std::vector<OperationId>(),
+					std::vector<OperationInfo>());
+				auto operationGraphFiles = std::set<FileId>();
+				auto operationGraphContent = std::stringstream();
+				OperationGraphWriter::Serialize(operationGraph, operationGraphFiles, fileSystemState, operationGraphContent);
+				fileSystem->CreateMockFile(
+					targetDirectory + Path("./.soup/Evaluate.bog"),
+					std::make_shared<MockFile>(std::move(operationGraphContent)));
+			}
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			auto arguments = RecipeBuildArguments();
+			arguments.HostPlatform = "TestPlatform";
+			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
+			arguments.MaxParallelPackages = 2;
+			auto userDataPath = Path("C:/Users/Me/.soup/");
+			auto systemReadAccess = std::vector<Path>({
+				Path("C:/FakeSystem/"),
+			});
+			auto recipeCache = RecipeCache({
+				{
+					"C:/WorkingDirectory/MyPackage/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "MyPackage" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "User1|PackageA@1.2.3", "User1|PackageB@1.1.1" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageA" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.2.3" },
+					}))
+				},
+				{
+					"C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageB" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.1.1" },
+					}))
+				},
+			});
+			auto packageProvider = PackageProvider(
+				1,
+				PackageGraphLookupMap(
+				{
+					{
+						1,
+						PackageGraph(
+							1,
+							1,
+							ValueTable(
+							{
+								{ "ArgumentValue", Value(true) },
+							}))
+					},
+				}),
+				PackageLookupMap(
+				{
+					{
+						1,
+						PackageInfo(
+							1,
+							PackageName(std::nullopt, "MyPackage"),
+							false,
+							Path("C:/WorkingDirectory/MyPackage/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageA", SemanticVersion(1, 2, 3)), false, 2, -1),
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageB", SemanticVersion(1, 1, 1)), false, 3, -1),
+									}
+								},
+							}))
+					},
+					{
+						2,
+						PackageInfo(
+							2,
+							PackageName("User1", "PackageA"),
+							false,
+							Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml")),
+							PackageChildrenMap())
+					},
+					{
+						3,
+						PackageInfo(
+							3,
+							PackageName("User1", "PackageB"),
+							false,
+							Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml")),
+							PackageChildrenMap())
+					},
+				}));
+			auto evaluateEngine = MockEvaluateEngine();
+			auto knownLanguages = std::map<std::string, KnownLanguage>();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto uut = BuildRunner(
+				arguments,
+				userDataPath,
+				systemReadAccess,
+				recipeCache,
+				packageProvider,
+				evaluateEngine,
+				fileSystemState,
+				locationManager);
+			uut.Execute();
+
+			// The independent packages may interleave in any order, but both must complete before
+			// the package that depends on them starts
+			auto messages = testListener->GetMessages();
+			auto myPackageStart = std::find(
+				messages.begin(),
+				messages.end(),
+				"DIAG: 1>Running Build: [C++]MyPackage");
+			Assert::IsTrue(myPackageStart != messages.end(), "Verify my package was built.");
+			auto completedDependencyCount = static_cast<int>(
+				std::count(messages.begin(), myPackageStart, "INFO: 0>Done") +
+				std::count(messages.begin(), myPackageStart, "INFO: 2>Done") +
+				std::count(messages.begin(), myPackageStart, "INFO: 3>Done"));
+			Assert::AreEqual(
+				2,
+				completedDependencyCount,
+				"Verify both dependencies completed before my package started.");
+			Assert::AreEqual(
+				std::string("INFO: 1>Done"),
+				messages.back(),
+				"Verify my package completed last.");
+
+			// Each package evaluates its own graph exactly once and the dependent package evaluates last
+			auto evaluateRequests = evaluateEngine.GetRequests();
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+				}),
+				std::vector<std::string>(evaluateRequests.end() - 2, evaluateRequests.end()),
+				"Verify my package evaluated last.");
+			std::sort(evaluateRequests.begin(), evaluateRequests.end());
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+				}),
+				evaluateRequests,
+				"Verify evaluate requests match expected.");
+
+			// Verify the shared build cache handed both dependency results to the dependent package
+			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			auto myPackageGenerateInput = ValueTableReader::Deserialize(myPackageGenerateInputMockFile->Content);
+			Assert::AreEqual(
+				Value(ValueTable(
+				{
+					{
+						"Runtime",
+						ValueTable(
+						{
+							{
+								"User1|PackageA",
+								ValueTable(
+								{
+									{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
+								})
+							},
+							{
+								"User1|PackageB",
+								ValueTable(
+								{
+									{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
+								})
+							},
+						})
+					},
+				})),
+				myPackageGenerateInput.at("Dependencies"),
+				"Verify my package dependencies match expected.");
+		}
+
 		// [[Fact]]
 		void Execute_TriangleDependency_NoRebuild()
 		{
@@ -1112,6 +1353,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/packages/C++/User1/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/packages/C++/RootRecipe.sml",
@@ -1133,6 +1375,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
@@ -1148,6 +1391,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
@@ -1846,6 +2090,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.boj",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
@@ -1861,6 +2106,7 @@ namespace Soup::Core::UnitTests
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.boj",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
@@ -0,0 +1,237 @@
+// <copyright file="FileDigestCacheTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class FileDigestCacheTests
+	{
+	public:
+		// [[Fact]]
+		void TryGetDigest_MissingFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = FileDigestCache();
+			uint64_t digest = 0;
+			auto result = uut.TryGetDigest(Path("C:/Root/Input.cpp"), digest);
+
+			Assert::IsFalse(result, "Verify result is false.");
+			Assert::IsFalse(uut.IsModified(), "Verify cache is not modified.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryGetDigest_Miss_HashesContent()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Larger than a single hash stripe to cover the streamed lanes
+			auto content = std::string("int main() { return 0; } // Nobody inspects the spammish repetition");
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream(content);
+
+			auto uut = FileDigestCache();
+			uint64_t digest = 0;
+			auto result = uut.TryGetDigest(Path("C:/Root/Input.cpp"), digest);
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual(ContentHash::Compute(content), digest, "Verify digest matches the content.");
+			Assert::IsTrue(uut.IsModified(), "Verify cache is modified.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryGetDigest_Hit_SkipsContent()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			auto uut = FileDigestCache();
+			uint64_t firstDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), firstDigest), "Verify first result is true.");
+
+			// Replace the content without changing the write time or size
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 1; }");
+
+			uint64_t secondDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), secondDigest), "Verify second result is true.");
+			Assert::AreEqual(firstDigest, secondDigest, "Verify the cached digest was used.");
+
+			// Verify the file is opened to check the size
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryGetDigest_ChangedSize_SameWriteTime_Rehashes()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			auto uut = FileDigestCache();
+			uint64_t firstDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), firstDigest), "Verify first result is true.");
+
+			// Rewrite the file within the same write time
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 10; }");
+
+			uint64_t secondDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), secondDigest), "Verify second result is true.");
+			Assert::AreEqual(ContentHash::Compute("int main() { return 10; }"), secondDigest, "Verify digest matches the new content.");
+		}
+
+		// [[Fact]]
+		void TryGetDigest_RecentWriteTime_NotCached()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// The file was just written, another write may land without changing the write time
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::chrono::file_clock::now()));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			auto uut = FileDigestCache();
+			uint64_t firstDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), firstDigest), "Verify first result is true.");
+			Assert::AreEqual(ContentHash::Compute("int main() { return 0; }"), firstDigest, "Verify digest matches the content.");
+			Assert::IsFalse(uut.IsModified(), "Verify the digest was not cached.");
+
+			// Rewrite the file without changing the write time or size
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 1; }");
+
+			uint64_t secondDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), secondDigest), "Verify second result is true.");
+			Assert::AreEqual(ContentHash::Compute("int main() { return 1; }"), secondDigest, "Verify digest matches the new content.");
+		}
+
+		// [[Fact]]
+		void TryGetDigest_ChangedWriteTime_Rehashes()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			auto uut = FileDigestCache();
+			uint64_t firstDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), firstDigest), "Verify first result is true.");
+
+			// Update the file
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 1; }");
+			fileSystem->SetLastWriteTime(
+				Path("C:/Root/Input.cpp"),
+				std::chrono::clock_cast<std::chrono::file_clock>(
+					std::chrono::sys_days(May/22/2015) + 9h + 12min));
+
+			uint64_t secondDigest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), secondDigest), "Verify second result is true.");
+			Assert::AreEqual(ContentHash::Compute("int main() { return 1; }"), secondDigest, "Verify digest matches the new content.");
+			Assert::AreNotEqual(firstDigest, secondDigest, "Verify digests do not match.");
+
+			// Verify the contents were read again
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+					"SetLastWriteTime: C:/Root/Input.cpp",
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void SaveState_RoundTrip()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 0; }");
+
+			auto original = FileDigestCache();
+			uint64_t originalDigest = 0;
+			Assert::IsTrue(original.TryGetDigest(Path("C:/Root/Input.cpp"), originalDigest), "Verify original result is true.");
+			original.SaveState(Path("C:/Root/.soup/FileDigests.bin"));
+			Assert::IsFalse(original.IsModified(), "Verify saved cache is not modified.");
+
+			// Reload the saved state from the written file
+			auto savedContent = fileSystem->GetMockFile(Path("C:/Root/.soup/FileDigests.bin"))->Content.str();
+			fileSystem->CreateMockFile(
+				Path("C:/Root/.soup/LoadFileDigests.bin"),
+				std::make_shared<MockFile>(std::stringstream(savedContent)));
+
+			auto uut = FileDigestCache();
+			Assert::IsTrue(uut.TryLoadState(Path("C:/Root/.soup/LoadFileDigests.bin")), "Verify load result is true.");
+
+			uint64_t digest = 0;
+			Assert::IsTrue(uut.TryGetDigest(Path("C:/Root/Input.cpp"), digest), "Verify result is true.");
+			Assert::AreEqual(originalDigest, digest, "Verify digest matches.");
+			Assert::IsFalse(uut.IsModified(), "Verify loaded digest was reused.");
+		}
+	};
+}
@@ -13,6 +13,7 @@ namespace Soup::Core
 	{
 	private:
 		std::atomic<int> m_uniqueId;
+		std::mutex _mutex;
 		std::vector<std::string> _requests;
 
 	public:
@@ -39,11 +40,13 @@ namespace Soup::Core
 			OperationResults& operationResults,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& /*globalAllowedReadAccess*/,
-			const std::vector<Path>& /*globalAllowedWriteAccess*/)
+			const std::vector<Path>& /*globalAllowedWriteAccess*/,
+			OperationResultsJournal* /*operationResultsJournal*/)
 		{
 			std::stringstream message;
 			message << "Evaluate: " << temporaryDirectory.ToString();
 
+			auto lock = std::lock_guard<std::mutex>(_mutex);
 			_requests.push_back(message.str());
 
 			auto time = std::chrono::clock_cast<std::chrono::file_clock>(
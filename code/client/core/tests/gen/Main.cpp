@@ -6,6 +6,7 @@
 #include <map>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -28,10 +29,16 @@ using namespace Soup::Test;
 #include "build/BuildHistoryCheckerTests.gen.h"
 #include "build/BuildLoadEngineTests.gen.h"
 #include "build/BuildRunnerTests.gen.h"
+#include "build/FileDigestCacheTests.gen.h"
 #include "build/FileSystemStateTests.gen.h"
 #include "build/PackageProviderTests.gen.h"
 #include "build/RecipeBuildLocationManagerTests.gen.h"
 
+#include "generate/GenerateEngineTests.gen.h"
+#include "generate/GenerateHostPoolTests.gen.h"
+#include "generate/GenerateHostTests.gen.h"
+#include "generate/OperationGraphGeneratorTests.gen.h"
+
 #include "local-user-config/LocalUserConfigExtensionsTests.gen.h"
 #include "local-user-config/LocalUserConfigTests.gen.h"
 
@@ -40,6 +47,7 @@ using namespace Soup::Test;
 #include "operation-graph/OperationGraphReaderTests.gen.h"
 #include "operation-graph/OperationGraphWriterTests.gen.h"
 #include "operation-graph/OperationResultsTests.gen.h"
+#include "operation-graph/OperationResultsJournalTests.gen.h"
 #include "operation-graph/OperationResultsManagerTests.gen.h"
 #include "operation-graph/OperationResultsReaderTests.gen.h"
 #include "operation-graph/OperationResultsWriterTests.gen.h"
@@ -53,10 +61,15 @@ using namespace Soup::Test;
 #include "recipe/RecipeTests.gen.h"
 #include "recipe/RecipeSMLTests.gen.h"
 
+#include "utilities/ContentHashTests.gen.h"
+#include "utilities/MappedFileTests.gen.h"
+
 #include "value-table/ValueTableManagerTests.gen.h"
 #include "value-table/ValueTableReaderTests.gen.h"
 #include "value-table/ValueTableWriterTests.gen.h"
 
+#include "wren/WrenModuleCacheTests.gen.h"
+
 int main()
 {
 	std::cout << "Running Tests..." << std::endl;
@@ -68,10 +81,16 @@ int main()
 	state += RunBuildHistoryCheckerTests();
 	state += RunBuildLoadEngineTests();
 	state += RunBuildRunnerTests();
+	state += RunFileDigestCacheTests();
 	state += RunFileSystemStateTests();
 	state += RunPackageProviderTests();
 	state += RunRecipeBuildLocationManagerTests();
 
+	state += RunGenerateEngineTests();
+	state += RunGenerateHostPoolTests();
+	state += RunGenerateHostTests();
+	state += RunOperationGraphGeneratorTests();
+
 	state += RunLocalUserConfigExtensionsTests();
 	state += RunLocalUserConfigTests();
 
@@ -80,6 +99,7 @@ int main()
 	state += RunOperationGraphReaderTests();
 	state += RunOperationGraphWriterTests();
 	state += RunOperationResultsTests();
+	state += RunOperationResultsJournalTests();
 	state += RunOperationResultsManagerTests();
 	state += RunOperationResultsReaderTests();
 	state += RunOperationResultsWriterTests();
@@ -93,10 +113,15 @@ int main()
 	state += RunRecipeTests();
 	state += RunRecipeSMLTests();
 
+	state += RunContentHashTests();
+	state += RunMappedFileTests();
+
 	state += RunValueTableManagerTests();
 	state += RunValueTableReaderTests();
 	state += RunValueTableWriterTests();
 
+	state += RunWrenModuleCacheTests();
+
 	std::cout << state.PassCount << " PASSED." << std::endl;
 	std::cout << state.FailCount << " FAILED." << std::endl;
 
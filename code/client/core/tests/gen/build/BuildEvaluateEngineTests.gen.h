@@ -8,6 +8,7 @@ TestState RunBuildEvaluateEngineTests()
 	TestState state = { 0, 0 };
 	state += Soup::Test::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_FirstRun", [&testClass]() { testClass->Execute_OneOperation_FirstRun(); });
+	state += Soup::Test::RunTest(className, "Execute_OneOperation_ImmutableRootInput_TracksDirectoriesAndExecutable", [&testClass]() { testClass->Execute_OneOperation_ImmutableRootInput_TracksDirectoriesAndExecutable(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput", [&testClass]() { testClass->Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_ObservedInput_CircularReference_RemoveInput", [&testClass]() { testClass->Execute_OneOperation_ObservedInput_CircularReference_RemoveInput(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_MissingFileInfo", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_MissingFileInfo(); });
@@ -15,7 +16,15 @@ TestState RunBuildEvaluateEngineTests()
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_Executable_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_Executable_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_UpToDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_UpToDate(); });
+	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_ContentDigest_NewWriteTime_UpToDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_ContentDigest_NewWriteTime_UpToDate(); });
+	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_ContentDigest_ChangedContent_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_ContentDigest_ChangedContent_OutOfDate(); });
+	state += Soup::Test::RunTest(className, "Evaluate_TwoOperations_Incremental_UnchangedParentOutput_SkipsChild", [&testClass]() { testClass->Evaluate_TwoOperations_Incremental_UnchangedParentOutput_SkipsChild(); });
+	state += Soup::Test::RunTest(className, "Evaluate_TwoOperations_Incremental_UnchangedParentOutput_ChildOlderThanPreviousOutput_RunsChild", [&testClass]() { testClass->Evaluate_TwoOperations_Incremental_UnchangedParentOutput_ChildOlderThanPreviousOutput_RunsChild(); });
+	state += Soup::Test::RunTest(className, "Execute_WriteFile_UnchangedContent_SkipsWrite", [&testClass]() { testClass->Execute_WriteFile_UnchangedContent_SkipsWrite(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_DuplicateOutputFile_Fails", [&testClass]() { testClass->Execute_TwoOperations_DuplicateOutputFile_Fails(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_Parallel_RespectsDependencies", [&testClass]() { testClass->Execute_TwoOperations_Parallel_RespectsDependencies(); });
+	state += Soup::Test::RunTest(className, "Execute_WideGraph_Parallel_RespectsDependencies", [&testClass]() { testClass->Execute_WideGraph_Parallel_RespectsDependencies(); });
+	state += Soup::Test::RunTest(className, "Execute_WideGraph_Parallel_FailureStopsScheduling", [&testClass]() { testClass->Execute_WideGraph_Parallel_FailureStopsScheduling(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails(); });
 
@@ -12,8 +12,13 @@ TestState RunBuildHistoryCheckerTests()
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UnknownInputFile", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UnknownInputFile(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_DeletedInputFile", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_DeletedInputFile(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_Outdated", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_Outdated(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UnchangedInput", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UnchangedInput(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UnchangedInput_PreviousContentNewerThanTarget", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UnchangedInput_PreviousContentNewerThanTarget(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UpToDate", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UpToDate(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_MultipleInputs_RelativeAndAbsolute", [&testClass]() { testClass->IsOutdated_MultipleInputs_RelativeAndAbsolute(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_SharedBase_RefreshedAfterWrite", [&testClass]() { testClass->IsOutdated_SharedBase_RefreshedAfterWrite(); });
+	state += Soup::Test::RunTest(className, "IsContentOutdated_SameContent_NewWriteTime", [&testClass]() { testClass->IsContentOutdated_SameContent_NewWriteTime(); });
+	state += Soup::Test::RunTest(className, "IsContentOutdated_ChangedContent", [&testClass]() { testClass->IsContentOutdated_ChangedContent(); });
 
 	return state;
 }
\ No newline at end of file
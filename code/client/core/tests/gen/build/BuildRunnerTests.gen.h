@@ -10,6 +10,7 @@ TestState RunBuildRunnerTests()
 	state += Soup::Test::RunTest(className, "Execute_NoDependencies", [&testClass]() { testClass->Execute_NoDependencies(); });
 	state += Soup::Test::RunTest(className, "Execute_TriangleDependency_NoRebuild", [&testClass]() { testClass->Execute_TriangleDependency_NoRebuild(); });
 	state += Soup::Test::RunTest(className, "Execute_BuildDependency", [&testClass]() { testClass->Execute_BuildDependency(); });
+	state += Soup::Test::RunTest(className, "Execute_IndependentDependencies_ParallelPackages", [&testClass]() { testClass->Execute_IndependentDependencies_ParallelPackages(); });
 	state += Soup::Test::RunTest(className, "Execute_PackageLock_OverrideBuildDependency", [&testClass]() { testClass->Execute_PackageLock_OverrideBuildDependency(); });
 
 	return state;
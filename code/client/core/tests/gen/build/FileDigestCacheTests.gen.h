@@ -0,0 +1,18 @@
+#pragma once
+#include "build/FileDigestCacheTests.h"
+
+TestState RunFileDigestCacheTests() 
+ {
+	auto className = "FileDigestCacheTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileDigestCacheTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryGetDigest_MissingFile", [&testClass]() { testClass->TryGetDigest_MissingFile(); });
+	state += Soup::Test::RunTest(className, "TryGetDigest_Miss_HashesContent", [&testClass]() { testClass->TryGetDigest_Miss_HashesContent(); });
+	state += Soup::Test::RunTest(className, "TryGetDigest_Hit_SkipsContent", [&testClass]() { testClass->TryGetDigest_Hit_SkipsContent(); });
+	state += Soup::Test::RunTest(className, "TryGetDigest_ChangedSize_SameWriteTime_Rehashes", [&testClass]() { testClass->TryGetDigest_ChangedSize_SameWriteTime_Rehashes(); });
+	state += Soup::Test::RunTest(className, "TryGetDigest_RecentWriteTime_NotCached", [&testClass]() { testClass->TryGetDigest_RecentWriteTime_NotCached(); });
+	state += Soup::Test::RunTest(className, "TryGetDigest_ChangedWriteTime_Rehashes", [&testClass]() { testClass->TryGetDigest_ChangedWriteTime_Rehashes(); });
+	state += Soup::Test::RunTest(className, "SaveState_RoundTrip", [&testClass]() { testClass->SaveState_RoundTrip(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+#include "generate/GenerateEngineTests.h"
+
+TestState RunGenerateEngineTests() 
+ {
+	auto className = "GenerateEngineTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::GenerateEngineTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Run_InProcess_MatchesOutOfProcess", [&testClass]() { testClass->Run_InProcess_MatchesOutOfProcess(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include "generate/GenerateHostPoolTests.h"
+
+TestState RunGenerateHostPoolTests() 
+ {
+	auto className = "GenerateHostPoolTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::GenerateHostPoolTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Acquire_ReleasedHost_Reused", [&testClass]() { testClass->Acquire_ReleasedHost_Reused(); });
+	state += Soup::Test::RunTest(className, "EvaluateTask_AssignsModuleVariable_Throws", [&testClass]() { testClass->EvaluateTask_AssignsModuleVariable_Throws(); });
+
+	return state;
+}
\ No newline at end of file
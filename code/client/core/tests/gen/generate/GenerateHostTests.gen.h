@@ -0,0 +1,19 @@
+#pragma once
+#include "generate/GenerateHostTests.h"
+
+TestState RunGenerateHostTests() 
+ {
+	auto className = "GenerateHostTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::GenerateHostTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "StateTable_Get_ReadsValues", [&testClass]() { testClass->StateTable_Get_ReadsValues(); });
+	state += Soup::Test::RunTest(className, "StateTable_Set_OnlyChangesAssignedKeys", [&testClass]() { testClass->StateTable_Set_OnlyChangesAssignedKeys(); });
+	state += Soup::Test::RunTest(className, "StateTable_ContainsKey_TracksChanges", [&testClass]() { testClass->StateTable_ContainsKey_TracksChanges(); });
+	state += Soup::Test::RunTest(className, "StateTable_Iterate", [&testClass]() { testClass->StateTable_Iterate(); });
+	state += Soup::Test::RunTest(className, "StateTable_NestedIterate", [&testClass]() { testClass->StateTable_NestedIterate(); });
+	state += Soup::Test::RunTest(className, "StateTable_ReadList_OnlyChangedListWrittenBack", [&testClass]() { testClass->StateTable_ReadList_OnlyChangedListWrittenBack(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_MatchesCreateOperation", [&testClass]() { testClass->CreateOperations_MatchesCreateOperation(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_MissingTitle_Fails", [&testClass]() { testClass->CreateOperations_MissingTitle_Fails(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include "generate/OperationGraphGeneratorTests.h"
+
+TestState RunOperationGraphGeneratorTests() 
+ {
+	auto className = "OperationGraphGeneratorTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationGraphGeneratorTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "CreateOperations_MatchesCreateOperation", [&testClass]() { testClass->CreateOperations_MatchesCreateOperation(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_RelativeWorkingDirectory_Throws", [&testClass]() { testClass->CreateOperations_RelativeWorkingDirectory_Throws(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_DuplicateCommandInBatch_AddsNothing", [&testClass]() { testClass->CreateOperations_DuplicateCommandInBatch_AddsNothing(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_DuplicateExistingCommand_AddsNothing", [&testClass]() { testClass->CreateOperations_DuplicateExistingCommand_AddsNothing(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_CommonInputAccessDenied_AddsNothing", [&testClass]() { testClass->CreateOperations_CommonInputAccessDenied_AddsNothing(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_InputAccessDenied_AddsNothing", [&testClass]() { testClass->CreateOperations_InputAccessDenied_AddsNothing(); });
+	state += Soup::Test::RunTest(className, "CreateOperations_OutputAccessDenied_AddsNothing", [&testClass]() { testClass->CreateOperations_OutputAccessDenied_AddsNothing(); });
+	state += Soup::Test::RunTest(className, "FinalizeGraph_Diamond_RemovesTransitiveChild", [&testClass]() { testClass->FinalizeGraph_Diamond_RemovesTransitiveChild(); });
+	state += Soup::Test::RunTest(className, "RemoveTransitiveChildren_Diamond", [&testClass]() { testClass->RemoveTransitiveChildren_Diamond(); });
+	state += Soup::Test::RunTest(className, "RemoveTransitiveChildren_DuplicateChild_Kept", [&testClass]() { testClass->RemoveTransitiveChildren_DuplicateChild_Kept(); });
+	state += Soup::Test::RunTest(className, "RemoveTransitiveChildren_DuplicateReachableChild_Removed", [&testClass]() { testClass->RemoveTransitiveChildren_DuplicateReachableChild_Removed(); });
+	state += Soup::Test::RunTest(className, "RemoveTransitiveChildren_MatchesRecursiveChildSets", [&testClass]() { testClass->RemoveTransitiveChildren_MatchesRecursiveChildSets(); });
+
+	return state;
+}
\ No newline at end of file
@@ -9,6 +9,7 @@ TestState RunOperationGraphReaderTests()
 	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidFileHeaderThrows(); });
 	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileVersionThrows", [&testClass]() { testClass->Deserialize_InvalidFileVersionThrows(); });
 	state += Soup::Test::RunTest(className, "Deserialize_InvalidFilesHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidFilesHeaderThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidAccessSetsHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidAccessSetsHeaderThrows(); });
 	state += Soup::Test::RunTest(className, "Deserialize_InvalidOperationsHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidOperationsHeaderThrows(); });
 	state += Soup::Test::RunTest(className, "Deserialize_Empty", [&testClass]() { testClass->Deserialize_Empty(); });
 	state += Soup::Test::RunTest(className, "Deserialize_SingleSimple", [&testClass]() { testClass->Deserialize_SingleSimple(); });
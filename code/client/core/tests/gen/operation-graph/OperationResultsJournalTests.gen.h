@@ -0,0 +1,16 @@
+#pragma once
+#include "operation-graph/OperationResultsJournalTests.h"
+
+TestState RunOperationResultsJournalTests() 
+ {
+	auto className = "OperationResultsJournalTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationResultsJournalTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Append_Reload", [&testClass]() { testClass->Append_Reload(); });
+	state += Soup::Test::RunTest(className, "Append_PreviousJournal_RewritesPreviousRecords", [&testClass]() { testClass->Append_PreviousJournal_RewritesPreviousRecords(); });
+	state += Soup::Test::RunTest(className, "Append_StaleSnapshot_Compacts", [&testClass]() { testClass->Append_StaleSnapshot_Compacts(); });
+	state += Soup::Test::RunTest(className, "RequiresCompaction_MaxRecordCount", [&testClass]() { testClass->RequiresCompaction_MaxRecordCount(); });
+	state += Soup::Test::RunTest(className, "RequiresCompaction_MoreRecordsThanResults_Compact", [&testClass]() { testClass->RequiresCompaction_MoreRecordsThanResults_Compact(); });
+
+	return state;
+}
\ No newline at end of file
@@ -9,6 +9,7 @@ TestState RunOperationResultsManagerTests()
 	state += Soup::Test::RunTest(className, "TryLoadFromFile_MissingFile", [&testClass]() { testClass->TryLoadFromFile_MissingFile(); });
 	state += Soup::Test::RunTest(className, "TryLoadFromFile_GarbageFile", [&testClass]() { testClass->TryLoadFromFile_GarbageFile(); });
 	state += Soup::Test::RunTest(className, "TryLoadFromFile_SimpleFile", [&testClass]() { testClass->TryLoadFromFile_SimpleFile(); });
+	state += Soup::Test::RunTest(className, "TryLoadJournal_CorruptedRecordKeepsEarlierRecords", [&testClass]() { testClass->TryLoadJournal_CorruptedRecordKeepsEarlierRecords(); });
 	state += Soup::Test::RunTest(className, "SaveState", [&testClass]() { testClass->SaveState(); });
 
 	return state;
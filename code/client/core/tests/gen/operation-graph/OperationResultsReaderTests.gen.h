@@ -14,6 +14,9 @@ TestState RunOperationResultsReaderTests()
 	state += Soup::Test::RunTest(className, "Deserialize_SingleSimple", [&testClass]() { testClass->Deserialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Deserialize_SingleComplex", [&testClass]() { testClass->Deserialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Deserialize_Multiple", [&testClass]() { testClass->Deserialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Deserialize_ContentDigests", [&testClass]() { testClass->Deserialize_ContentDigests(); });
+	state += Soup::Test::RunTest(className, "Deserialize_ResourceUsage", [&testClass]() { testClass->Deserialize_ResourceUsage(); });
+	state += Soup::Test::RunTest(className, "DeserializeJournal_IgnoresPartialRecord", [&testClass]() { testClass->DeserializeJournal_IgnoresPartialRecord(); });
 
 	return state;
 }
\ No newline at end of file
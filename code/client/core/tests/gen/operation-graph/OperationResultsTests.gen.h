@@ -11,6 +11,8 @@ TestState RunOperationResultsTests()
 	state += Soup::Test::RunTest(className, "TryFindResult_Missing", [&testClass]() { testClass->TryFindResult_Missing(); });
 	state += Soup::Test::RunTest(className, "TryFindResult_Found", [&testClass]() { testClass->TryFindResult_Found(); });
 	state += Soup::Test::RunTest(className, "AddOrUpdateOperationResult", [&testClass]() { testClass->AddOrUpdateOperationResult(); });
+	state += Soup::Test::RunTest(className, "InternObservedInput_Small_NotShared", [&testClass]() { testClass->InternObservedInput_Small_NotShared(); });
+	state += Soup::Test::RunTest(className, "InternObservedInput_SharesCommonBase", [&testClass]() { testClass->InternObservedInput_SharesCommonBase(); });
 
 	return state;
 }
\ No newline at end of file
@@ -10,6 +10,9 @@ TestState RunOperationResultsWriterTests()
 	state += Soup::Test::RunTest(className, "Serialize_SingleSimple", [&testClass]() { testClass->Serialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Serialize_SingleComplex", [&testClass]() { testClass->Serialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Serialize_Multiple", [&testClass]() { testClass->Serialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Serialize_ContentDigests", [&testClass]() { testClass->Serialize_ContentDigests(); });
+	state += Soup::Test::RunTest(className, "Serialize_ResourceUsage", [&testClass]() { testClass->Serialize_ResourceUsage(); });
+	state += Soup::Test::RunTest(className, "Serialize_SharedObservedInput", [&testClass]() { testClass->Serialize_SharedObservedInput(); });
 
 	return state;
 }
\ No newline at end of file
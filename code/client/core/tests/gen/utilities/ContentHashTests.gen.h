@@ -0,0 +1,16 @@
+#pragma once
+#include "utilities/ContentHashTests.h"
+
+TestState RunContentHashTests() 
+ {
+	auto className = "ContentHashTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::ContentHashTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Compute_Empty", [&testClass]() { testClass->Compute_Empty(); });
+	state += Soup::Test::RunTest(className, "Compute_Short", [&testClass]() { testClass->Compute_Short(); });
+	state += Soup::Test::RunTest(className, "Compute_MultipleStripes", [&testClass]() { testClass->Compute_MultipleStripes(); });
+	state += Soup::Test::RunTest(className, "Compute_DifferentContent", [&testClass]() { testClass->Compute_DifferentContent(); });
+	state += Soup::Test::RunTest(className, "Stream_MatchesCompute", [&testClass]() { testClass->Stream_MatchesCompute(); });
+
+	return state;
+}
\ No newline at end of file
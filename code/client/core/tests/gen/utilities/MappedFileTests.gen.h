@@ -0,0 +1,16 @@
+#pragma once
+#include "utilities/MappedFileTests.h"
+
+TestState RunMappedFileTests() 
+ {
+	auto className = "MappedFileTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::MappedFileTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryOpen_MissingFile", [&testClass]() { testClass->TryOpen_MissingFile(); });
+	state += Soup::Test::RunTest(className, "TryOpen_EmptyFile", [&testClass]() { testClass->TryOpen_EmptyFile(); });
+	state += Soup::Test::RunTest(className, "TryOpen_SmallFile", [&testClass]() { testClass->TryOpen_SmallFile(); });
+	state += Soup::Test::RunTest(className, "TryOpen_LargeFile", [&testClass]() { testClass->TryOpen_LargeFile(); });
+	state += Soup::Test::RunTest(className, "TryOpen_Reopen_ReplacesContent", [&testClass]() { testClass->TryOpen_Reopen_ReplacesContent(); });
+
+	return state;
+}
\ No newline at end of file
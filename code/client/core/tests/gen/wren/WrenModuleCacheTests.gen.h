@@ -0,0 +1,16 @@
+#pragma once
+#include "wren/WrenModuleCacheTests.h"
+
+TestState RunWrenModuleCacheTests() 
+ {
+	auto className = "WrenModuleCacheTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::WrenModuleCacheTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryGetSource_MissingFile", [&testClass]() { testClass->TryGetSource_MissingFile(); });
+	state += Soup::Test::RunTest(className, "TryGetSource_Hit_ReusesSource", [&testClass]() { testClass->TryGetSource_Hit_ReusesSource(); });
+	state += Soup::Test::RunTest(className, "TryGetSource_ChangedWriteTime_Reloads", [&testClass]() { testClass->TryGetSource_ChangedWriteTime_Reloads(); });
+	state += Soup::Test::RunTest(className, "TryGetSource_ChangedSize_Reloads", [&testClass]() { testClass->TryGetSource_ChangedSize_Reloads(); });
+	state += Soup::Test::RunTest(className, "TryGetBundles_Hit_ReusesBundles", [&testClass]() { testClass->TryGetBundles_Hit_ReusesBundles(); });
+
+	return state;
+}
\ No newline at end of file
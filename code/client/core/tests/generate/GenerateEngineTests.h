@@ -0,0 +1,143 @@
+// <copyright file="GenerateEngineTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class GenerateEngineTests
+	{
+	public:
+		// [[Fact]]
+		void Run_InProcess_MatchesOutOfProcess()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto soupTargetDirectory = Path("C:/Target/");
+			auto inputTable = ValueTable({
+				{ "PackageRoot", Value(std::string("C:/Package/")) },
+				{ "UserDataPath", Value(std::string("C:/Users/Me/.soup/")) },
+				{ "GenerateMacros", Value(ValueTable()) },
+				{ "GenerateSubGraphMacros", Value(ValueTable()) },
+				{ "EvaluateMacros", Value(ValueTable()) },
+				{ "EvaluateReadAccess", Value(ValueList({ Value(std::string("C:/Package/")) })) },
+				{ "EvaluateWriteAccess", Value(ValueList({ Value(std::string("C:/Target/")) })) },
+				{
+					"Dependencies",
+					Value(ValueTable({
+						{
+							"Build",
+							Value(ValueTable({
+								{
+									"Extension",
+									Value(ValueTable({
+										{ "SoupTargetDirectory", Value(std::string("C:/Extension/Target/")) },
+									}))
+								},
+							}))
+						},
+					}))
+				},
+				{
+					"GlobalState",
+					Value(ValueTable({
+						{
+							"Dependencies",
+							Value(ValueTable({
+								{ "Build", Value(ValueTable({ { "Extension", Value(ValueTable()) } })) },
+							}))
+						},
+					}))
+				},
+			});
+			auto inputContent = std::stringstream();
+			ValueTableWriter::Serialize(inputTable, inputContent);
+			fileSystem->CreateMockFile(
+				soupTargetDirectory + BuildConstants::GenerateInputFileName(),
+				std::make_shared<MockFile>(std::move(inputContent)));
+
+			fileSystem->CreateMockFile(
+				Path("C:/Package/Recipe.sml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Name: 'MyPackage'
+					Language: (C++@1)
+				)")));
+
+			auto extensionSharedState = ValueTable({
+				{
+					"Build",
+					Value(ValueTable({
+						{ "TargetDirectory", Value(std::string("C:/Extension/")) },
+						{ "Source", Value(ValueList({ Value(std::string("GenerateEngineTask.wren")) })) },
+					}))
+				},
+			});
+			auto extensionSharedStateContent = std::stringstream();
+			ValueTableWriter::Serialize(extensionSharedState, extensionSharedStateContent);
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Target/") + BuildConstants::GenerateSharedStateFileName(),
+				std::make_shared<MockFile>(std::move(extensionSharedStateContent)));
+
+			auto scriptFile = Path("C:/Extension/GenerateEngineTask.wren");
+			fileSystem->CreateMockFile(
+				scriptFile,
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(scriptFile)->Content = std::stringstream(
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"class GenerateEngineTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		Soup.createOperation(\n"
+				"			\"Compile\",\n"
+				"			\"C:/Tools/compiler.exe\",\n"
+				"			[\"Input.cpp\"],\n"
+				"			\"C:/Package/\",\n"
+				"			[\"C:/Package/Input.cpp\"],\n"
+				"			[\"C:/Target/Input.obj\"])\n"
+				"		Soup.createOperation(\n"
+				"			\"Link\",\n"
+				"			\"C:/Tools/linker.exe\",\n"
+				"			[\"Input.obj\"],\n"
+				"			\"C:/Target/\",\n"
+				"			[\"C:/Target/Input.obj\"],\n"
+				"			[\"C:/Target/Output.exe\"])\n"
+				"		Soup.sharedState[\"Output\"] = \"C:/Target/Output.exe\"\n"
+				"	}\n"
+				"}\n");
+
+			auto hostPool = Generate::GenerateHostPool();
+
+			// Run the way the generate executable does and load the graph it saved
+			auto generateFileSystemState = FileSystemState();
+			Generate::GenerateEngine(generateFileSystemState, hostPool).Run(soupTargetDirectory);
+
+			auto runnerFileSystemState = FileSystemState();
+			auto savedGraph = OperationGraphReader::Deserialize(
+				fileSystem->GetMockFile(soupTargetDirectory + BuildConstants::EvaluateGraphFileName())->Content,
+				runnerFileSystemState);
+			auto savedSharedState = fileSystem->GetMockFile(
+				soupTargetDirectory + BuildConstants::GenerateSharedStateFileName())->Content.str();
+
+			// Run in process against the build runner state
+			auto inProcessGraph = Generate::GenerateEngine(runnerFileSystemState, hostPool).Run(soupTargetDirectory);
+			auto inProcessSharedState = fileSystem->GetMockFile(
+				soupTargetDirectory + BuildConstants::GenerateSharedStateFileName())->Content.str();
+
+			Assert::AreEqual<size_t>(2, savedGraph.GetOperations().size(), "Verify the saved graph has both operations.");
+			Assert::AreEqual(
+				savedGraph.GetRootOperationIds(),
+				inProcessGraph.GetRootOperationIds(),
+				"Verify root operation ids match.");
+			Assert::AreEqual(
+				savedGraph.GetOperations(),
+				inProcessGraph.GetOperations(),
+				"Verify operations match.");
+			Assert::AreEqual(savedSharedState, inProcessSharedState, "Verify shared state matches.");
+		}
+	};
+}
@@ -0,0 +1,116 @@
+// <copyright file="GenerateHostPoolTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class GenerateHostPoolTests
+	{
+	public:
+		// [[Fact]]
+		void Acquire_ReleasedHost_Reused()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto scriptFile = Path("C:/Extension/BuildTask.wren");
+			CreateScript(
+				*fileSystem,
+				scriptFile,
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"class BuildTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		Soup.activeState[\"Value\"] = Soup.globalState[\"Value\"] + 1\n"
+				"	}\n"
+				"}\n");
+
+			auto fileSystemState = FileSystemState();
+			auto uut = Generate::GenerateHostPool();
+
+			auto runTask = [&](double value)
+			{
+				auto state = Generate::GenerateState(
+					ValueTable({ { "Value", Value(value) } }),
+					fileSystemState,
+					std::vector<Path>(),
+					std::vector<Path>());
+
+				auto host = uut.Acquire(scriptFile, std::nullopt);
+				auto hostAddress = host.get();
+				host->SetState(state);
+				host->EvaluateTask("BuildTask");
+				auto activeState = host->GetUpdatedActiveState();
+				host->ResetState();
+				uut.Release(std::move(host));
+
+				return std::make_pair(hostAddress, activeState.at("Value").AsFloat());
+			};
+
+			auto [firstHost, firstValue] = runTask(1.0);
+			auto [secondHost, secondValue] = runTask(5.0);
+
+			Assert::IsTrue(firstHost == secondHost, "Verify the host was reused.");
+			Assert::AreEqual(2.0, firstValue, "Verify first value matches expected.");
+			Assert::AreEqual(6.0, secondValue, "Verify second value only used its own state.");
+		}
+
+		// [[Fact]]
+		void EvaluateTask_AssignsModuleVariable_Throws()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto scriptFile = Path("C:/Extension/CounterTask.wren");
+			CreateScript(
+				*fileSystem,
+				scriptFile,
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"var Counter = 0\n"
+				"\n"
+				"class CounterTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		Counter = Counter + 1\n"
+				"		Soup.activeState[\"Counter\"] = Counter\n"
+				"	}\n"
+				"}\n");
+
+			auto fileSystemState = FileSystemState();
+			auto uut = Generate::GenerateHostPool();
+
+			auto state = Generate::GenerateState(
+				ValueTable(),
+				fileSystemState,
+				std::vector<Path>(),
+				std::vector<Path>());
+
+			auto host = uut.Acquire(scriptFile, std::nullopt);
+			host->SetState(state);
+
+			auto exception = Assert::Throws<std::runtime_error>([&host]() {
+				host->EvaluateTask("CounterTask");
+			});
+
+			Assert::AreEqual(
+				"Task CounterTask assigned a module level variable, build tasks must keep their state in the Soup state tables",
+				exception.what(),
+				"Verify Exception message");
+		}
+
+	private:
+		static void CreateScript(MockFileSystem& fileSystem, const Path& scriptFile, std::string content)
+		{
+			fileSystem.CreateMockFile(
+				scriptFile,
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem.GetMockFile(scriptFile)->Content = std::stringstream(std::move(content));
+		}
+	};
+}
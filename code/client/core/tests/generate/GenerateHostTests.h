@@ -0,0 +1,341 @@
+// <copyright file="GenerateHostTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class GenerateHostTests
+	{
+	public:
+		// [[Fact]]
+		void StateTable_Get_ReadsValues()
+		{
+			auto globalState = ValueTable({
+				{ "Name", Value(std::string("Value")) },
+				{ "Nested", Value(ValueTable({
+					{ "Count", Value(static_cast<int64_t>(3)) },
+				})) },
+			});
+
+			auto [activeState, sharedState] = RunTask(
+				"StateTable_Get_ReadsValues",
+				"		var global = Soup.globalState\n"
+				"		Soup.activeState[\"Name\"] = global[\"Name\"]\n"
+				"		Soup.activeState[\"Count\"] = global[\"Nested\"][\"Count\"]\n"
+				"		Soup.activeState[\"Missing\"] = global[\"Missing\"] == null\n",
+				std::move(globalState),
+				ValueTable());
+
+			Assert::AreEqual<size_t>(3, activeState.size(), "Verify active state size.");
+			Assert::AreEqual<std::string>("Value", activeState.at("Name").AsString(), "Verify name matches expected.");
+			Assert::AreEqual(3.0, activeState.at("Count").AsFloat(), "Verify count matches expected.");
+			Assert::IsTrue(activeState.at("Missing").AsBoolean(), "Verify missing key reads null.");
+		}
+
+		// [[Fact]]
+		void StateTable_Set_OnlyChangesAssignedKeys()
+		{
+			auto activeState = ValueTable({
+				{ "Keep", Value(std::string("Original")) },
+				{ "Replace", Value(std::string("Original")) },
+				{ "Remove", Value(std::string("Original")) },
+				{ "Nested", Value(ValueTable({
+					{ "Keep", Value(std::string("Original")) },
+				})) },
+			});
+
+			auto [updatedActiveState, sharedState] = RunTask(
+				"StateTable_Set_OnlyChangesAssignedKeys",
+				"		var active = Soup.activeState\n"
+				"		active[\"Replace\"] = \"Updated\"\n"
+				"		active.remove(\"Remove\")\n"
+				"		active[\"Added\"] = [\"A\", \"B\"]\n"
+				"		active[\"Nested\"][\"Added\"] = true\n",
+				ValueTable(),
+				std::move(activeState));
+
+			Assert::AreEqual<size_t>(4, updatedActiveState.size(), "Verify active state size.");
+			Assert::AreEqual<std::string>("Original", updatedActiveState.at("Keep").AsString(), "Verify kept value.");
+			Assert::AreEqual<std::string>("Updated", updatedActiveState.at("Replace").AsString(), "Verify replaced value.");
+			Assert::IsFalse(updatedActiveState.contains("Remove"), "Verify removed value.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "A", "B" }),
+				ToStringList(updatedActiveState.at("Added")),
+				"Verify added value.");
+
+			auto& nested = updatedActiveState.at("Nested").AsTable();
+			Assert::AreEqual<size_t>(2, nested.size(), "Verify nested size.");
+			Assert::AreEqual<std::string>("Original", nested.at("Keep").AsString(), "Verify nested kept value.");
+			Assert::IsTrue(nested.at("Added").AsBoolean(), "Verify nested added value.");
+		}
+
+		// [[Fact]]
+		void StateTable_ContainsKey_TracksChanges()
+		{
+			auto globalState = ValueTable({
+				{ "Name", Value(std::string("Value")) },
+				{ "Other", Value(std::string("Value")) },
+			});
+
+			auto [activeState, sharedState] = RunTask(
+				"StateTable_ContainsKey_TracksChanges",
+				"		var global = Soup.globalState\n"
+				"		Soup.activeState[\"HasName\"] = global.containsKey(\"Name\")\n"
+				"		Soup.activeState[\"HasMissing\"] = global.containsKey(\"Missing\")\n"
+				"		global.remove(\"Other\")\n"
+				"		Soup.activeState[\"HasRemoved\"] = global.containsKey(\"Other\")\n"
+				"		global[\"Added\"] = 1\n"
+				"		Soup.activeState[\"HasAdded\"] = global.containsKey(\"Added\")\n"
+				"		Soup.activeState[\"Keys\"] = global.keys\n",
+				std::move(globalState),
+				ValueTable());
+
+			Assert::IsTrue(activeState.at("HasName").AsBoolean(), "Verify existing key.");
+			Assert::IsFalse(activeState.at("HasMissing").AsBoolean(), "Verify missing key.");
+			Assert::IsFalse(activeState.at("HasRemoved").AsBoolean(), "Verify removed key.");
+			Assert::IsTrue(activeState.at("HasAdded").AsBoolean(), "Verify added key.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "Name", "Added" }),
+				ToStringList(activeState.at("Keys")),
+				"Verify keys match expected.");
+		}
+
+		// [[Fact]]
+		void StateTable_Iterate()
+		{
+			auto globalState = ValueTable({
+				{ "A", Value(std::string("1")) },
+				{ "B", Value(std::string("2")) },
+				{ "C", Value(std::string("3")) },
+			});
+
+			auto [activeState, sharedState] = RunTask(
+				"StateTable_Iterate",
+				"		var entries = []\n"
+				"		for (entry in Soup.globalState) entries.add(entry.key + entry.value)\n"
+				"		Soup.activeState[\"Entries\"] = entries\n",
+				std::move(globalState),
+				ValueTable());
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "A1", "B2", "C3" }),
+				ToStringList(activeState.at("Entries")),
+				"Verify entries match expected.");
+		}
+
+		// [[Fact]]
+		void StateTable_NestedIterate()
+		{
+			auto globalState = ValueTable({
+				{ "A", Value(std::string("1")) },
+				{ "B", Value(std::string("2")) },
+			});
+
+			auto [activeState, sharedState] = RunTask(
+				"StateTable_NestedIterate",
+				"		var global = Soup.globalState\n"
+				"		var pairs = []\n"
+				"		for (outer in global) {\n"
+				"			for (inner in global) pairs.add(outer.key + inner.key)\n"
+				"		}\n"
+				"		Soup.activeState[\"Pairs\"] = pairs\n",
+				std::move(globalState),
+				ValueTable());
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "AA", "AB", "BA", "BB" }),
+				ToStringList(activeState.at("Pairs")),
+				"Verify pairs match expected.");
+		}
+
+		// [[Fact]]
+		void StateTable_ReadList_OnlyChangedListWrittenBack()
+		{
+			auto activeState = ValueTable({
+				{ "Unchanged", Value(ValueList({
+					Value(std::string("A")),
+					Value(static_cast<int64_t>(1)),
+					Value(ValueList({ Value(true) })),
+				})) },
+				{ "Changed", Value(ValueList({
+					Value(std::string("A")),
+				})) },
+			});
+
+			auto [updatedActiveState, sharedState] = RunTask(
+				"StateTable_ReadList_OnlyChangedListWrittenBack",
+				"		var active = Soup.activeState\n"
+				"		var unchanged = active[\"Unchanged\"]\n"
+				"		active[\"Changed\"].add(\"B\")\n"
+				"		Soup.sharedState[\"Changes\"] = active.changes_.keys.toList\n",
+				ValueTable(),
+				std::move(activeState));
+
+			Assert::AreEqual(
+				std::vector<std::string>({ "Changed" }),
+				ToStringList(sharedState.at("Changes")),
+				"Verify only the changed list is written back.");
+			Assert::AreEqual(
+				std::vector<std::string>({ "A", "B" }),
+				ToStringList(updatedActiveState.at("Changed")),
+				"Verify changed list matches expected.");
+			Assert::AreEqual<size_t>(3, updatedActiveState.at("Unchanged").AsList().size(), "Verify unchanged list.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_MatchesCreateOperation()
+		{
+			auto expected = CreateOperationGraph(
+				"CreateOperations_MatchesCreateOperation_Single",
+				"		for (i in 0...2) {\n"
+				"			Soup.createOperation(\n"
+				"				\"Compile %(i)\",\n"
+				"				\"C:/bin/compiler.exe\",\n"
+				"				[\"-c\", \"%(i).cpp\"],\n"
+				"				\"C:/WorkingDirectory/\",\n"
+				"				[\"./pch.gch\", \"./%(i).cpp\"],\n"
+				"				[\"./obj/%(i).o\"])\n"
+				"		}\n");
+
+			auto actual = CreateOperationGraph(
+				"CreateOperations_MatchesCreateOperation_Batch",
+				"		Soup.createOperations(\n"
+				"			\"C:/bin/compiler.exe\",\n"
+				"			\"C:/WorkingDirectory/\",\n"
+				"			[\"-c\"],\n"
+				"			[\"./pch.gch\"],\n"
+				"			[\n"
+				"				{ \"Title\": \"Compile 0\", \"Arguments\": [\"0.cpp\"], \"DeclaredInput\": [\"./0.cpp\"], \"DeclaredOutput\": [\"./obj/0.o\"] },\n"
+				"				{ \"Title\": \"Compile 1\", \"Arguments\": [\"1.cpp\"], \"DeclaredInput\": [\"./1.cpp\"], \"DeclaredOutput\": [\"./obj/1.o\"] },\n"
+				"			])\n");
+
+			Assert::AreEqual<size_t>(2, actual.GetOperations().size(), "Verify operation count.");
+			Assert::AreEqual(
+				expected.GetRootOperationIds(),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match.");
+			Assert::AreEqual(
+				expected.GetOperations(),
+				actual.GetOperations(),
+				"Verify operations match.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_MissingTitle_Fails()
+		{
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				auto graph = CreateOperationGraph(
+					"CreateOperations_MissingTitle_Fails",
+					"		Soup.createOperations(\n"
+					"			\"C:/bin/compiler.exe\",\n"
+					"			\"C:/WorkingDirectory/\",\n"
+					"			[],\n"
+					"			[],\n"
+					"			[\n"
+					"				{ \"Title\": \"Compile 0\", \"Arguments\": [\"0.cpp\"] },\n"
+					"				{ \"Arguments\": [\"1.cpp\"] },\n"
+					"			])\n");
+			});
+
+			Assert::AreEqual("Runtime Error!", exception.what(), "Verify Exception message");
+		}
+
+	private:
+		/// <summary>
+		/// Evaluate a single task with the provided body and return the operation graph it created
+		/// </summary>
+		OperationGraph CreateOperationGraph(
+			const std::string& name,
+			const std::string& evaluateBody)
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto scriptFile = CreateTaskScript(*fileSystem, name, evaluateBody);
+
+			auto fileSystemState = FileSystemState();
+			auto state = Generate::GenerateState(
+				ValueTable(),
+				fileSystemState,
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }),
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }));
+
+			auto uut = Generate::GenerateHost(scriptFile, std::nullopt);
+			uut.InterpretMain();
+			uut.SetState(state);
+			uut.EvaluateTask("TestTask");
+			uut.ResetState();
+
+			return state.BuildOperationGraph();
+		}
+
+		/// <summary>
+		/// Evaluate a single task with the provided body and return the updated active and shared state
+		/// </summary>
+		std::pair<ValueTable, ValueTable> RunTask(
+			const std::string& name,
+			const std::string& evaluateBody,
+			ValueTable globalState,
+			ValueTable activeState)
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto scriptFile = CreateTaskScript(*fileSystem, name, evaluateBody);
+
+			auto fileSystemState = FileSystemState();
+			auto state = Generate::GenerateState(
+				std::move(globalState),
+				fileSystemState,
+				std::vector<Path>(),
+				std::vector<Path>());
+			state.Update(std::move(activeState), ValueTable());
+
+			auto uut = Generate::GenerateHost(scriptFile, std::nullopt);
+			uut.InterpretMain();
+			uut.SetState(state);
+			uut.EvaluateTask("TestTask");
+			auto updatedActiveState = uut.GetUpdatedActiveState();
+			auto updatedSharedState = uut.GetUpdatedSharedState();
+			uut.ResetState();
+
+			return std::make_pair(std::move(updatedActiveState), std::move(updatedSharedState));
+		}
+
+		Path CreateTaskScript(
+			MockFileSystem& fileSystem,
+			const std::string& name,
+			const std::string& evaluateBody)
+		{
+			// Each test uses its own script so the process wide module cache never serves another test's source
+			auto scriptFile = Path("C:/Extension/" + name + ".wren");
+			fileSystem.CreateMockFile(
+				scriptFile,
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem.GetMockFile(scriptFile)->Content = std::stringstream(
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"class TestTask is SoupTask {\n"
+				"	static evaluate() {\n" +
+				evaluateBody +
+				"	}\n"
+				"}\n");
+
+			return scriptFile;
+		}
+
+		std::vector<std::string> ToStringList(const Value& value)
+		{
+			auto result = std::vector<std::string>();
+			for (auto& item : value.AsList())
+				result.push_back(item.AsString());
+
+			return result;
+		}
+	};
+}
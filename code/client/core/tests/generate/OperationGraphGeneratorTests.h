@@ -0,0 +1,460 @@
+// <copyright file="OperationGraphGeneratorTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationGraphGeneratorTests
+	{
+	public:
+		// [[Fact]]
+		void CreateOperations_MatchesCreateOperation()
+		{
+			auto fileSystemState = FileSystemState();
+
+			auto single = CreateGenerator(fileSystemState);
+			for (auto i = 0; i < 2; i++)
+			{
+				single.CreateOperation(
+					std::format("Compile {}", i),
+					Path("C:/bin/compiler.exe"),
+					{ "-c", std::format("{}.cpp", i) },
+					Path("C:/WorkingDirectory/"),
+					{ Path("./pch.gch"), Path(std::format("./{}.cpp", i)) },
+					{ Path(std::format("./obj/{}.o", i)) });
+			}
+
+			single.CreateOperation(
+				"Link",
+				Path("C:/bin/linker.exe"),
+				{ "obj/0.o", "obj/1.o" },
+				Path("C:/WorkingDirectory/"),
+				{ Path("./obj/0.o"), Path("./obj/1.o") },
+				{ Path("./out/program.exe") });
+
+			auto batch = CreateGenerator(fileSystemState);
+			batch.CreateOperations(
+				Path("C:/bin/compiler.exe"),
+				Path("C:/WorkingDirectory/"),
+				{ "-c" },
+				{ Path("./pch.gch") },
+				{
+					Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, { Path("./0.cpp") }, { Path("./obj/0.o") } }),
+					Generate::OperationBatchEntry({ "Compile 1", { "1.cpp" }, { Path("./1.cpp") }, { Path("./obj/1.o") } }),
+				});
+
+			batch.CreateOperation(
+				"Link",
+				Path("C:/bin/linker.exe"),
+				{ "obj/0.o", "obj/1.o" },
+				Path("C:/WorkingDirectory/"),
+				{ Path("./obj/0.o"), Path("./obj/1.o") },
+				{ Path("./out/program.exe") });
+
+			auto expected = single.FinalizeGraph();
+			auto actual = batch.FinalizeGraph();
+
+			Assert::AreEqual<size_t>(3, actual.GetOperations().size(), "Verify operation count.");
+			Assert::AreEqual(
+				expected.GetRootOperationIds(),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match.");
+			Assert::AreEqual(
+				expected.GetOperations(),
+				actual.GetOperations(),
+				"Verify operations match.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_RelativeWorkingDirectory_Throws()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("./WorkingDirectory/"),
+					{},
+					{},
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, {}, {} }),
+					});
+			});
+
+			Assert::AreEqual("Working directory must be an absolute path.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.FinalizeGraph().GetOperations().size(), "Verify no operations were added.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_DuplicateCommandInBatch_AddsNothing()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("C:/WorkingDirectory/"),
+					{ "-c" },
+					{},
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, {}, { Path("./obj/0.o") } }),
+						Generate::OperationBatchEntry({ "Compile 1", { "1.cpp" }, {}, { Path("./obj/1.o") } }),
+						Generate::OperationBatchEntry({ "Compile 0 Again", { "0.cpp" }, {}, { Path("./obj/2.o") } }),
+					});
+			});
+
+			Assert::AreEqual("Operation with this command already exists.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.FinalizeGraph().GetOperations().size(), "Verify no operations were added.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_DuplicateExistingCommand_AddsNothing()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+			uut.CreateOperation(
+				"Compile 1",
+				Path("C:/bin/compiler.exe"),
+				{ "-c", "1.cpp" },
+				Path("C:/WorkingDirectory/"),
+				{},
+				{});
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("C:/WorkingDirectory/"),
+					{ "-c" },
+					{},
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, {}, {} }),
+						Generate::OperationBatchEntry({ "Compile 1", { "1.cpp" }, {}, {} }),
+					});
+			});
+
+			Assert::AreEqual("Operation with this command already exists.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(1, uut.FinalizeGraph().GetOperations().size(), "Verify only the existing operation remains.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_CommonInputAccessDenied_AddsNothing()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("C:/WorkingDirectory/"),
+					{},
+					{ Path("C:/Other/pch.gch") },
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, {}, {} }),
+					});
+			});
+
+			Assert::AreEqual("Operation does not have permission to read requested input.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.FinalizeGraph().GetOperations().size(), "Verify no operations were added.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_InputAccessDenied_AddsNothing()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("C:/WorkingDirectory/"),
+					{},
+					{},
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, { Path("./0.cpp") }, {} }),
+						Generate::OperationBatchEntry({ "Compile 1", { "1.cpp" }, { Path("C:/Other/1.cpp") }, {} }),
+					});
+			});
+
+			Assert::AreEqual("Operation does not have permission to read requested input.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.FinalizeGraph().GetOperations().size(), "Verify no operations were added.");
+		}
+
+		// [[Fact]]
+		void CreateOperations_OutputAccessDenied_AddsNothing()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+
+			auto exception = Assert::Throws<std::runtime_error>([&]()
+			{
+				uut.CreateOperations(
+					Path("C:/bin/compiler.exe"),
+					Path("C:/WorkingDirectory/"),
+					{},
+					{},
+					{
+						Generate::OperationBatchEntry({ "Compile 0", { "0.cpp" }, {}, { Path("./obj/0.o") } }),
+						Generate::OperationBatchEntry({ "Compile 1", { "1.cpp" }, {}, { Path("C:/Other/1.o") } }),
+					});
+			});
+
+			Assert::AreEqual("Operation does not have permission to write requested output.", exception.what(), "Verify Exception message");
+			Assert::AreEqual<size_t>(0, uut.FinalizeGraph().GetOperations().size(), "Verify no operations were added.");
+		}
+
+		// [[Fact]]
+		void FinalizeGraph_Diamond_RemovesTransitiveChild()
+		{
+			auto fileSystemState = FileSystemState();
+			auto uut = CreateGenerator(fileSystemState);
+			uut.CreateOperation(
+				"Generate",
+				Path("C:/bin/tool.exe"),
+				{ "generate" },
+				Path("C:/WorkingDirectory/"),
+				{},
+				{ Path("./a.h") });
+			uut.CreateOperation(
+				"Compile B",
+				Path("C:/bin/tool.exe"),
+				{ "b" },
+				Path("C:/WorkingDirectory/"),
+				{ Path("./a.h") },
+				{ Path("./b.o") });
+			uut.CreateOperation(
+				"Compile C",
+				Path("C:/bin/tool.exe"),
+				{ "c" },
+				Path("C:/WorkingDirectory/"),
+				{ Path("./a.h") },
+				{ Path("./c.o") });
+			uut.CreateOperation(
+				"Link",
+				Path("C:/bin/tool.exe"),
+				{ "link" },
+				Path("C:/WorkingDirectory/"),
+				{ Path("./a.h"), Path("./b.o"), Path("./c.o") },
+				{ Path("./out.exe") });
+
+			auto actual = uut.FinalizeGraph();
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 1 }),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+			Assert::AreEqual(
+				std::vector<OperationId>({ 2, 3 }),
+				actual.GetOperationInfo(1).Children,
+				"Verify the transitive link reference was removed.");
+			Assert::AreEqual(
+				std::vector<OperationId>({ 4 }),
+				actual.GetOperationInfo(2).Children,
+				"Verify the first compile children.");
+			Assert::AreEqual(
+				std::vector<OperationId>({ 4 }),
+				actual.GetOperationInfo(3).Children,
+				"Verify the second compile children.");
+			Assert::AreEqual<uint32_t>(2, actual.GetOperationInfo(4).DependencyCount, "Verify link dependency count.");
+		}
+
+		// [[Fact]]
+		void RemoveTransitiveChildren_Diamond()
+		{
+			auto uut = CreateGraph(4, {
+				{ 1, 2 }, { 1, 3 }, { 1, 4 },
+				{ 2, 4 },
+				{ 3, 4 },
+			});
+
+			Generate::OperationGraphGenerator::RemoveTransitiveChildren(uut);
+
+			Assert::AreEqual(std::vector<OperationId>({ 2, 3 }), uut.GetOperationInfo(1).Children, "Verify root children.");
+			Assert::AreEqual<uint32_t>(2, uut.GetOperationInfo(4).DependencyCount, "Verify shared child dependency count.");
+		}
+
+		// [[Fact]]
+		void RemoveTransitiveChildren_DuplicateChild_Kept()
+		{
+			auto uut = CreateGraph(3, {
+				{ 1, 2 }, { 1, 2 }, { 1, 3 },
+			});
+
+			Generate::OperationGraphGenerator::RemoveTransitiveChildren(uut);
+
+			Assert::AreEqual(std::vector<OperationId>({ 2, 2, 3 }), uut.GetOperationInfo(1).Children, "Verify root children.");
+			Assert::AreEqual<uint32_t>(2, uut.GetOperationInfo(2).DependencyCount, "Verify duplicate child dependency count.");
+		}
+
+		// [[Fact]]
+		void RemoveTransitiveChildren_DuplicateReachableChild_Removed()
+		{
+			auto uut = CreateGraph(3, {
+				{ 1, 3 }, { 1, 2 }, { 1, 3 },
+				{ 2, 3 },
+			});
+
+			Generate::OperationGraphGenerator::RemoveTransitiveChildren(uut);
+
+			Assert::AreEqual(std::vector<OperationId>({ 2 }), uut.GetOperationInfo(1).Children, "Verify root children.");
+			Assert::AreEqual<uint32_t>(1, uut.GetOperationInfo(3).DependencyCount, "Verify removed child dependency count.");
+		}
+
+		// [[Fact]]
+		void RemoveTransitiveChildren_MatchesRecursiveChildSets()
+		{
+			// Compare against the direct recursive child set walk across graphs that span multiple bitset blocks
+			uint32_t seed = 7;
+			auto random = [&seed]()
+			{
+				seed = seed * 1664525u + 1013904223u;
+				return seed >> 8;
+			};
+
+			for (auto graphIndex = 0; graphIndex < 50; graphIndex++)
+			{
+				auto operationCount = graphIndex % 10 == 0 ? 2500u : 1u + random() % 60;
+				auto edges = std::vector<std::pair<OperationId, OperationId>>();
+				for (auto parent = 1u; parent < operationCount; parent++)
+				{
+					auto childCount = random() % 5;
+					for (auto i = 0u; i < childCount; i++)
+					{
+						auto child = parent + 1 + random() % (operationCount - parent);
+						edges.emplace_back(parent, child);
+
+						// Include repeated references to the same child
+						if (random() % 8 == 0)
+							edges.emplace_back(parent, child);
+					}
+				}
+
+				auto expected = CreateGraph(operationCount, edges);
+				RemoveTransitiveChildrenRecursive(expected);
+
+				auto actual = CreateGraph(operationCount, edges);
+				Generate::OperationGraphGenerator::RemoveTransitiveChildren(actual);
+
+				Assert::AreEqual(expected.GetOperations(), actual.GetOperations(), "Verify operations match expected.");
+			}
+		}
+
+	private:
+		/// <summary>
+		/// Create a graph with the operations numbered one through the count and the provided parent child references
+		/// </summary>
+		OperationGraph CreateGraph(
+			uint32_t operationCount,
+			const std::vector<std::pair<OperationId, OperationId>>& edges)
+		{
+			auto result = OperationGraph();
+			for (OperationId operationId = 1; operationId <= operationCount; operationId++)
+			{
+				result.AddOperation(
+					OperationInfo(
+						operationId,
+						std::format("Operation {}", operationId),
+						CommandInfo(
+							Path("C:/WorkingDirectory/"),
+							Path("C:/bin/tool.exe"),
+							{ std::to_string(operationId) }),
+						{},
+						{},
+						{},
+						{}));
+			}
+
+			for (auto [parentId, childId] : edges)
+			{
+				result.GetOperationInfo(parentId).Children.push_back(childId);
+				result.GetOperationInfo(childId).DependencyCount++;
+			}
+
+			auto rootOperations = std::vector<OperationId>();
+			for (auto& [operationId, operation] : result.GetOperations())
+			{
+				if (operation.DependencyCount == 0)
+				{
+					operation.DependencyCount = 1;
+					rootOperations.push_back(operationId);
+				}
+			}
+
+			result.SetRootOperationIds(std::move(rootOperations));
+			return result;
+		}
+
+		/// <summary>
+		/// Remove each child that is in the recursive child set of a different child by walking the sets directly
+		/// </summary>
+		void RemoveTransitiveChildrenRecursive(OperationGraph& graph)
+		{
+			auto recursiveChildren = std::map<OperationId, std::set<OperationId>>();
+			BuildRecursiveChildSets(graph, recursiveChildren, graph.GetRootOperationIds());
+			for (auto& [_, operation] : graph.GetOperations())
+			{
+				for (auto iterator = operation.Children.begin(); iterator != operation.Children.end();)
+				{
+					auto childId = *iterator;
+					auto isDuplicate = std::any_of(
+						operation.Children.cbegin(),
+						operation.Children.cend(),
+						[&](OperationId secondChildId)
+						{
+							return secondChildId != childId && recursiveChildren[secondChildId].contains(childId);
+						});
+
+					if (isDuplicate)
+					{
+						graph.GetOperationInfo(childId).DependencyCount--;
+						iterator = operation.Children.erase(iterator);
+					}
+					else
+					{
+						iterator++;
+					}
+				}
+			}
+		}
+
+		void BuildRecursiveChildSets(
+			OperationGraph& graph,
+			std::map<OperationId, std::set<OperationId>>& recursiveChildren,
+			const std::vector<OperationId>& operations)
+		{
+			for (auto operationId : operations)
+			{
+				if (recursiveChildren.contains(operationId))
+					continue;
+
+				auto& operation = graph.GetOperationInfo(operationId);
+				BuildRecursiveChildSets(graph, recursiveChildren, operation.Children);
+
+				auto childSet = std::set<OperationId>(operation.Children.begin(), operation.Children.end());
+				for (auto childId : operation.Children)
+				{
+					auto& childRecursiveSet = recursiveChildren.at(childId);
+					childSet.insert(childRecursiveSet.begin(), childRecursiveSet.end());
+				}
+
+				recursiveChildren.emplace(operationId, std::move(childSet));
+			}
+		}
+
+		Generate::OperationGraphGenerator CreateGenerator(FileSystemState& fileSystemState)
+		{
+			return Generate::OperationGraphGenerator(
+				fileSystemState,
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }),
+				std::vector<Path>({ Path("C:/WorkingDirectory/") }));
+		}
+	};
+}
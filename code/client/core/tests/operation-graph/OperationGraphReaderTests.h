@@ -49,7 +49,7 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '2',
 			});
 			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -61,14 +61,34 @@ namespace Soup::Core::UnitTests
 			Assert::AreEqual("Invalid operation graph files header", exception.what(), "Verify Exception message");
 		}
 
+		// [[Fact]]
+		void Deserialize_InvalidAccessSetsHeaderThrows()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'A', 'C', 'S', '2',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content, &fileSystemState]() {
+				auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+			});
+
+			Assert::AreEqual("Invalid operation graph access sets header", exception.what(), "Verify Exception message");
+		}
+
 		// [[Fact]]
 		void Deserialize_InvalidRootOperationsHeaderThrows()
 		{
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'A', 'C', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '2',
 			});
 			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -86,8 +106,9 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'A', 'C', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '2',
 			});
@@ -106,8 +127,9 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'A', 'C', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 			});
@@ -131,8 +153,10 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'A', 'C', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
@@ -192,10 +216,12 @@ namespace Soup::Core::UnitTests
 				});
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
 				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				'A', 'C', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
@@ -257,12 +283,15 @@ namespace Soup::Core::UnitTests
 				});
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x04, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
 				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
 				0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '5',
 				0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '6',
+				'A', 'C', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x06, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
@@ -288,7 +317,7 @@ namespace Soup::Core::UnitTests
 				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '4',
 				0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-				0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
@@ -0,0 +1,326 @@
+// <copyright file="OperationResultsJournalTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationResultsJournalTests
+	{
+	public:
+		// [[Fact]]
+		void Append_Reload()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+			auto results = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ inputFile, },
+						{ outputFile, })
+				},
+			});
+
+			auto uut = OperationResultsJournal(
+				Path("C:/Root/.soup/Evaluate.bor"),
+				Path("C:/Root/.soup/Evaluate.boj"),
+				results,
+				{},
+				false,
+				fileSystemState);
+			uut.Append(1, results.GetResults().at(1));
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required.");
+
+			// Verify only the journal was written
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.boj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Apply the journal on top of an empty snapshot
+			auto reloadFileSystemState = FileSystemState();
+			auto reloadResults = OperationResults();
+			auto journaledOperations = LoadJournal(*fileSystem, reloadResults, reloadFileSystemState);
+
+			Assert::IsTrue(
+				journaledOperations == std::set<OperationId>({ 1, }),
+				"Verify journaled operations match expected.");
+			Assert::AreEqual(
+				results.GetResults(),
+				reloadResults.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Append_PreviousJournal_RewritesPreviousRecords()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+			auto results = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ inputFile, },
+						{ outputFile, })
+				},
+				{
+					2,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 36min),
+						{ outputFile, },
+						{ })
+				},
+			});
+
+			// Operation 1 was only persisted by the journal of the previous build
+			auto uut = OperationResultsJournal(
+				Path("C:/Root/.soup/Evaluate.bor"),
+				Path("C:/Root/.soup/Evaluate.boj"),
+				results,
+				{ 1, },
+				false,
+				fileSystemState);
+			uut.Append(2, results.GetResults().at(2));
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required.");
+
+			// Verify the journal holds both the previous and the new record
+			auto reloadFileSystemState = FileSystemState();
+			auto reloadResults = OperationResults();
+			auto journaledOperations = LoadJournal(*fileSystem, reloadResults, reloadFileSystemState);
+
+			Assert::IsTrue(
+				journaledOperations == std::set<OperationId>({ 1, 2, }),
+				"Verify journaled operations match expected.");
+			Assert::AreEqual(
+				results.GetResults(),
+				reloadResults.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Append_StaleSnapshot_Compacts()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto results = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ inputFile, },
+						{ })
+				},
+			});
+
+			auto uut = OperationResultsJournal(
+				Path("C:/Root/.soup/Evaluate.bor"),
+				Path("C:/Root/.soup/Evaluate.boj"),
+				results,
+				{},
+				true,
+				fileSystemState);
+
+			Assert::IsTrue(uut.RequiresCompaction(), "Verify the stale snapshot requires compaction.");
+
+			uut.Append(1, results.GetResults().at(1));
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required.");
+
+			// Verify the snapshot was saved before the journal was started
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.boj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			auto reloadFileSystemState = FileSystemState();
+			auto reloadResults = OperationResults();
+			Assert::IsTrue(
+				LoadSnapshot(*fileSystem, reloadResults, reloadFileSystemState),
+				"Verify the snapshot loads.");
+			Assert::AreEqual(
+				results.GetResults(),
+				reloadResults.GetResults(),
+				"Verify snapshot results match expected.");
+		}
+
+		// [[Fact]]
+		void RequiresCompaction_MaxRecordCount()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Keep more results than records so only the record count can trigger the compaction
+			auto fileSystemState = FileSystemState();
+			auto results = OperationResults();
+			for (auto operationId = 1u; operationId <= 5000; operationId++)
+			{
+				results.AddOrUpdateOperationResult(
+					operationId,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h),
+						{ },
+						{ }));
+			}
+
+			auto uut = OperationResultsJournal(
+				Path("C:/Root/.soup/Evaluate.bor"),
+				Path("C:/Root/.soup/Evaluate.boj"),
+				results,
+				{},
+				false,
+				fileSystemState);
+			for (auto operationId = 1u; operationId < 4096; operationId++)
+			{
+				uut.Append(operationId, results.GetResults().at(operationId));
+			}
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required below the record limit.");
+
+			uut.Append(4096, results.GetResults().at(4096));
+
+			Assert::IsTrue(uut.RequiresCompaction(), "Verify compaction is required at the record limit.");
+		}
+
+		// [[Fact]]
+		void RequiresCompaction_MoreRecordsThanResults_Compact()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto results = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ inputFile, },
+						{ })
+				},
+			});
+
+			auto uut = OperationResultsJournal(
+				Path("C:/Root/.soup/Evaluate.bor"),
+				Path("C:/Root/.soup/Evaluate.boj"),
+				results,
+				{},
+				false,
+				fileSystemState);
+			uut.Append(1, results.GetResults().at(1));
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required for a single record.");
+
+			// The same operation is journaled again
+			uut.Append(1, results.GetResults().at(1));
+
+			Assert::IsTrue(uut.RequiresCompaction(), "Verify compaction is required when the records outnumber the results.");
+
+			uut.Compact();
+
+			Assert::IsFalse(uut.RequiresCompaction(), "Verify compaction is not required after compacting.");
+
+			// Verify the snapshot was saved before the journal was restarted
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.boj",
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.bor",
+					"OpenWriteBinary: C:/Root/.soup/Evaluate.boj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			auto reloadFileSystemState = FileSystemState();
+			auto reloadResults = OperationResults();
+			Assert::IsTrue(
+				LoadSnapshot(*fileSystem, reloadResults, reloadFileSystemState),
+				"Verify the snapshot loads.");
+			Assert::AreEqual(
+				results.GetResults(),
+				reloadResults.GetResults(),
+				"Verify snapshot results match expected.");
+
+			auto journaledOperations = LoadJournal(*fileSystem, reloadResults, reloadFileSystemState);
+			Assert::IsTrue(
+				journaledOperations.empty(),
+				"Verify the journal was cleared.");
+		}
+
+	private:
+		/// <summary>
+		/// Load the written journal through a copy so the reader starts from the beginning
+		/// </summary>
+		static std::set<OperationId> LoadJournal(
+			MockFileSystem& fileSystem,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			auto content = fileSystem.GetMockFile(Path("C:/Root/.soup/Evaluate.boj"))->Content.str();
+			fileSystem.CreateMockFile(
+				Path("C:/Root/.soup/LoadEvaluate.boj"),
+				std::make_shared<MockFile>(std::stringstream(content)));
+
+			return OperationResultsManager::TryLoadJournal(
+				Path("C:/Root/.soup/LoadEvaluate.boj"),
+				results,
+				fileSystemState);
+		}
+
+		/// <summary>
+		/// Load the written snapshot through a copy so the reader starts from the beginning
+		/// </summary>
+		static bool LoadSnapshot(
+			MockFileSystem& fileSystem,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			auto content = fileSystem.GetMockFile(Path("C:/Root/.soup/Evaluate.bor"))->Content.str();
+			fileSystem.CreateMockFile(
+				Path("C:/Root/.soup/LoadEvaluate.bor"),
+				std::make_shared<MockFile>(std::stringstream(content)));
+
+			return OperationResultsManager::TryLoadState(
+				Path("C:/Root/.soup/LoadEvaluate.bor"),
+				results,
+				fileSystemState);
+		}
+	};
+}
@@ -95,14 +95,19 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			});
 			fileSystem->CreateMockFile(
 				Path("./TestFiles/SimpleOperationResults/.soup/OperationResults.bor"),
@@ -146,6 +151,122 @@ namespace Soup::Core::UnitTests
 				"Verify messages match expected.");
 		}
 
+		// [[Fact]]
+		void TryLoadJournal_CorruptedRecordKeepsEarlierRecords()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// A good record, a record with an out of range input base and a good record after the corruption
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'J', '\0', 0x05, 0x00, 0x00, 0x00,
+				0x44, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x1C, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x07, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x2C, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+			});
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/CorruptedJournal/.soup/Evaluate.boj"),
+				std::make_shared<MockFile>(std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()))));
+
+			auto filePath = Path("./TestFiles/CorruptedJournal/.soup/Evaluate.boj");
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+				});
+			auto actual = OperationResults({
+				{
+					7,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ })
+				},
+			});
+			auto journaledOperations = OperationResultsManager::TryLoadJournal(filePath, actual, fileSystemState);
+
+			Assert::IsTrue(
+				journaledOperations == std::set<OperationId>({ 6, }),
+				"Verify journaled operations match expected.");
+
+			// The corrupted record and everything after it are dropped without touching the existing results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						6,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ 11, },
+							{ })
+					},
+					{
+						7,
+						OperationResult(
+							false,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: ./TestFiles/CorruptedJournal/.soup/Evaluate.boj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"WARN: Truncated operation results journal at corrupted record: Operation results observed input base index out of range",
+				}),
+				testListener->GetMessages(),
+				"Verify messages match expected.");
+		}
+
 		// [[Fact]]
 		void SaveState()
 		{
@@ -179,14 +300,19 @@ namespace Soup::Core::UnitTests
 			// Verify the file content
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			});
 			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/OperationResults.bor"));
 			Assert::AreEqual(
@@ -50,7 +50,7 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '2',
 			});
 			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -68,8 +68,9 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '2',
 			});
 			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -87,8 +88,9 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<char>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 			});
 			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
@@ -107,14 +109,19 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			});
 			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
 
@@ -149,18 +156,23 @@ namespace Soup::Core::UnitTests
 				});
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x04, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
 				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
 				0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '3',
 				0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '4',
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			});
 			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
 
@@ -199,7 +211,7 @@ namespace Soup::Core::UnitTests
 				});
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x08, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
 				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
@@ -209,17 +221,25 @@ namespace Soup::Core::UnitTests
 				0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '6',
 				0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '7',
 				0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '8',
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x06, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x80, 0x8d, 0xa9, 0xeb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 			});
 			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
 
@@ -252,5 +272,177 @@ namespace Soup::Core::UnitTests
 				actual.GetResults(),
 				"Verify results match expected.");
 		}
+
+		// [[Fact]]
+		void Deserialize_ContentDigests()
+		{
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+				0x00, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationResultsReader::Deserialize(content, fileSystemState);
+
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ 11, },
+							{ 12, },
+							{ 0x0102030405060708, }),
+					}
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Deserialize_ResourceUsage()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x05, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'I', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0xf4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationResultsReader::Deserialize(content, fileSystemState);
+
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ },
+							{ },
+							OperationResourceUsage({ 1000us, 500us, 250us, 0x100000, 3, 2, 42, })),
+					}
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void DeserializeJournal_IgnoresPartialRecord()
+		{
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'J', '\0', 0x05, 0x00, 0x00, 0x00,
+				0x44, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x44, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x07, 0x00, 0x00, 0x00,
+			});
+			auto content = std::string((char*)binaryFileContent.data(), binaryFileContent.size());
+
+			auto results = OperationResults({
+				{
+					5,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ })
+				},
+			});
+			auto journaledOperations = OperationResultsReader::DeserializeJournal(
+				content.data(),
+				content.size(),
+				results,
+				fileSystemState);
+
+			Assert::IsTrue(
+				journaledOperations == std::set<OperationId>({ 6, }),
+				"Verify journaled operations match expected.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							false,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+					{
+						6,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ 11, },
+							{ })
+					},
+				}),
+				results.GetResults(),
+				"Verify results match expected.");
+		}
 	};
 }
@@ -123,5 +123,45 @@ namespace Soup::Core::UnitTests
 				uut.GetResults(),
 				"Verify results match expected.");
 		}
+
+		// [[Fact]]
+		void InternObservedInput_Small_NotShared()
+		{
+			auto uut = OperationResults();
+
+			auto result = uut.InternObservedInput({ 1, 2, 3, });
+
+			Assert::AreEqual(std::vector<FileId>(), result.GetBase(), "Verify base is empty.");
+			Assert::AreEqual(std::vector<FileId>({ 1, 2, 3, }), result.GetDelta(), "Verify delta match expected.");
+		}
+
+		// [[Fact]]
+		void InternObservedInput_SharesCommonBase()
+		{
+			auto uut = OperationResults();
+
+			auto commonFiles = std::vector<FileId>();
+			for (FileId fileId = 1; fileId <= 18; fileId++)
+				commonFiles.push_back(fileId);
+
+			auto firstFiles = commonFiles;
+			firstFiles.insert(firstFiles.end(), { 20, 21, });
+			auto secondFiles = commonFiles;
+			secondFiles.insert(secondFiles.end(), { 30, 31, });
+			auto thirdFiles = commonFiles;
+			thirdFiles.insert(thirdFiles.end(), { 40, });
+
+			auto first = uut.InternObservedInput(firstFiles);
+			auto second = uut.InternObservedInput(secondFiles);
+			auto third = uut.InternObservedInput(thirdFiles);
+
+			// The first set seeds a base and the second splits out the common files
+			Assert::AreEqual(firstFiles, first.GetBase(), "Verify first base match expected.");
+			Assert::AreEqual(commonFiles, second.GetBase(), "Verify second base match expected.");
+			Assert::AreEqual(std::vector<FileId>({ 30, 31, }), second.GetDelta(), "Verify second delta match expected.");
+			Assert::IsTrue(&second.GetBase() == &third.GetBase(), "Verify third shares the common base.");
+			Assert::AreEqual(std::vector<FileId>({ 40, }), third.GetDelta(), "Verify third delta match expected.");
+			Assert::IsTrue(InputSet(thirdFiles) == third, "Verify third files match expected.");
+		}
 	};
 }
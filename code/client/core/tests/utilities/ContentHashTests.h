@@ -0,0 +1,63 @@
+// <copyright file="ContentHashTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class ContentHashTests
+	{
+	public:
+		// [[Fact]]
+		void Compute_Empty()
+		{
+			auto actual = ContentHash::Compute("");
+
+			uint64_t expected = 0xEF46DB3751D8E999ull;
+			Assert::AreEqual(expected, actual, "Verify digest matches expected.");
+		}
+
+		// [[Fact]]
+		void Compute_Short()
+		{
+			auto actual = ContentHash::Compute("abc");
+
+			uint64_t expected = 0x44BC2CF5AD770999ull;
+			Assert::AreEqual(expected, actual, "Verify digest matches expected.");
+		}
+
+		// [[Fact]]
+		void Compute_MultipleStripes()
+		{
+			auto actual = ContentHash::Compute("Nobody inspects the spammish repetition");
+
+			uint64_t expected = 0xFBCEA83C8A378BF1ull;
+			Assert::AreEqual(expected, actual, "Verify digest matches expected.");
+		}
+
+		// [[Fact]]
+		void Compute_DifferentContent()
+		{
+			auto first = ContentHash::Compute("int main() { return 0; }");
+			auto second = ContentHash::Compute("int main() { return 1; }");
+
+			Assert::AreNotEqual(first, second, "Verify digests do not match.");
+		}
+
+		// [[Fact]]
+		void Stream_MatchesCompute()
+		{
+			auto content = std::string_view("Nobody inspects the spammish repetition, nobody inspects it twice");
+
+			// Split on boundaries that do not line up with the 32 byte stripes
+			auto uut = ContentHash::Stream();
+			uut.Update(content.substr(0, 5));
+			uut.Update(content.substr(5, 30));
+			uut.Update(content.substr(35));
+			auto actual = uut.Finalize();
+
+			Assert::AreEqual(ContentHash::Compute(content), actual, "Verify digest matches expected.");
+		}
+	};
+}
@@ -0,0 +1,129 @@
+// <copyright file="MappedFileTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class MappedFileTests
+	{
+	public:
+		// [[Fact]]
+		void TryOpen_MissingFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = MappedFile();
+			auto result = uut.TryOpen(Path("./TestFiles/NoFile/File.bin"));
+
+			Assert::IsFalse(result, "Verify result is false.");
+			Assert::AreEqual<size_t>(0, uut.GetSize(), "Verify size is empty.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: ./TestFiles/NoFile/File.bin",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryOpen_EmptyFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/Empty/File.bin"),
+				std::make_shared<MockFile>(std::stringstream()));
+
+			auto uut = MappedFile();
+			auto result = uut.TryOpen(Path("./TestFiles/Empty/File.bin"));
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual<size_t>(0, uut.GetSize(), "Verify size is empty.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: ./TestFiles/Empty/File.bin",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryOpen_SmallFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+			});
+			auto content = std::string(binaryFileContent.data(), binaryFileContent.size());
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/Small/File.bin"),
+				std::make_shared<MockFile>(std::stringstream(content)));
+
+			auto uut = MappedFile();
+			auto result = uut.TryOpen(Path("./TestFiles/Small/File.bin"));
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual(
+				content,
+				std::string(uut.GetData(), uut.GetSize()),
+				"Verify content matches expected.");
+		}
+
+		// [[Fact]]
+		void TryOpen_LargeFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// Cover every byte value over more than a single read buffer
+			auto content = std::string();
+			content.reserve(4 * 1024 * 1024);
+			for (auto i = 0u; i < 4 * 1024 * 1024; i++)
+				content.push_back(static_cast<char>(i * 31));
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/Large/File.bin"),
+				std::make_shared<MockFile>(std::stringstream(content)));
+
+			auto uut = MappedFile();
+			auto result = uut.TryOpen(Path("./TestFiles/Large/File.bin"));
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual<size_t>(content.size(), uut.GetSize(), "Verify size matches expected.");
+			Assert::IsTrue(
+				std::memcmp(content.data(), uut.GetData(), content.size()) == 0,
+				"Verify content matches expected.");
+		}
+
+		// [[Fact]]
+		void TryOpen_Reopen_ReplacesContent()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/First/File.bin"),
+				std::make_shared<MockFile>(std::stringstream("First")));
+
+			auto uut = MappedFile();
+			Assert::IsTrue(uut.TryOpen(Path("./TestFiles/First/File.bin")), "Verify first result is true.");
+
+			auto result = uut.TryOpen(Path("./TestFiles/Second/File.bin"));
+
+			Assert::IsFalse(result, "Verify second result is false.");
+			Assert::AreEqual<size_t>(0, uut.GetSize(), "Verify the previous content was released.");
+		}
+	};
+}
@@ -0,0 +1,141 @@
+// <copyright file="WrenModuleCacheTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class WrenModuleCacheTests
+	{
+	public:
+		// [[Fact]]
+		void TryGetSource_MissingFile()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = WrenModuleCache();
+			auto result = uut.TryGetSource(Path("C:/Extension/Missing.wren"));
+
+			Assert::IsTrue(result == nullptr, "Verify result is null.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Extension/Missing.wren",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void TryGetSource_Hit_ReusesSource()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Build.wren"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Extension/Build.wren"))->Content = std::stringstream("class Build {}");
+
+			auto uut = WrenModuleCache();
+			auto first = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+			auto second = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+
+			Assert::IsTrue(first != nullptr, "Verify first result is not null.");
+			Assert::AreEqual<std::string>("class Build {}", *first, "Verify source matches expected.");
+			Assert::IsTrue(first == second, "Verify the cached source was reused.");
+		}
+
+		// [[Fact]]
+		void TryGetSource_ChangedWriteTime_Reloads()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Build.wren"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Extension/Build.wren"))->Content = std::stringstream("class Build {}");
+
+			auto uut = WrenModuleCache();
+			auto first = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+
+			// Update the file with the same size
+			fileSystem->GetMockFile(Path("C:/Extension/Build.wren"))->Content = std::stringstream("class Other {}");
+			fileSystem->SetLastWriteTime(
+				Path("C:/Extension/Build.wren"),
+				std::chrono::clock_cast<std::chrono::file_clock>(
+					std::chrono::sys_days(May/22/2015) + 9h + 12min));
+
+			auto second = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+
+			Assert::AreEqual<std::string>("class Build {}", *first, "Verify first source matches expected.");
+			Assert::AreEqual<std::string>("class Other {}", *second, "Verify second source matches expected.");
+		}
+
+		// [[Fact]]
+		void TryGetSource_ChangedSize_Reloads()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Build.wren"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Extension/Build.wren"))->Content = std::stringstream("class Build {}");
+
+			auto uut = WrenModuleCache();
+			auto first = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+
+			// Rewrite the file within the same write time
+			fileSystem->GetMockFile(Path("C:/Extension/Build.wren"))->Content = std::stringstream("class Build { static run() {} }");
+
+			auto second = uut.TryGetSource(Path("C:/Extension/Build.wren"));
+
+			Assert::AreEqual<std::string>("class Build {}", *first, "Verify first source matches expected.");
+			Assert::AreEqual<std::string>("class Build { static run() {} }", *second, "Verify second source matches expected.");
+		}
+
+		// [[Fact]]
+		void TryGetBundles_Hit_ReusesBundles()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Extension/Bundles.sml"),
+				std::make_shared<MockFile>(
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::sys_days(May/22/2015) + 9h + 11min)));
+			fileSystem->GetMockFile(Path("C:/Extension/Bundles.sml"))->Content = std::stringstream(
+				"Bundles: {\n"
+				"	Soup: {\n"
+				"		Root: \"./Soup/\"\n"
+				"	}\n"
+				"}\n");
+
+			auto uut = WrenModuleCache();
+			auto first = uut.TryGetBundles(Path("C:/Extension/Bundles.sml"));
+			auto second = uut.TryGetBundles(Path("C:/Extension/Bundles.sml"));
+
+			Assert::IsTrue(first != nullptr, "Verify first result is not null.");
+			Assert::AreEqual<size_t>(1, first->size(), "Verify bundle count matches expected.");
+			Assert::AreEqual(Path("./Soup/"), first->at("Soup"), "Verify bundle root matches expected.");
+			Assert::IsTrue(first == second, "Verify the cached bundles were reused.");
+		}
+	};
+}
@@ -14,7 +14,7 @@ namespace Soup.Build.Utilities;
 internal static class OperationGraphReader
 {
 	// Binary Operation Graph file format
-	private static uint FileVersion => 6;
+	private static uint FileVersion => 7;
 
 	public static OperationGraph Deserialize(System.IO.BinaryReader reader)
 	{
@@ -55,6 +55,23 @@ internal static class OperationGraphReader
 			files.Add((fileId, file));
 		}
 
+		// Read the set of shared access lists
+		headerBuffer = reader.ReadBytes(4);
+		if (headerBuffer[0] != 'A' ||
+			headerBuffer[1] != 'C' ||
+			headerBuffer[2] != 'S' ||
+			headerBuffer[3] != '\0')
+		{
+			throw new InvalidOperationException("Invalid operation graph access sets header");
+		}
+
+		var accessSetCount = reader.ReadUInt32();
+		var accessSets = new List<List<FileId>>((int)accessSetCount);
+		for (var i = 0; i < accessSetCount; i++)
+		{
+			accessSets.Add(ReadFileIdList(reader));
+		}
+
 		// Read the set of operations
 		headerBuffer = reader.ReadBytes(4);
 		if (headerBuffer[0] != 'R' ||
@@ -82,7 +99,7 @@ internal static class OperationGraphReader
 		var operations = new List<OperationInfo>();
 		for (var i = 0; i < operationCount; i++)
 		{
-			operations.Add(ReadOperationInfo(reader));
+			operations.Add(ReadOperationInfo(reader, accessSets));
 		}
 
 		if (reader.BaseStream.Position != reader.BaseStream.Length)
@@ -97,7 +114,9 @@ internal static class OperationGraphReader
 			operations);
 	}
 
-	private static OperationInfo ReadOperationInfo(System.IO.BinaryReader reader)
+	private static OperationInfo ReadOperationInfo(
+		System.IO.BinaryReader reader,
+		List<List<FileId>> accessSets)
 	{
 		// Read the operation id
 		var id = new OperationId(reader.ReadUInt32());
@@ -121,10 +140,10 @@ internal static class OperationGraphReader
 		var declaredOutput = ReadFileIdList(reader);
 
 		// Read the read access list
-		var readAccess = ReadFileIdList(reader);
+		var readAccess = ReadAccessSet(reader, accessSets);
 
 		// Read the write access list
-		var writeAccess = ReadFileIdList(reader);
+		var writeAccess = ReadAccessSet(reader, accessSets);
 
 		// Read the child operation ids
 		var children = ReadOperationIdList(reader);
@@ -179,6 +198,19 @@ internal static class OperationGraphReader
 		return result;
 	}
 
+	private static List<FileId> ReadAccessSet(
+		System.IO.BinaryReader reader,
+		List<List<FileId>> accessSets)
+	{
+		var index = reader.ReadUInt32();
+		if (index >= accessSets.Count)
+		{
+			throw new InvalidOperationException("Operation graph access set index out of range");
+		}
+
+		return accessSets[(int)index];
+	}
+
 	private static List<OperationId> ReadOperationIdList(System.IO.BinaryReader reader)
 	{
 		var size = reader.ReadUInt32();
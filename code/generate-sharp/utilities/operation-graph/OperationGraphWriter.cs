@@ -4,6 +4,7 @@
 
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 
 namespace Soup.Build.Utilities;
 
@@ -13,10 +14,11 @@ namespace Soup.Build.Utilities;
 internal static class OperationGraphWriter
 {
 	// Binary Operation graph file format
-	private static uint FileVersion => 6;
+	private static uint FileVersion => 7;
 
 	internal static readonly char[] FIS = ['F', 'I', 'S', '\0'];
 	internal static readonly char[] BOG = ['B', 'O', 'G', '\0'];
+	internal static readonly char[] ACS = ['A', 'C', 'S', '\0'];
 	internal static readonly char[] ROP = ['R', 'O', 'P', '\0'];
 	internal static readonly char[] OPS = ['O', 'P', 'S', '\0'];
 
@@ -37,6 +39,22 @@ internal static class OperationGraphWriter
 			WriteValue(writer, file.Path.ToString());
 		}
 
+		// Write out the shared access lists once and reference them by index from each operation
+		var accessSets = new List<IList<FileId>>();
+		var accessSetLookup = new Dictionary<string, uint>();
+		foreach (var operationValue in state.Operations)
+		{
+			InternAccessSet(operationValue.Value.ReadAccess, accessSets, accessSetLookup);
+			InternAccessSet(operationValue.Value.WriteAccess, accessSets, accessSetLookup);
+		}
+
+		writer.Write(ACS);
+		writer.Write((uint)accessSets.Count);
+		foreach (var accessSet in accessSets)
+		{
+			WriteValues(writer, accessSet);
+		}
+
 		// Write out the root operation ids
 		writer.Write(ROP);
 		WriteValues(writer, state.RootOperationIds);
@@ -46,11 +64,32 @@ internal static class OperationGraphWriter
 		writer.Write((uint)state.Operations.Count);
 		foreach (var operationValue in state.Operations)
 		{
-			WriteOperationInfo(writer, operationValue.Value);
+			WriteOperationInfo(writer, operationValue.Value, accessSetLookup);
 		}
 	}
 
-	private static void WriteOperationInfo(BinaryWriter writer, OperationInfo operation)
+	private static void InternAccessSet(
+		IList<FileId> accessSet,
+		List<IList<FileId>> accessSets,
+		Dictionary<string, uint> accessSetLookup)
+	{
+		var key = GetAccessSetKey(accessSet);
+		if (!accessSetLookup.ContainsKey(key))
+		{
+			accessSetLookup.Add(key, (uint)accessSets.Count);
+			accessSets.Add(accessSet);
+		}
+	}
+
+	private static string GetAccessSetKey(IList<FileId> accessSet)
+	{
+		return string.Join(',', accessSet.Select(value => value.Value));
+	}
+
+	private static void WriteOperationInfo(
+		BinaryWriter writer,
+		OperationInfo operation,
+		Dictionary<string, uint> accessSetLookup)
 	{
 		// Write out the operation id
 		writer.Write(operation.Id.Value);
@@ -73,11 +112,11 @@ internal static class OperationGraphWriter
 		// Write out the declared output files
 		WriteValues(writer, operation.DeclaredOutput);
 
-		// Write out the read access list
-		WriteValues(writer, operation.ReadAccess);
+		// Write out the read access set index
+		writer.Write(accessSetLookup[GetAccessSetKey(operation.ReadAccess)]);
 
-		// Write out the write access list
-		WriteValues(writer, operation.WriteAccess);
+		// Write out the write access set index
+		writer.Write(accessSetLookup[GetAccessSetKey(operation.WriteAccess)]);
 
 		// Write out the child operation ids
 		WriteValues(writer, operation.Children);
@@ -14,7 +14,7 @@ namespace Soup.Build.Utilities;
 internal static class OperationResultsReader
 {
 	// Binary Operation Results file format
-	private static uint FileVersion => 2;
+	private static uint FileVersion => 5;
 
 	public static OperationResults Deserialize(System.IO.BinaryReader reader)
 	{
@@ -55,6 +55,23 @@ internal static class OperationResultsReader
 			files.Add((fileId, file));
 		}
 
+		// Read the shared observed input bases
+		headerBuffer = reader.ReadBytes(4);
+		if (headerBuffer[0] != 'O' ||
+			headerBuffer[1] != 'I' ||
+			headerBuffer[2] != 'S' ||
+			headerBuffer[3] != '\0')
+		{
+			throw new InvalidOperationException("Invalid operation results observed input header");
+		}
+
+		var observedInputBaseCount = reader.ReadUInt32();
+		var observedInputBases = new List<List<FileId>>((int)observedInputBaseCount);
+		for (var i = 0; i < observedInputBaseCount; i++)
+		{
+			observedInputBases.Add(ReadFileIdList(reader));
+		}
+
 		// Read the set of operation results
 		headerBuffer = reader.ReadBytes(4);
 		if (headerBuffer[0] != 'R' ||
@@ -69,7 +86,7 @@ internal static class OperationResultsReader
 		var operationResults = new Dictionary<OperationId, OperationResult>();
 		for (var i = 0; i < operationResultsCount; i++)
 		{
-			var (operationId, operationResult) = ReadOperationInfo(reader);
+			var (operationId, operationResult) = ReadOperationInfo(reader, observedInputBases);
 			operationResults.Add(operationId, operationResult);
 		}
 
@@ -84,7 +101,9 @@ internal static class OperationResultsReader
 			operationResults);
 	}
 
-	private static (OperationId, OperationResult) ReadOperationInfo(System.IO.BinaryReader reader)
+	private static (OperationId, OperationResult) ReadOperationInfo(
+		System.IO.BinaryReader reader,
+		List<List<FileId>> observedInputBases)
 	{
 		// Read the operation id
 		var id = new OperationId(reader.ReadUInt32());
@@ -95,12 +114,30 @@ internal static class OperationResultsReader
 		// Read the utc tick since January 1, 0001 at 00:00:00.000 in the Gregorian calendar
 		var evaluateTime = new DateTime(reader.ReadInt64(), DateTimeKind.Utc);
 
-		// Read the observed input files
-		var observedInput = ReadFileIdList(reader);
+		// Read the observed input files as the shared base and the files unique to this result
+		var observedInputBaseIndex = reader.ReadUInt32();
+		if (observedInputBaseIndex >= observedInputBases.Count)
+		{
+			throw new InvalidOperationException("Operation results observed input base index out of range");
+		}
+
+		var observedInput = new List<FileId>(observedInputBases[(int)observedInputBaseIndex]);
+		observedInput.AddRange(ReadFileIdList(reader));
 
 		// Read the observed output files
 		var observedOutput = ReadFileIdList(reader);
 
+		// Skip the observed input content digests
+		var observedInputDigestCount = reader.ReadUInt32();
+		reader.BaseStream.Seek(observedInputDigestCount * sizeof(ulong), System.IO.SeekOrigin.Current);
+
+		// Skip the resource usage, three durations followed by four counters
+		var hasResourceUsage = ReadBoolean(reader);
+		if (hasResourceUsage)
+		{
+			reader.BaseStream.Seek((3 * sizeof(long)) + (4 * sizeof(ulong)), System.IO.SeekOrigin.Current);
+		}
+
 		return (id, new OperationResult(
 			wasSuccessfulRun,
 			evaluateTime,
@@ -65,7 +65,7 @@ namespace Soup::Core::Generate
 
 		static const char* GetSoupTestModuleSource()
 		{
-			return soupTestModuleSource;
+			return soupTestModuleSource.c_str();
 		}
 
 		static const char* GetSoupModuleSource()
@@ -73,7 +73,61 @@ namespace Soup::Core::Generate
 			return soupModuleSource;
 		}
 
-		static inline const char* soupTestModuleSource =
+		/// <summary>
+		/// The tests own the state as plain maps, the tasks see them through the same state table as the real host
+		/// and the changes are applied back to the maps the next time a test reads them
+		/// </summary>
+		static inline const std::string soupTestModuleSource =
+			std::string(
+				"class StateTableReference {\n"
+				"	construct new_(map) {\n"
+				"		_map = map\n"
+				"	}\n"
+				"\n"
+				"	keys { _map.keys.toList }\n"
+				"	containsKey(key) { _map.containsKey(key) }\n"
+				"\n"
+				"	[key] {\n"
+				"		var value = _map[key]\n"
+				"		if (value is Map) return StateTableReference.new_(value)\n"
+				"		return StateTableReference.copy_(value)\n"
+				"	}\n"
+				"\n"
+				"	isUnchanged_(key, value) {\n"
+				"		return _map.containsKey(key) && StateTableReference.equals_(_map[key], value)\n"
+				"	}\n"
+				"\n"
+				"	static copy_(value) {\n"
+				"		if (value is List) return value.map {|item| copy_(item) }.toList\n"
+				"		if (value is Map) {\n"
+				"			var result = {}\n"
+				"			for (entry in value) result[entry.key] = copy_(entry.value)\n"
+				"			return result\n"
+				"		}\n"
+				"		return value\n"
+				"	}\n"
+				"\n"
+				"	static equals_(original, value) {\n"
+				"		if (original is List) {\n"
+				"			if (!(value is List) || original.count != value.count) return false\n"
+				"			for (i in 0...original.count) {\n"
+				"				if (!equals_(original[i], value[i])) return false\n"
+				"			}\n"
+				"			return true\n"
+				"		}\n"
+				"		if (original is Map) {\n"
+				"			if (!(value is Map) || original.count != value.count) return false\n"
+				"			for (entry in original) {\n"
+				"				if (!value.containsKey(entry.key) || !equals_(entry.value, value[entry.key])) return false\n"
+				"			}\n"
+				"			return true\n"
+				"		}\n"
+				"		return original == value\n"
+				"	}\n"
+				"}\n"
+				"\n") +
+			GenerateHost::StateTableSource +
+			"\n"
 			"class SoupTestOperation {\n"
 			"	construct new(title, executable, arguments, workingDirectory, declaredInput, declaredOutput) {\n"
 			"		_title = title\n"
@@ -105,6 +159,9 @@ namespace Soup::Core::Generate
 			"		__globalState = {}\n"
 			"		__activeState = {}\n"
 			"		__sharedState = {}\n"
+			"		__globalTable = null\n"
+			"		__activeTable = null\n"
+			"		__sharedTable = null\n"
 			"		__operations = []\n"
 			"		__logs = []\n"
 			"	}\n"
@@ -114,19 +171,51 @@ namespace Soup::Core::Generate
 			"\n"
 			"	static globalState {\n"
 			"		if (__globalState is Null) Fiber.abort(\"Must initialize global state before access\")\n"
+			"		__globalTable = null\n"
 			"		return __globalState\n"
 			"	}\n"
 			"\n"
 			"	static activeState {\n"
 			"		if (__activeState is Null) Fiber.abort(\"Must initialize active state before access\")\n"
+			"		if (!(__activeTable is Null)) applyChanges_(__activeState, __activeTable.changes_)\n"
+			"		__activeTable = null\n"
 			"		return __activeState\n"
 			"	}\n"
 			"\n"
 			"	static sharedState {\n"
 			"		if (__sharedState is Null) Fiber.abort(\"Must initialize shared state before access\")\n"
+			"		if (!(__sharedTable is Null)) applyChanges_(__sharedState, __sharedTable.changes_)\n"
+			"		__sharedTable = null\n"
 			"		return __sharedState\n"
 			"	}\n"
 			"\n"
+			"	static globalTable_ {\n"
+			"		if (__globalTable is Null) __globalTable = StateTable.new_(StateTableReference.new_(globalState))\n"
+			"		return __globalTable\n"
+			"	}\n"
+			"\n"
+			"	static activeTable_ {\n"
+			"		if (__activeTable is Null) __activeTable = StateTable.new_(StateTableReference.new_(activeState))\n"
+			"		return __activeTable\n"
+			"	}\n"
+			"\n"
+			"	static sharedTable_ {\n"
+			"		if (__sharedTable is Null) __sharedTable = StateTable.new_(StateTableReference.new_(sharedState))\n"
+			"		return __sharedTable\n"
+			"	}\n"
+			"\n"
+			"	static applyChanges_(map, changes) {\n"
+			"		for (change in changes) {\n"
+			"			if (change.value[0] == 0) {\n"
+			"				map[change.key] = change.value[1]\n"
+			"			} else if (change.value[0] == 1) {\n"
+			"				map.remove(change.key)\n"
+			"			} else {\n"
+			"				applyChanges_(map[change.key], change.value[1])\n"
+			"			}\n"
+			"		}\n"
+			"	}\n"
+			"\n"
 			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput) {\n"
 			"		if (__operations is Null) Fiber.abort(\"Operations not initialized.\")\n"
 			"		__operations.add(SoupTestOperation.new(title, executable, arguments, workingDirectory, declaredInput, declaredOutput))\n"
@@ -159,15 +248,15 @@ namespace Soup::Core::Generate
 			"\n"
 			"class Soup {\n"
 			"	static globalState {\n"
-			"		return SoupTest.globalState\n"
+			"		return SoupTest.globalTable_\n"
 			"	}\n"
 			"\n"
 			"	static activeState {\n"
-			"		return SoupTest.activeState\n"
+			"		return SoupTest.activeTable_\n"
 			"	}\n"
 			"\n"
 			"	static sharedState {\n"
-			"		return SoupTest.sharedState\n"
+			"		return SoupTest.sharedTable_\n"
 			"	}\n"
 			"\n"
 			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput) {\n"
@@ -180,6 +269,26 @@ namespace Soup::Core::Generate
 			"		SoupTest.createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
 			"	}\n"
 			"\n"
+			"	static createOperations(executable, workingDirectory, arguments, declaredInput, operations) {\n"
+			"		if (!(executable is String)) Fiber.abort(\"Executable must be a string.\")\n"
+			"		if (!(workingDirectory is String)) Fiber.abort(\"WorkingDirectory must be a string.\")\n"
+			"		if (!(arguments is List)) Fiber.abort(\"Arguments must be a list.\")\n"
+			"		if (!(declaredInput is List)) Fiber.abort(\"DeclaredInput must be a list.\")\n"
+			"		if (!(operations is List)) Fiber.abort(\"Operations must be a list.\")\n"
+			"\n"
+			"		// Record a batch as the individual operations it creates so tests assert the same way for both\n"
+			"		for (operation in operations) {\n"
+			"			if (!(operation is Map)) Fiber.abort(\"Operation must be a map.\")\n"
+			"			createOperation(\n"
+			"				operation[\"Title\"],\n"
+			"				executable,\n"
+			"				arguments + (operation[\"Arguments\"] || []),\n"
+			"				workingDirectory,\n"
+			"				declaredInput + (operation[\"DeclaredInput\"] || []),\n"
+			"				operation[\"DeclaredOutput\"] || [])\n"
+			"		}\n"
+			"	}\n"
+			"\n"
 			"	static info(message) {\n"
 			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
 			"		SoupTest.info(message)\n"
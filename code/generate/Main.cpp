@@ -80,11 +80,10 @@ using namespace Opal;
 #include "recipe/RecipeBuildStateConverter.h"
 #include "recipe/RecipeExtensions.h"
 #include "value-table/ValueTableManager.h"
+#include "generate/GenerateEngine.h"
 
 #endif
 
-#include "GenerateEngine.h"
-
 int main(int argc, char** argv)
 {
 	try
@@ -120,7 +119,9 @@ int main(int argc, char** argv)
 		}
 
 		auto soupTargetDirectory = Path(argv[1]);
-		auto generateEngine = Soup::Core::Generate::GenerateEngine();
+		auto fileSystemState = Soup::Core::FileSystemState();
+		auto hostPool = Soup::Core::Generate::GenerateHostPool();
+		auto generateEngine = Soup::Core::Generate::GenerateEngine(fileSystemState, hostPool);
 		generateEngine.Run(soupTargetDirectory);
 	}
 	catch (const std::exception& ex)
@@ -28,11 +28,13 @@ namespace Monitor
 				m_allowedWriteDirectories.push_back(NormalizePath(value.c_str()));
 		}
 
+	#ifdef _WIN32
 		static void UpdateWorkingDirectory(const wchar_t* fileName)
 		{
 			auto fileNameEncoded = UTF8Encode(fileName);
 			return UpdateWorkingDirectory(fileNameEncoded.c_str());
 		}
+	#endif
 
 		static void UpdateWorkingDirectory(const char* fileName)
 		{
@@ -48,6 +50,7 @@ namespace Monitor
 			}
 		}
 
+	#ifdef _WIN32
 		static bool IsAllowed(const wchar_t* fileName, DWORD desiredAccess)
 		{
 			bool isWrite = (desiredAccess & GENERIC_WRITE) != 0;
@@ -65,6 +68,25 @@ namespace Monitor
 			else
 				return IsReadAllowed(fileName);
 		}
+	#elif defined(__linux__)
+		static bool IsAllowed(const char* fileName, int flags)
+		{
+			bool isWrite = (flags & O_ACCMODE) != O_RDONLY || (flags & (O_CREAT | O_TRUNC)) != 0;
+			if (isWrite)
+				return IsWriteAllowed(fileName);
+			else
+				return IsReadAllowed(fileName);
+		}
+
+		static bool IsAllowed(const char* fileName, const char* mode)
+		{
+			bool isWrite = strpbrk(mode, "wa+") != nullptr;
+			if (isWrite)
+				return IsWriteAllowed(fileName);
+			else
+				return IsReadAllowed(fileName);
+		}
+	#endif
 
 		static bool IsReadAllowed(const char* fileName)
 		{
@@ -84,6 +106,7 @@ namespace Monitor
 			return false;
 		}
 
+	#ifdef _WIN32
 		static bool IsReadAllowed(const wchar_t* fileName)
 		{
 			if (!m_enableAccessChecks)
@@ -92,6 +115,7 @@ namespace Monitor
 			auto fileNameEncoded = UTF8Encode(fileName);
 			return IsReadAllowed(fileNameEncoded.c_str());
 		}
+	#endif
 
 		static bool IsWriteAllowed(const char* fileName)
 		{
@@ -111,6 +135,7 @@ namespace Monitor
 			return false;
 		}
 
+	#ifdef _WIN32
 		static bool IsWriteAllowed(const wchar_t* fileName)
 		{
 			if (!m_enableAccessChecks)
@@ -119,12 +144,19 @@ namespace Monitor
 			auto fileNameEncoded = UTF8Encode(fileName);
 			return IsWriteAllowed(fileNameEncoded.c_str());
 		}
+	#endif
 
 	private:
 		static bool IsPipe(const char* fileName)
 		{
+		#ifdef _WIN32
 			auto file = std::string(fileName);
 			return file.starts_with("\\\\.\\");
+		#else
+			// Pipes are reported as anonymous descriptors, they never go through a path
+			(void)fileName;
+			return false;
+		#endif
 		}
 
 		static std::string NormalizePath(const char* fileName)
@@ -138,8 +170,10 @@ namespace Monitor
 
 			auto result = path.ToString();
 
+		#ifdef _WIN32
 			// Ignore case
 			std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c){ return (char)std::toupper(c); });
+		#endif
 
 			return result;
 		}
@@ -149,6 +183,7 @@ namespace Monitor
 			return fileName.find(directory) == 0;
 		}
 
+	#ifdef _WIN32
 		static std::string UTF8Encode(const std::wstring_view wideString)
 		{
 			if (wideString.empty())
@@ -163,6 +198,7 @@ namespace Monitor
 
 			return result;
 		}
+	#endif
 
 		static bool m_enableAccessChecks;
 		static Opal::Path m_workingDirectory;
@@ -2,6 +2,7 @@
 // TODO: Warning unsafe method
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 #include <algorithm>
+#include <chrono>
 #include <locale>
 #include <codecvt>
 #include <format>
@@ -30,9 +31,21 @@
 #elif defined(__linux__)
 
 #include <dlfcn.h>
+#include <elf.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <spawn.h>
 #include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
 #include <unistd.h>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
 
 #endif
 
@@ -20,6 +20,7 @@ namespace Monitor::Linux
 		Functions::Cache::FileApi::fdopen = (fdopen_ptr)dlsym(RTLD_NEXT, "fdopen");
 		Functions::Cache::FileApi::freopen = (freopen_ptr)dlsym(RTLD_NEXT, "freopen");
 		Functions::Cache::FileApi::mkdir = (mkdir_ptr)dlsym(RTLD_NEXT, "mkdir");
+		Functions::Cache::FileApi::rmdir = (rmdir_ptr)dlsym(RTLD_NEXT, "rmdir");
 
 		// ProcessApi
 		Functions::Cache::ProcessApi::system = (system_ptr)dlsym(RTLD_NEXT, "system");
@@ -39,5 +40,8 @@ namespace Monitor::Linux
 		Functions::Cache::ProcessApi::execve = (execve_ptr)dlsym(RTLD_NEXT, "execve");
 		Functions::Cache::ProcessApi::execveat = (execveat_ptr)dlsym(RTLD_NEXT, "execveat");
 		Functions::Cache::ProcessApi::fexecve = (fexecve_ptr)dlsym(RTLD_NEXT, "fexecve");
+
+		Functions::Cache::ProcessApi::posix_spawn = (posix_spawn_ptr)dlsym(RTLD_NEXT, "posix_spawn");
+		Functions::Cache::ProcessApi::posix_spawnp = (posix_spawnp_ptr)dlsym(RTLD_NEXT, "posix_spawnp");
 	}
 }
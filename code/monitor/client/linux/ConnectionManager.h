@@ -10,54 +10,104 @@ namespace Monitor::Linux
 	public:
 		ConnectionManager() :
 		 	ConnectionManagerBase(),
-			pipeHandle()
+			ringHandle(-1),
+			ringMemory(nullptr),
+			ringSize(0),
+			ring(nullptr)
 		{
 		}
 
+		/// <summary>
+		/// Map the shared memory ring that the host passed down through the environment
+		/// </summary>
+		const ProcessPayload& LoadPayload()
+		{
+			DebugTrace("ConnectionManager::LoadPayload");
+
+			auto handleValue = getenv(MessageRingHandleVariable);
+			if (handleValue == nullptr)
+				throw std::runtime_error("Missing monitor message ring handle");
+
+			ringHandle = atoi(handleValue);
+
+			// Map the header first to find the full size of the ring
+			auto headerSize = MessageRing::GetSize(0);
+			auto header = mmap(nullptr, headerSize, PROT_READ, MAP_SHARED, ringHandle, 0);
+			if (header == MAP_FAILED)
+				throw std::runtime_error("Failed to map monitor message ring header");
+			auto slotCount = uint32_t();
+			try
+			{
+				slotCount = MessageRing::GetSlotCount(header);
+			}
+			catch (...)
+			{
+				munmap(header, headerSize);
+				throw;
+			}
+
+			munmap(header, headerSize);
+
+			ringSize = MessageRing::GetSize(slotCount);
+			ringMemory = mmap(nullptr, ringSize, PROT_READ | PROT_WRITE, MAP_SHARED, ringHandle, 0);
+			if (ringMemory == MAP_FAILED)
+			{
+				ringMemory = nullptr;
+				throw std::runtime_error("Failed to map monitor message ring");
+			}
+
+			ring = MessageRing(ringMemory);
+			return ring.GetPayload();
+		}
+
+		/// <summary>
+		/// Get the payload from the mapped ring
+		/// </summary>
+		const ProcessPayload& GetPayload()
+		{
+			if (ringMemory == nullptr)
+				throw std::runtime_error("Monitor message ring was not loaded");
+
+			return ring.GetPayload();
+		}
+
 	protected:
 		virtual void Connect(int32_t traceProcessId)
 		{
 			DebugTrace("ConnectionManager::Connect");
 
-			auto pipeName = std::string("/tmp/soupbuildfifo");
-			pipeHandle = Functions::Cache::FileApi::open(pipeName.c_str(), O_WRONLY);
+			// The ring is mapped while loading the payload, keep the handle open for child processes
+			if (ringMemory == nullptr)
+				throw std::runtime_error("Monitor message ring was not loaded");
 		}
 
 		virtual void Disconnect()
 		{
 			DebugTrace("ConnectionManager::Disconnect");
-			close(pipeHandle);
+			if (ringMemory != nullptr)
+			{
+				munmap(ringMemory, ringSize);
+				ringMemory = nullptr;
+			}
 		}
 
 		virtual bool TryUnsafeWriteMessage(const Message& message)
 		{
 			DebugTrace("ConnectionManager::TryUnsafeWriteMessage");
-
-			// Write the message
-			size_t countBytesToWrite = message.ContentSize +
-				sizeof(Message::Type) +
-				sizeof(Message::ContentSize);
-			auto countBytesWritten = write(
-				pipeHandle,
-				&message,
-				countBytesToWrite);
-			if (countBytesWritten == -1)
-			{
-				DebugError("Failed write event logger");
-				return false;
-			}
-
-			if (countBytesWritten != countBytesToWrite)
+			if (ringMemory == nullptr)
 			{
-				DebugError("Did not write the expected number of bytes");
+				DebugError("Monitor message ring is not connected");
 				return false;
 			}
 
-			return true;
+			return ring.Write(message);
 		}
 
 	private:
-		int pipeHandle;
+		int ringHandle;
+		void* ringMemory;
+		size_t ringSize;
+		MessageRing ring;
 	};
 }
 
@@ -0,0 +1,61 @@
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Resolve the relative paths passed to the intercepted calls while the calling process still owns the
+	/// working directory and directory descriptors, the host only ever sees the message after the fact
+	/// </summary>
+	class PathResolver
+	{
+	public:
+		static std::string Resolve(const char* path)
+		{
+			return Resolve(AT_FDCWD, path);
+		}
+
+		static std::string Resolve(int dirfd, const char* path)
+		{
+			if (path == nullptr)
+				return std::string();
+
+			if (path[0] == '/')
+				return std::string(path);
+
+			// Pass along the raw path if the directory is gone, the call itself will fail the same way
+			auto directory = GetDirectory(dirfd);
+			if (directory.empty())
+				return std::string(path);
+
+			// An empty path refers to the directory descriptor itself
+			if (path[0] == 0)
+				return directory;
+
+			if (directory.back() != '/')
+				directory.push_back('/');
+			directory.append(path);
+			return directory;
+		}
+
+	private:
+		static std::string GetDirectory(int dirfd)
+		{
+			char buffer[PATH_MAX];
+			if (dirfd == AT_FDCWD)
+			{
+				if (getcwd(buffer, sizeof(buffer)) == nullptr)
+					return std::string();
+
+				return std::string(buffer);
+			}
+
+			char link[64];
+			snprintf(link, sizeof(link), "/proc/self/fd/%d", dirfd);
+			auto size = readlink(link, buffer, sizeof(buffer));
+			if (size <= 0 || static_cast<size_t>(size) >= sizeof(buffer))
+				return std::string();
+
+			return std::string(buffer, static_cast<size_t>(size));
+		}
+	};
+}
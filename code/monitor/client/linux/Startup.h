@@ -4,6 +4,7 @@
 #include "Functions/Overrides/ProcessApi.h"
 
 #include "ConnectionManager.h"
+#include "FileSystemAccessSandbox.h"
 #include "AttachDetours.h"
 
 namespace Monitor::Linux
@@ -13,27 +14,45 @@ namespace Monitor::Linux
 	public:
 		Startup()
 		{
+			DebugTrace("Startup");
+
+			// Every override calls through to the real function, even when nothing can be reported
+			AttachDetours();
+
+			const ProcessPayload* loadedPayload = nullptr;
 			try
 			{
-				DebugTrace("Startup");
-				size_t traceProcessId = 123; // s_Payload.nTraceProcessId;
+				// The payload lives at the start of the shared memory ring from the host
+				loadedPayload = &connectionManager.LoadPayload();
+			}
+			catch (const std::exception& ex)
+			{
+				// Without the ring nothing can reach the host, a process that runs unmonitored would let
+				// the build trust an incomplete set of accesses, so stop it before it touches any files
+				DebugTrace(ex.what());
+				fprintf(stderr, "Soup monitor failed to attach: %s\n", ex.what());
+				_exit(-1234);
+			}
 
-				// Extract the allowed read/write directories
-				auto workingDirectory = Opal::Path(); // Opal::Path(s_Payload.zWorkingDirectory);
-				bool enableAccessChecks = false; //s_Payload.EnableAccessChecks;
-				auto allowedReadDirectories = std::vector<std::string>(); // ExtractStringList(s_Payload.zReadAccessDirectories, s_Payload.cReadAccessDirectories);
-				auto allowedWriteDirectories = std::vector<std::string>(); // ExtractStringList(s_Payload.zWriteAccessDirectories, s_Payload.cWriteAccessDirectories);
+			try
+			{
+				auto& payload = *loadedPayload;
+				size_t traceProcessId = payload.nTraceProcessId;
 
-				AttachDetours();
+				// Extract the allowed read/write directories
+				auto workingDirectory = Opal::Path(payload.zWorkingDirectory);
+				bool enableAccessChecks = payload.EnableAccessChecks;
+				auto allowedReadDirectories = ExtractStringList(payload.zReadAccessDirectories, payload.cReadAccessDirectories);
+				auto allowedWriteDirectories = ExtractStringList(payload.zWriteAccessDirectories, payload.cWriteAccessDirectories);
 
 				// Initialize the event pipe
 				DebugTrace("ConnectionManager");
 				connectionManager.Initialize(traceProcessId);
-				// Monitor::FileSystemAccessSandbox::Initialize(
-				// 	enableAccessChecks,
-				// 	std::move(workingDirectory),
-				// 	std::move(allowedReadDirectories),
-				// 	std::move(allowedWriteDirectories));
+				Monitor::FileSystemAccessSandbox::Initialize(
+					enableAccessChecks,
+					std::move(workingDirectory),
+					std::move(allowedReadDirectories),
+					std::move(allowedWriteDirectories));
 			}
 			catch (const std::exception& ex)
 			{
@@ -56,6 +75,25 @@ namespace Monitor::Linux
 		}
 
 	private:
+		static std::vector<std::string> ExtractStringList(const char* rawValues, uint64_t length)
+		{
+			auto result = std::vector<std::string>();
+			auto remainingContent = length;
+			auto valueBuffer = rawValues;
+
+			// Keep pulling off strings until we reach the end
+			while (remainingContent > 0)
+			{
+				auto value = std::string(valueBuffer);
+				valueBuffer += value.length() + 1;
+				remainingContent -= value.length() + 1;
+
+				result.push_back(std::move(value));
+			}
+
+			return result;
+		}
+
 		void DebugTrace(std::string_view message)
 		{
 	#ifdef TRACE_DETOUR_CLIENT
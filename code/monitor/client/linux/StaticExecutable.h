@@ -0,0 +1,202 @@
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A static executable never loads the preloaded client, so a thread that is about to run one asks the host
+	/// to trace it and loads the trace program from the payload before it continues. The program is inherited
+	/// through the exec and by every child, which leaves the static process tree to the ptrace backend.
+	/// </summary>
+	class StaticExecutable
+	{
+	private:
+		// The host starts a new thread to attach, which should never take this long
+		static constexpr std::chrono::seconds TraceTimeout = std::chrono::seconds(10);
+
+	public:
+		/// <summary>
+		/// Hand the calling thread over to the tracer when the file is a static executable
+		/// </summary>
+		static void TraceIfStatic(const char* path)
+		{
+			if (path == nullptr)
+				return;
+
+			auto handle = Functions::Cache::FileApi::open(path, O_RDONLY | O_CLOEXEC);
+			TraceIfStaticHandle(handle);
+		}
+
+		/// <summary>
+		/// Hand the calling thread over to the tracer when the file found on the search path is a static executable
+		/// </summary>
+		static void TraceIfStaticSearchPath(const char* file)
+		{
+			if (file == nullptr || file[0] == 0)
+				return;
+
+			// A name with a slash is not searched for
+			if (strchr(file, '/') != nullptr)
+			{
+				TraceIfStatic(file);
+				return;
+			}
+
+			auto searchPath = getenv("PATH");
+			auto directories = std::string_view(searchPath != nullptr ? searchPath : "/bin:/usr/bin");
+			while (true)
+			{
+				auto separator = directories.find(':');
+				auto directory = directories.substr(0, separator);
+
+				// An empty entry is the working directory
+				auto candidate = directory.empty() ? std::string(".") : std::string(directory);
+				candidate.push_back('/');
+				candidate.append(file);
+				if (access(candidate.c_str(), X_OK) == 0)
+				{
+					TraceIfStatic(candidate.c_str());
+					return;
+				}
+
+				if (separator == std::string_view::npos)
+					return;
+
+				directories.remove_prefix(separator + 1);
+			}
+		}
+
+		/// <summary>
+		/// Hand the calling thread over to the tracer when the directory relative file is a static executable
+		/// </summary>
+		static void TraceIfStaticAt(int dirfd, const char* path, int flags)
+		{
+			if (path == nullptr)
+				return;
+
+			if (path[0] == 0 && (flags & AT_EMPTY_PATH) != 0)
+			{
+				TraceIfStaticDescriptor(dirfd);
+				return;
+			}
+
+			auto handle = Functions::Cache::FileApi::openat(dirfd, path, O_RDONLY | O_CLOEXEC);
+			TraceIfStaticHandle(handle);
+		}
+
+		/// <summary>
+		/// Hand the calling thread over to the tracer when the open file is a static executable
+		/// </summary>
+		static void TraceIfStaticDescriptor(int fd)
+		{
+			if (IsStatic(fd))
+				RequestTrace();
+		}
+
+	private:
+		static void TraceIfStaticHandle(int handle)
+		{
+			// The exec reports the same failure for a file that cannot be opened
+			if (handle < 0)
+				return;
+
+			auto isStatic = IsStatic(handle);
+			close(handle);
+
+			if (isStatic)
+				RequestTrace();
+		}
+
+		/// <summary>
+		/// Check if the executable has no program interpreter, the same as the host does for the root process
+		/// </summary>
+		static bool IsStatic(int handle)
+		{
+			Elf64_Ehdr header;
+			if (pread(handle, &header, sizeof(header), 0) != sizeof(header) ||
+				memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 ||
+				header.e_ident[EI_CLASS] != ELFCLASS64)
+			{
+				return false;
+			}
+
+			for (auto i = 0; i < header.e_phnum; i++)
+			{
+				Elf64_Phdr programHeader;
+				auto offset = header.e_phoff + (i * header.e_phentsize);
+				if (pread(handle, &programHeader, sizeof(programHeader), offset) != sizeof(programHeader))
+					return false;
+
+				if (programHeader.p_type == PT_INTERP)
+					return false;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Wait for the host to attach to this thread and load the trace program.
+		/// An untraced static process would silently drop its accesses, so the process exits when this fails.
+		/// </summary>
+		static void RequestTrace()
+		{
+			connectionManager.DebugTrace("StaticExecutable::RequestTrace");
+
+			// A thread in a traced tree already inherited the trace program
+			if (IsTraced())
+				return;
+
+			auto& payload = connectionManager.GetPayload();
+
+			{
+				auto message = MessageSender(MessageType::TraceRequest);
+				message.AppendValue(static_cast<int32_t>(getpid()));
+				message.AppendValue(static_cast<int32_t>(gettid()));
+			}
+
+			auto timeout = std::chrono::steady_clock::now() + TraceTimeout;
+			while (!IsTraced())
+			{
+				if (std::chrono::steady_clock::now() > timeout)
+					Fail("Timed out waiting for the monitor to trace a static executable");
+
+				usleep(100);
+			}
+
+			if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0)
+				Fail("Failed to set no new privileges for a static executable");
+
+			auto program = sock_fprog();
+			program.len = static_cast<unsigned short>(payload.cTraceProgram);
+			program.filter = const_cast<sock_filter*>(payload.TraceProgram);
+			if (syscall(SYS_seccomp, SECCOMP_SET_MODE_FILTER, 0, &program) != 0)
+				Fail("Failed to load the trace program for a static executable");
+		}
+
+		static bool IsTraced()
+		{
+			auto handle = Functions::Cache::FileApi::open("/proc/thread-self/status", O_RDONLY | O_CLOEXEC);
+			if (handle < 0)
+				return false;
+
+			char buffer[4096];
+			auto size = read(handle, buffer, sizeof(buffer) - 1);
+			close(handle);
+			if (size <= 0)
+				return false;
+
+			buffer[size] = 0;
+			auto tracer = strstr(buffer, "TracerPid:");
+			return tracer != nullptr && atoi(tracer + strlen("TracerPid:")) != 0;
+		}
+
+		[[noreturn]] static void Fail(const char* reason)
+		{
+			{
+				auto message = MessageSender(MessageType::Error);
+				message.AppendValue(reason);
+			}
+
+			_exit(-1234);
+		}
+	};
+}
@@ -21,6 +21,21 @@ extern "C"
 	typedef int (*execve_ptr) (const char *pathname, char *const argv[], char *const envp[]);
 	typedef int (*execveat_ptr) (int dirfd, const char *pathname, char *const argv[], char *const envp[], int flags);
 	typedef int (*fexecve_ptr) (int fd, char *const argv[], char *const envp[]);
+
+	typedef int (*posix_spawn_ptr) (
+		pid_t *pid,
+		const char *path,
+		const posix_spawn_file_actions_t *file_actions,
+		const posix_spawnattr_t *attrp,
+		char *const argv[],
+		char *const envp[]);
+	typedef int (*posix_spawnp_ptr) (
+		pid_t *pid,
+		const char *file,
+		const posix_spawn_file_actions_t *file_actions,
+		const posix_spawnattr_t *attrp,
+		char *const argv[],
+		char *const envp[]);
 }
 
 namespace Monitor::Linux::Functions::Cache::ProcessApi
@@ -44,4 +59,7 @@ namespace Monitor::Linux::Functions::Cache::ProcessApi
 	execve_ptr execve;
 	execveat_ptr execveat;
 	fexecve_ptr fexecve;
+
+	posix_spawn_ptr posix_spawn;
+	posix_spawnp_ptr posix_spawnp;
 }
\ No newline at end of file
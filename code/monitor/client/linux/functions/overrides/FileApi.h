@@ -1,6 +1,11 @@
 #pragma once
 
 #include "../Cache/FileApi.h"
+#include "../../PathResolver.h"
+#include "FileSystemAccessSandbox.h"
+
+// The paths are resolved up front so both the access checks and the host see the absolute path.
+// A blocked call fails with EACCES without reaching the real function.
 
 int open(const char* path, int oflag, ... /* mode_t mode */ )
 {
@@ -11,8 +16,15 @@ int open(const char* path, int oflag, ... /* mode_t mode */ )
 	// TODO: Bigly hack since Clang does not support __builtin_va_arg_pack
 	// To whomever thought variadic optional parameters were a good idea. Why?
 	bool requiresMode = (oflag & O_CREAT) != 0 || (oflag & __O_TMPFILE) == __O_TMPFILE;
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(path);
+	bool blockAccess = !Monitor::FileSystemAccessSandbox::IsAllowed(resolvedPath.c_str(), oflag);
 	int result;
-	if (requiresMode)
+	if (blockAccess)
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else if (requiresMode)
 	{
 		va_list args;
 		va_start(args, oflag);
@@ -25,7 +37,7 @@ int open(const char* path, int oflag, ... /* mode_t mode */ )
 		result = Monitor::Linux::Functions::Cache::FileApi::open(path, oflag);
 	}
 
-	message.AppendValue(path);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(oflag);
 	message.AppendValue(result);
 
@@ -38,9 +50,19 @@ int creat(const char *pathname, mode_t mode)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::creat));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::creat(pathname, mode);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::creat(pathname, mode);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(result);
 
 	return result;
@@ -55,8 +77,15 @@ int openat(int dirfd, const char *pathname, int flags, ... /* mode_t mode */ )
 	// TODO: Bigly hack since Clang does not support __builtin_va_arg_pack
 	// To whomever thought variadic optional parameters were a good idea. Why?
 	bool requiresMode = (flags & O_CREAT) != 0 || (flags & __O_TMPFILE) == __O_TMPFILE;
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(dirfd, pathname);
+	bool blockAccess = !Monitor::FileSystemAccessSandbox::IsAllowed(resolvedPath.c_str(), flags);
 	int result;
-	if (requiresMode)
+	if (blockAccess)
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else if (requiresMode)
 	{
 		va_list args;
 		va_start(args, flags);
@@ -70,7 +99,7 @@ int openat(int dirfd, const char *pathname, int flags, ... /* mode_t mode */ )
 	}
 
 	message.AppendValue(dirfd);
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(flags);
 	message.AppendValue(result);
 
@@ -83,10 +112,22 @@ int link(const char *oldpath, const char *newpath)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::link));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::link(oldpath, newpath);
+	auto resolvedOldPath = Monitor::Linux::PathResolver::Resolve(oldpath);
+	auto resolvedNewPath = Monitor::Linux::PathResolver::Resolve(newpath);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsReadAllowed(resolvedOldPath.c_str()) ||
+		!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedNewPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::link(oldpath, newpath);
+	}
 
-	message.AppendValue(oldpath);
-	message.AppendValue(newpath);
+	message.AppendValue(resolvedOldPath.c_str());
+	message.AppendValue(resolvedNewPath.c_str());
 	message.AppendValue(result);
 
 	return result;
@@ -98,12 +139,24 @@ int linkat(int olddirfd, const char *oldpath, int newdirfd, const char *newpath,
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::linkat));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::linkat(olddirfd, oldpath, newdirfd, newpath, flags);
+	auto resolvedOldPath = Monitor::Linux::PathResolver::Resolve(olddirfd, oldpath);
+	auto resolvedNewPath = Monitor::Linux::PathResolver::Resolve(newdirfd, newpath);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsReadAllowed(resolvedOldPath.c_str()) ||
+		!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedNewPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::linkat(olddirfd, oldpath, newdirfd, newpath, flags);
+	}
 
 	message.AppendValue(olddirfd);
-	message.AppendValue(oldpath);
+	message.AppendValue(resolvedOldPath.c_str());
 	message.AppendValue(newdirfd);
-	message.AppendValue(newpath);
+	message.AppendValue(resolvedNewPath.c_str());
 	message.AppendValue(flags);
 	message.AppendValue(result);
 
@@ -116,10 +169,22 @@ int rename(const char *oldpath, const char *newpath)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::rename));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::rename(oldpath, newpath);
+	auto resolvedOldPath = Monitor::Linux::PathResolver::Resolve(oldpath);
+	auto resolvedNewPath = Monitor::Linux::PathResolver::Resolve(newpath);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedOldPath.c_str()) ||
+		!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedNewPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::rename(oldpath, newpath);
+	}
 
-	message.AppendValue(oldpath);
-	message.AppendValue(newpath);
+	message.AppendValue(resolvedOldPath.c_str());
+	message.AppendValue(resolvedNewPath.c_str());
 	message.AppendValue(result);
 
 	return result;
@@ -131,9 +196,19 @@ int unlink(const char *pathname)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::unlink));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::unlink(pathname);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::unlink(pathname);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(result);
 
 	return result;
@@ -145,9 +220,19 @@ int remove(const char *pathname)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::remove));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::remove(pathname);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::remove(pathname);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(result);
 
 	return result;
@@ -159,9 +244,19 @@ FILE* fopen(const char * pathname, const char * mode)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::fopen));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::fopen(pathname, mode);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	FILE* result;
+	if (!Monitor::FileSystemAccessSandbox::IsAllowed(resolvedPath.c_str(), mode))
+	{
+		result = nullptr;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::fopen(pathname, mode);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(mode);
 	message.AppendValue((uint64_t)result);
 
@@ -192,9 +287,20 @@ FILE* freopen(
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::freopen));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::freopen(pathname, mode, stream);
+	// A null path only changes the mode of the stream that is already open
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	FILE* result;
+	if (pathname != nullptr && !Monitor::FileSystemAccessSandbox::IsAllowed(resolvedPath.c_str(), mode))
+	{
+		result = nullptr;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::freopen(pathname, mode, stream);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(mode);
 
 	return result;
@@ -206,9 +312,19 @@ int mkdir(const char *path, mode_t mode)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::mkdir));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::mkdir(path, mode);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(path);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::mkdir(path, mode);
+	}
 
-	message.AppendValue(path);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(mode);
 
 	return result;
@@ -220,9 +336,19 @@ int rmdir(const char *pathname)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::rmdir));
 
-	auto result = Monitor::Linux::Functions::Cache::FileApi::rmdir(pathname);
+	auto resolvedPath = Monitor::Linux::PathResolver::Resolve(pathname);
+	int result;
+	if (!Monitor::FileSystemAccessSandbox::IsWriteAllowed(resolvedPath.c_str()))
+	{
+		result = -1;
+		errno = EACCES;
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::rmdir(pathname);
+	}
 
-	message.AppendValue(pathname);
+	message.AppendValue(resolvedPath.c_str());
 	message.AppendValue(result);
 
 	return result;
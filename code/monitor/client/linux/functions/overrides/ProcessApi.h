@@ -1,6 +1,42 @@
 #pragma once
 
+#include "../Cache/FileApi.h"
 #include "../Cache/ProcessApi.h"
+#include "../../StaticExecutable.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Pass the monitor on to a child that is started with an explicit environment
+	/// The entries are borrowed from the current environment, which stays valid until the exec completes
+	/// </summary>
+	std::vector<char*> BuildMonitorEnvironment(char *const envp[])
+	{
+		auto preloadPrefix = std::string_view("LD_PRELOAD=");
+		auto ringPrefix = std::string(MessageRingHandleVariable) + "=";
+
+		auto result = std::vector<char*>();
+		bool hasPreload = false;
+		bool hasRing = false;
+		for (auto value = envp; value != nullptr && *value != nullptr; value++)
+		{
+			auto entry = std::string_view(*value);
+			hasPreload = hasPreload || entry.starts_with(preloadPrefix);
+			hasRing = hasRing || entry.starts_with(ringPrefix);
+			result.push_back(*value);
+		}
+
+		for (auto value = environ; value != nullptr && *value != nullptr; value++)
+		{
+			auto entry = std::string_view(*value);
+			if ((!hasPreload && entry.starts_with(preloadPrefix)) || (!hasRing && entry.starts_with(ringPrefix)))
+				result.push_back(*value);
+		}
+
+		result.push_back(nullptr);
+		return result;
+	}
+}
 
 int system(const char *command)
 {
@@ -96,6 +132,7 @@ int execl(const char *path, const char *arg, ...)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execl));
 
+	Monitor::Linux::StaticExecutable::TraceIfStatic(path);
 	va_list args;
 	va_start(args, arg);
 	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execl(path, arg, args);
@@ -113,6 +150,7 @@ int execlp(const char *file, const char *arg, ...)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execlp));
 
+	Monitor::Linux::StaticExecutable::TraceIfStaticSearchPath(file);
 	va_list args;
 	va_start(args, arg);
 	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execlp(file, arg, args);
@@ -130,6 +168,7 @@ int execle(const char *path, const char *arg, ...)
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execle));
 
+	Monitor::Linux::StaticExecutable::TraceIfStatic(path);
 	va_list args;
 	va_start(args, arg);
 	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execle(path, arg, args);
@@ -147,6 +186,7 @@ int execv(const char *path, char *const argv[])
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execv));
 
+	Monitor::Linux::StaticExecutable::TraceIfStatic(path);
 	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execv(path, argv);
 
 	message.AppendValue(path);
@@ -161,6 +201,7 @@ int execvp(const char *file, char *const argv[])
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execvp));
 
+	Monitor::Linux::StaticExecutable::TraceIfStaticSearchPath(file);
 	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execvp(file, argv);
 
 	message.AppendValue(file);
@@ -175,7 +216,9 @@ int execvpe(const char *file, char *const argv[], char *const envp[])
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execvpe));
 
-	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execvpe(file, argv, envp);
+	Monitor::Linux::StaticExecutable::TraceIfStaticSearchPath(file);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execvpe(file, argv, environment.data());
 
 	message.AppendValue(file);
 	message.AppendValue(result);
@@ -189,7 +232,9 @@ int execve(const char *pathname, char *const argv[], char *const envp[])
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execve));
 
-	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execve(pathname, argv, envp);
+	Monitor::Linux::StaticExecutable::TraceIfStatic(pathname);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execve(pathname, argv, environment.data());
 
 	message.AppendValue(pathname);
 	message.AppendValue(result);
@@ -203,7 +248,9 @@ int execveat(int dirfd, const char *pathname, char *const argv[], char *const en
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::execveat));
 
-	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execveat(dirfd, pathname, argv, envp, flags);
+	Monitor::Linux::StaticExecutable::TraceIfStaticAt(dirfd, pathname, flags);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::execveat(dirfd, pathname, argv, environment.data(), flags);
 
 	message.AppendValue(pathname);
 	message.AppendValue(result);
@@ -217,8 +264,58 @@ int fexecve(int fd, char *const argv[], char *const envp[])
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::fexecve));
 
-	auto result = Monitor::Linux::Functions::Cache::ProcessApi::fexecve(fd, argv, envp);
+	Monitor::Linux::StaticExecutable::TraceIfStaticDescriptor(fd);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::fexecve(fd, argv, environment.data());
+
+	message.AppendValue(result);
+
+	return result;
+}
+
+int posix_spawn(
+	pid_t *pid,
+	const char *path,
+	const posix_spawn_file_actions_t *file_actions,
+	const posix_spawnattr_t *attrp,
+	char *const argv[],
+	char *const envp[])
+{
+	connectionManager.DebugTrace("posix_spawn");
+	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
+	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::posix_spawn));
+
+	// The child cannot be handed over before its exec, so this process is traced along with it
+	Monitor::Linux::StaticExecutable::TraceIfStatic(path);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::posix_spawn(
+		pid, path, file_actions, attrp, argv, environment.data());
 
+	message.AppendValue(path);
+	message.AppendValue(result);
+
+	return result;
+}
+
+int posix_spawnp(
+	pid_t *pid,
+	const char *file,
+	const posix_spawn_file_actions_t *file_actions,
+	const posix_spawnattr_t *attrp,
+	char *const argv[],
+	char *const envp[])
+{
+	connectionManager.DebugTrace("posix_spawnp");
+	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
+	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::posix_spawnp));
+
+	// The child cannot be handed over before its exec, so this process is traced along with it
+	Monitor::Linux::StaticExecutable::TraceIfStaticSearchPath(file);
+	auto environment = Monitor::Linux::BuildMonitorEnvironment(envp);
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::posix_spawnp(
+		pid, file, file_actions, attrp, argv, environment.data());
+
+	message.AppendValue(file);
 	message.AppendValue(result);
 
 	return result;
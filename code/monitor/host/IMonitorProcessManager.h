@@ -7,6 +7,97 @@
 
 namespace Monitor
 {
+	/// <summary>
+	/// The resources consumed by a monitored process tree, zero when the platform does not report them
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct MonitorProcessResourceUsage
+	{
+		std::chrono::microseconds WallTime = std::chrono::microseconds(0);
+		std::chrono::microseconds UserTime = std::chrono::microseconds(0);
+		std::chrono::microseconds SystemTime = std::chrono::microseconds(0);
+
+		// The peak resident set size of the largest process in the tree in bytes
+		uint64_t MaxResidentSetSize = 0;
+
+		uint64_t VoluntaryContextSwitches = 0;
+		uint64_t InvoluntaryContextSwitches = 0;
+
+		// The number of system access events the monitor processed
+		uint64_t MonitorEventCount = 0;
+	};
+
+	/// <summary>
+	/// The final state of a monitored process that was started asynchronously
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct MonitorProcessResult
+	{
+		int ExitCode = -1;
+		MonitorProcessResourceUsage ResourceUsage;
+
+		// Set when the process could not be run to completion
+		std::exception_ptr Failure = nullptr;
+	};
+
+	/// <summary>
+	/// The callback invoked once an asynchronous monitored process has exited
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	using MonitorProcessCallback = std::function<void(MonitorProcessResult)>;
+
+	/// <summary>
+	/// The pipe a line of monitored process output was written to
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	enum class MonitorProcessOutputStream
+	{
+		StandardOutput,
+		StandardError,
+	};
+
+	/// <summary>
+	/// The callback invoked with each line of output while an asynchronous monitored process runs
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	using MonitorProcessOutputCallback = std::function<void(MonitorProcessOutputStream, std::string_view)>;
+
+	/// <summary>
+	/// Report captured output one line at a time, the trailing line does not require a line ending
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	inline void ReportOutputLines(
+		std::string_view content,
+		MonitorProcessOutputStream stream,
+		const MonitorProcessOutputCallback& onOutput)
+	{
+		while (!content.empty())
+		{
+			auto lineEnd = content.find('\n');
+			auto line = content.substr(0, lineEnd);
+			if (line.ends_with('\r'))
+				line.remove_suffix(1);
+
+			onOutput(stream, line);
+
+			if (lineEnd == std::string_view::npos)
+				break;
+			content.remove_prefix(lineEnd + 1);
+		}
+	}
+
 	/// <summary>
 	/// The process manager interface that supports monitoring
 	/// Interface mainly used to allow for unit testing client code
@@ -47,8 +138,56 @@ namespace Monitor
 			std::shared_ptr<ISystemAccessMonitor> monitor,
 			bool enableAccessChecks,
 			bool partialMonitor,
-			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) = 0;
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess) = 0;
+
+		/// <summary>
+		/// Start a monitored process without blocking the caller and invoke the callback once it exits
+		/// The output is reported line by line through the output callback before the exit callback.
+		/// The callbacks may run on any thread, including the caller when the process completes immediately.
+		/// The default implementation runs the blocking process to completion on the calling thread.
+		/// </summary>
+		virtual void StartMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			const std::map<std::string, std::string>& environmentVariables,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			bool enableAccessChecks,
+			bool partialMonitor,
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess,
+			MonitorProcessOutputCallback onOutput,
+			MonitorProcessCallback onExited)
+		{
+			auto result = MonitorProcessResult();
+			try
+			{
+				auto process = CreateMonitorProcess(
+					executable,
+					std::move(arguments),
+					workingDirectory,
+					environmentVariables,
+					std::move(monitor),
+					enableAccessChecks,
+					partialMonitor,
+					std::move(allowedReadAccess),
+					std::move(allowedWriteAccess));
+
+				process->Start();
+				process->WaitForExit();
+
+				ReportOutputLines(process->GetStandardOutput(), MonitorProcessOutputStream::StandardOutput, onOutput);
+				ReportOutputLines(process->GetStandardError(), MonitorProcessOutputStream::StandardError, onOutput);
+				result.ExitCode = process->GetExitCode();
+			}
+			catch (...)
+			{
+				result.Failure = std::current_exception();
+			}
+
+			onExited(std::move(result));
+		}
 
 	private:
 		static std::shared_ptr<IMonitorProcessManager> _current;
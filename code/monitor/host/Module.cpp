@@ -29,12 +29,33 @@ module;
 #include <sys/stat.h>
 #include <poll.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <cstring>
 
 #include <elf.h>
 
+#include <sched.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+
+// Include the kernel definitions first so libseccomp does not provide its own copies
+#include <linux/filter.h>
+#include <linux/seccomp.h>
 #include <seccomp.h>
 
+// Older kernel headers do not define the flag, the kernel reports an error if it is unsupported
+#ifndef SECCOMP_USER_NOTIF_FLAG_CONTINUE
+#define SECCOMP_USER_NOTIF_FLAG_CONTINUE (1UL << 0)
+#endif
+#ifndef CLONE_PIDFD
+#define CLONE_PIDFD 0x00001000
+#endif
+
 // The existing environment for this process
 extern char **environ;
 
@@ -48,16 +69,21 @@ extern char **environ;
 #include <atomic>
 #include <array>
 #include <codecvt>
+#include <condition_variable>
 #include <filesystem>
 #include <format>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <locale>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #ifdef SOUP_BUILD
@@ -6,38 +6,111 @@
 #include "LinuxSystemAccessMonitor.h"
 #include "LinuxSystemLoggerMonitor.h"
 #include "LinuxSystemMonitorFork.h"
+#include "LinuxDetourEventListener.h"
+#include "LinuxProcessLauncher.h"
+#include "LinuxProcessOutputReader.h"
+#include "LinuxProcessSupervisor.h"
+#include "LinuxSystemCallFilter.h"
 #include "LinuxTraceEventListener.h"
 
 namespace Monitor::Linux
 {
+	/// <summary>
+	/// The kernel mechanism used to observe the system calls of the monitored process tree
+	/// </summary>
+	export enum class LinuxMonitorBackend
+	{
+		// Stop the tracee with ptrace on each filtered system call and inspect the completed result
+		Trace,
+
+		// Receive seccomp user notifications on a listener and let each system call continue in the kernel
+		// The events are reported before the kernel runs the call, so every result is a prediction:
+		// opens are checked against the current file system and all other calls are reported as succeeding
+		UserNotification,
+
+		// Preload the monitor client into dynamically linked processes so events are written to shared memory
+		// Statically linked executables cannot load the client and fall back to tracing
+		Preload,
+	};
+
 	/// <summary>
 	/// A Linux platform specific process executable using system
 	/// </summary>
-	export class LinuxMonitorProcess : public Opal::System::IProcess
+	export class LinuxMonitorProcess :
+		public Opal::System::IProcess,
+		public std::enable_shared_from_this<LinuxMonitorProcess>
 	{
 	private:
+		// The number of messages the preloaded clients can queue before they wait on the host
+		static constexpr uint32_t MessageRingSlotCount = 1024;
+
+		static constexpr unsigned int TraceOptions =
+			// Make it easier to track our SIGTRAP events
+			PTRACE_O_TRACESYSGOOD |
+			// Trace Secure Compute
+			PTRACE_O_TRACESECCOMP |
+			// Auto attach to children
+			PTRACE_O_TRACECLONE |
+			PTRACE_O_TRACEFORK |
+			PTRACE_O_TRACEVFORK |
+			// Prevent children from running beyond our lifetime
+			PTRACE_O_EXITKILL |
+			// Monitor execve
+			PTRACE_O_TRACEEXEC |
+			// Monitor child exit
+			PTRACE_O_TRACEEXIT;
+
+		// A thread of the preloaded tree that runs a static executable, traced by its own thread
+		struct StaticTracer
+		{
+			int ProcessHandle;
+			std::thread Thread;
+		};
+
 		// Input
 		Path m_executable;
 		std::vector<std::string> m_arguments;
 		Path m_workingDirectory;
+		std::shared_ptr<ILinuxSystemMonitor> m_systemMonitor;
 		LinuxTraceEventListener m_eventListener;
+		LinuxDetourEventListener m_detourListener;
+		bool m_enableAccessChecks;
 		bool m_partialMonitor;
+		LinuxMonitorBackend m_backend;
+		std::shared_ptr<const std::vector<Path>> m_allowedReadAccess;
+		std::shared_ptr<const std::vector<Path>> m_allowedWriteAccess;
 
 		// Runtime
 		pid_t m_processId;
-		int m_stdOutReadHandle;
-		int m_stdErrReadHandle;
+		int m_processHandle;
+		std::unique_ptr<LinuxProcessOutputReader> m_outputReader;
+		int m_messageRingHandle;
+		void* m_messageRingMemory;
 
 		std::thread m_workerThread;
 		std::atomic<bool> m_processRunning;
 		std::atomic<bool> m_workerFailed;
 		std::exception_ptr m_workerException = nullptr;
 
+		// The static tracers report to the same listeners as the message ring
+		std::mutex m_monitorMutex;
+		std::vector<StaticTracer> m_staticTracers;
+
+		// The shared loop that completes an asynchronous process, the process keeps itself alive until then
+		LinuxProcessSupervisor* m_supervisor;
+		std::vector<uint64_t> m_supervisorRegistrations;
+		MonitorProcessCallback m_onExited;
+		std::shared_ptr<LinuxMonitorProcess> m_self;
+		int m_notifyHandle;
+		seccomp_notif* m_notifyRequest;
+		seccomp_notif_resp* m_notifyResponse;
+
 		// Result
 		bool m_isFinished;
-		std::stringstream m_stdOut;
-		std::stringstream m_stdErr;
 		int m_exitCode;
+		std::chrono::steady_clock::time_point m_startTime;
+		MonitorProcessResourceUsage m_resourceUsage;
+		uint64_t m_eventCount;
 
 	public:
 		/// <summary>
@@ -48,27 +121,62 @@ namespace Monitor::Linux
 			std::vector<std::string> arguments,
 			const Path& workingDirectory,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
-			bool partialMonitor) :
+			bool enableAccessChecks,
+			bool partialMonitor,
+			LinuxMonitorBackend backend,
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess) :
 			m_executable(executable),
 			m_arguments(std::move(arguments)),
 			m_workingDirectory(workingDirectory),
 	#ifdef TRACE_DETOUR_SERVER
-			m_eventListener(std::make_shared<LinuxSystemMonitorFork>(
+			m_systemMonitor(std::make_shared<LinuxSystemMonitorFork>(
 				std::make_shared<LinuxSystemLoggerMonitor>(std::cout),
 				std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor)))),
 	#else
-			m_eventListener(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
+			m_systemMonitor(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
 	#endif
+			m_eventListener(m_systemMonitor),
+			m_detourListener(
+				m_systemMonitor,
+				[this](pid_t processId, pid_t threadId) { OnTraceRequest(processId, threadId); }),
+			m_enableAccessChecks(enableAccessChecks),
 			m_partialMonitor(partialMonitor),
+			m_backend(backend),
+			m_allowedReadAccess(std::move(allowedReadAccess)),
+			m_allowedWriteAccess(std::move(allowedWriteAccess)),
 			m_processId(),
-			m_stdOutReadHandle(),
-			m_stdErrReadHandle(),
+			m_processHandle(-1),
+			m_outputReader(),
+			m_messageRingHandle(-1),
+			m_messageRingMemory(nullptr),
 			m_workerThread(),
 			m_processRunning(),
 			m_workerFailed(),
+			m_monitorMutex(),
+			m_staticTracers(),
+			m_supervisor(nullptr),
+			m_supervisorRegistrations(),
+			m_onExited(),
+			m_self(),
+			m_notifyHandle(-1),
+			m_notifyRequest(nullptr),
+			m_notifyResponse(nullptr),
 			m_isFinished(false),
-			m_exitCode(-1)
+			m_exitCode(-1),
+			m_startTime(),
+			m_resourceUsage(),
+			m_eventCount(0)
+		{
+		}
+
+		/// <summary>
+		/// Finalizes an instance of the <see cref='LinuxMonitorProcess'/> class.
+		/// </summary>
+		~LinuxMonitorProcess()
 		{
+			if (m_workerThread.joinable())
+				m_workerThread.join();
 		}
 
 		/// <summary>
@@ -76,54 +184,136 @@ namespace Monitor::Linux
 		/// </summary>
 		void Start() override final
 		{
-			// Set current working directory that will be inherited by the child process
-			auto currentWorkingDirectory = std::filesystem::current_path();
-			if (chdir(m_workingDirectory.ToString().c_str()) == -1)
-				throw std::runtime_error("Failed to set working directory");
-
-			// Create a pipe to send stdout to parent
-			int stdOutPipe[2];
-			if (pipe2(stdOutPipe, O_NONBLOCK) < 0)
-				throw std::runtime_error("Failed to create stdOutPipe");
+			int stdOutWriteHandle;
+			int stdErrWriteHandle;
+			CreateOutput(stdOutWriteHandle, stdErrWriteHandle, nullptr);
 
-			// Create a pipe to send stderr to parent
-			int stdErrPipe[2];
-			if (pipe2(stdErrPipe, O_NONBLOCK) < 0)
-				throw std::runtime_error("Failed to create stdErrPipe");
+			// Drain the output on its own thread so the child never blocks on a full pipe
+			try
+			{
+				m_outputReader->Start();
+			}
+			catch (...)
+			{
+				close(stdOutWriteHandle);
+				close(stdErrWriteHandle);
+				m_outputReader = nullptr;
+				throw;
+			}
 
-			// Create a child process
-			DebugTrace("Fork");
-			pid_t processId = fork();
-			if (processId == 0)
+			try
 			{
-				SetupChildProcess(stdOutPipe, stdErrPipe);
+				StartWorker(stdOutWriteHandle, stdErrWriteHandle);
 			}
-			else
+			catch (...)
 			{
-				// Parent process still
-				DebugTrace("Parent");
+				m_outputReader = nullptr;
+				throw;
+			}
+		}
+
+		/// <summary>
+		/// Execute the process without blocking and invoke the callback on the supervisor loop once it exits.
+		/// The output pipes and process handle are serviced by the shared loop, each line of output is
+		/// reported as it arrives. A worker thread is only created when the backend requires one, the tracer
+		/// must be a thread that waits on the tracee.
+		/// </summary>
+		void StartAsync(
+			LinuxProcessSupervisor& supervisor,
+			MonitorProcessOutputCallback onOutput,
+			MonitorProcessCallback onExited)
+		{
+			int stdOutWriteHandle;
+			int stdErrWriteHandle;
+			CreateOutput(stdOutWriteHandle, stdErrWriteHandle, std::move(onOutput));
 
-				// Reset working directory
-				if (chdir(currentWorkingDirectory.string().c_str()) == -1)
-					throw std::runtime_error("Failed to reset working directory");
+			m_supervisor = &supervisor;
+			m_onExited = std::move(onExited);
+			m_self = shared_from_this();
+			try
+			{
+				m_outputReader->Attach();
+				m_supervisorRegistrations.push_back(supervisor.Register(
+					m_outputReader->GetStandardOutputHandle(),
+					[this]() { return m_outputReader->ReadStandardOutput(); },
+					[this](std::exception_ptr failure) { OnSupervisorFailed(failure); }));
+				m_supervisorRegistrations.push_back(supervisor.Register(
+					m_outputReader->GetStandardErrorHandle(),
+					[this]() { return m_outputReader->ReadStandardError(); }));
+			}
+			catch (...)
+			{
+				close(stdOutWriteHandle);
+				close(stdErrWriteHandle);
+				AbandonAsync();
+				throw;
+			}
 
-				m_processId = processId;
+			if (m_backend != LinuxMonitorBackend::UserNotification)
+			{
+				try
+				{
+					StartWorker(stdOutWriteHandle, stdErrWriteHandle);
+				}
+				catch (...)
+				{
+					AbandonAsync();
+					throw;
+				}
 
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
-				m_stdOutReadHandle = stdOutPipe[0];
-				m_stdErrReadHandle = stdErrPipe[0];
+				return;
+			}
 
-				// Create the worker thread that will monitor the child process
+			// The notifications do not stop the tracee so the listener can be serviced from the shared loop
+			auto isLaunched = false;
+			try
+			{
 				m_processRunning = true;
-				m_workerFailed = false;
-				DebugTrace("Thread");
-				// m_workerThread = std::thread(&LinuxMonitorProcess::WorkerThread, std::ref(*this));
-				
-				WorkerThread();
+				LaunchChild(stdOutWriteHandle, stdErrWriteHandle, m_notifyHandle);
+				isLaunched = true;
+
+				// The launcher only returns a process handle when the kernel supports it
+				if (m_processHandle < 0)
+					m_processHandle = (int)syscall(SYS_pidfd_open, m_processId, 0);
+				if (m_processHandle < 0)
+					throw std::runtime_error(std::format("pidfd_open failed {0}", errno));
+
+				if (seccomp_notify_alloc(&m_notifyRequest, &m_notifyResponse) != 0)
+					throw std::runtime_error("seccomp_notify_alloc failed");
 
-				DebugTrace("Parent done");
+				m_supervisorRegistrations.push_back(supervisor.Register(
+					m_notifyHandle,
+					[this]()
+					{
+						HandleNotification(m_notifyHandle, *m_notifyRequest, *m_notifyResponse);
+						return true;
+					}));
+
+				// Register the exit last, it may complete the process on the loop thread right away
+				supervisor.Register(
+					m_processHandle,
+					[this]()
+					{
+						OnRootProcessExited();
+						return false;
+					},
+					[this](std::exception_ptr failure)
+					{
+						OnSupervisorFailed(failure);
+						OnRootProcessExited();
+					});
+			}
+			catch (...)
+			{
+				// The child cannot be monitored without the loop
+				if (isLaunched)
+				{
+					kill(m_processId, SIGKILL);
+					waitpid(m_processId, nullptr, 0);
+				}
+
+				AbandonAsync();
+				throw;
 			}
 		}
 
@@ -133,17 +323,11 @@ namespace Monitor::Linux
 		void WaitForExit() override final
 		{
 			// Wait until child process exits.
-			// m_workerThread.join();
+			m_workerThread.join();
 
 			m_processRunning = false;
 
-			ReadAvailableStdOut();
-			m_stdOut << std::flush;
-			close(m_stdOutReadHandle);
-
-			ReadAvailableStdErr();
-			m_stdErr << std::flush;
-			close(m_stdErrReadHandle);
+			m_outputReader->Stop();
 
 			m_isFinished = true;
 
@@ -163,6 +347,19 @@ namespace Monitor::Linux
 			return m_exitCode;
 		}
 
+		/// <summary>
+		/// Get the resources used by the process tree
+		/// </summary>
+		MonitorProcessResourceUsage GetResourceUsage()
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+
+			auto result = m_resourceUsage;
+			result.MonitorEventCount = m_eventCount;
+			return result;
+		}
+
 		/// <summary>
 		/// Get the standard output
 		/// </summary>
@@ -170,7 +367,7 @@ namespace Monitor::Linux
 		{
 			if (!m_isFinished)
 				throw std::runtime_error("Process has not finished.");
-			return m_stdOut.str();
+			return m_outputReader->GetStandardOutput();
 		}
 
 		/// <summary>
@@ -180,220 +377,555 @@ namespace Monitor::Linux
 		{
 			if (!m_isFinished)
 				throw std::runtime_error("Process has not finished.");
-			return m_stdErr.str();
+			return m_outputReader->GetStandardError();
 		}
 
 	private:
-		void ReadAvailableStdOut()
+		/// <summary>
+		/// The main entry point for the worker thread that will monitor incoming messages from all
+		/// client connections.
+		/// </summary>
+
+		struct ProcessTraceState
 		{
-			// Read all and write to stdout
-			int dwRead;
-			const int BufferSize = 256;
-			char buffer[BufferSize + 1];
+			pid_t ProcessId;
+			bool IsRunning;
+			bool InSystemCall;
 
-			// Read on output
-			while (true)
-			{
-				dwRead = read(m_stdOutReadHandle, buffer, BufferSize);
-				if(dwRead < 0)
-					break;
-				if (dwRead == 0)
-					break;
+			// The system call captured on entry, when the kernel can report it
+			bool HasSysCallEntry;
+			SysCallStatus SysCallEntry;
+		};
 
-				m_stdOut << std::string_view(buffer, dwRead);
-			}
+		ProcessTraceState& InitializeProcess(
+			std::vector<ProcessTraceState>& activeProcesses,
+			pid_t processId)
+		{
+			activeProcesses.push_back({
+				processId,
+				true,
+				false,
+				false,
+				{},
+			});
+
+			return activeProcesses.at(activeProcesses.size() - 1);
 		}
 
-		void ReadAvailableStdErr()
+		bool HasProcess(
+			std::vector<ProcessTraceState>& activeProcesses,
+			pid_t processId)
 		{
-			// Read all and write to stdout
-			int dwRead;
-			const int BufferSize = 256;
-			char buffer[BufferSize + 1];
+			return std::any_of(
+				activeProcesses.begin(),
+				activeProcesses.end(),
+				[processId](const ProcessTraceState& value) { return value.ProcessId == processId; });
+		}
 
-			// Read all errors
-			while (true)
-			{
-				dwRead = read(m_stdErrReadHandle, buffer, BufferSize);
-				if(dwRead < 0)
-					break;
-				if (dwRead == 0)
-					break;
+		/// <summary>
+		/// A thread that runs an exec takes over the process id of the thread group leader,
+		/// move its trace state over so the stops that follow the exec find it
+		/// </summary>
+		void TakeOverExecThread(
+			std::vector<ProcessTraceState>& activeProcesses,
+			pid_t& rootProcessId,
+			pid_t processId)
+		{
+			unsigned long formerProcessId = 0;
+			if (ptrace(PTRACE_GETEVENTMSG, processId, 0, &formerProcessId) < 0)
+				throw std::runtime_error(std::format("ptrace PTRACE_GETEVENTMSG failed {0}", errno));
+
+			auto formerId = static_cast<pid_t>(formerProcessId);
+			if (formerId == processId)
+				return;
+
+			auto& formerProcess = FindProcess(activeProcesses, formerId);
+			auto state = formerProcess;
+			formerProcess.IsRunning = false;
+			state.ProcessId = processId;
+			if (HasProcess(activeProcesses, processId))
+				FindProcess(activeProcesses, processId) = state;
+			else
+				activeProcesses.push_back(state);
 
-				// Make the string null terminated
-				m_stdErr << std::string_view(buffer, dwRead);
+			if (rootProcessId == formerId)
+				rootProcessId = processId;
+		}
+
+		ProcessTraceState& FindProcess(
+			std::vector<ProcessTraceState>& activeProcesses,
+			pid_t processId)
+		{
+			auto result = std::find_if(
+				activeProcesses.begin(),
+				activeProcesses.end(),
+				[processId](const ProcessTraceState& value) { return value.ProcessId == processId; });
+
+			if (result == activeProcesses.end())
+			{
+				throw std::runtime_error("Missing process trace state");
+			}
+			else
+			{
+				return *result;
 			}
 		}
 
-		void SetupChildProcess(int stdOutPipe[2], int stdErrPipe[2])
+		/// <summary>
+		/// Create the output pipes and the reader for the read ends, the output is captured when there is no callback
+		/// </summary>
+		void CreateOutput(
+			int& stdOutWriteHandle,
+			int& stdErrWriteHandle,
+			MonitorProcessOutputCallback onOutput)
 		{
-			try
+			// A static root executable never loads the preloaded client, the clients ask to trace static children
+			if (m_backend == LinuxMonitorBackend::Preload && IsStaticExecutable(m_executable))
 			{
-				// We are the child process
-				DebugTrace("Child");
+				Log::Diag("Tracing static executable: {}", m_executable.ToString());
+				m_backend = LinuxMonitorBackend::Trace;
+			}
 
-				// Close the read pipe
-				close(stdOutPipe[0]);
-				close(stdErrPipe[0]);
+			// Create a pipe to send stdout to parent
+			// Note: Close on exec ensures concurrent children do not inherit each others pipes
+			int stdOutPipe[2];
+			if (pipe2(stdOutPipe, O_CLOEXEC) < 0)
+				throw std::runtime_error("Failed to create stdOutPipe");
 
-				// Redirect stdout to the pipe write
-				if (dup2(stdOutPipe[1], STDOUT_FILENO) != STDOUT_FILENO)
-					throw std::runtime_error("dup2 error to stdout");
+			// Create a pipe to send stderr to parent
+			int stdErrPipe[2];
+			if (pipe2(stdErrPipe, O_CLOEXEC) < 0)
+			{
+				close(stdOutPipe[0]);
+				close(stdOutPipe[1]);
+				throw std::runtime_error("Failed to create stdErrPipe");
+			}
 
-				// Redirect stderr to the pipe write
-				if (dup2(stdErrPipe[1], STDERR_FILENO) != STDERR_FILENO)
-					throw std::runtime_error("dup2 error to stderr");
+			m_outputReader = std::make_unique<LinuxProcessOutputReader>(
+				stdOutPipe[0],
+				stdErrPipe[0],
+				std::move(onOutput));
 
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
+			stdOutWriteHandle = stdOutPipe[1];
+			stdErrWriteHandle = stdErrPipe[1];
+		}
 
-				auto environment = std::vector<std::string>();
+		/// <summary>
+		/// Create the worker thread that will own and trace the child process.
+		/// The thread that launches the child becomes the tracer, which keeps each process tree isolated
+		/// to its own worker when many monitored processes run at the same time.
+		/// </summary>
+		void StartWorker(int stdOutWriteHandle, int stdErrWriteHandle)
+		{
+			m_processRunning = true;
+			m_workerFailed = false;
+			auto processStarted = std::promise<void>();
+			auto processStartedResult = processStarted.get_future();
+			DebugTrace("Thread");
+			m_workerThread = std::thread(
+				&LinuxMonitorProcess::WorkerThread,
+				this,
+				stdOutWriteHandle,
+				stdErrWriteHandle,
+				std::move(processStarted));
+
+			// Surface any failure to create the child process to the caller
+			try
+			{
+				processStartedResult.get();
+			}
+			catch (...)
+			{
+				m_workerThread.join();
+				throw;
+			}
+		}
 
-				environment.push_back("HOME=/");
-				environment.push_back("USER=USERNAME");
-				environment.push_back("PAHT=/usr/bin");
+		/// <summary>
+		/// Release the asynchronous state after the process failed to start
+		/// </summary>
+		void AbandonAsync()
+		{
+			for (auto registration : m_supervisorRegistrations)
+				m_supervisor->Unregister(registration);
+			m_supervisorRegistrations.clear();
 
-				scmp_filter_ctx ctx;
-				try
+			// A callback may still be running on the loop, release the handles there once it is done
+			auto self = std::move(m_self);
+			m_supervisor->Post([self]()
+			{
+				self->ReleaseNotify();
+				if (self->m_processHandle >= 0)
 				{
-					scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
-					if (ctx == NULL)
-						throw std::runtime_error("seccomp_init failed");
-
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(open), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(creat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(link), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(linkat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rename), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(unlink), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdirat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rmdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(fork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(vfork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone3), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					// TODO: Allow first execve when the parent has not connected yet to allow it
-					// Maybe try to filter to the known exe and only allow that and trace others
-					// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
-					// if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execve), 0) < 0)
-					// 	throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execveat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-
-					if (seccomp_load(ctx) < 0)
-						throw std::runtime_error("seccomp_load failed");
-
-					seccomp_release(ctx);
+					close(self->m_processHandle);
+					self->m_processHandle = -1;
 				}
-				catch(const std::exception& e)
+
+				self->m_outputReader = nullptr;
+			});
+
+			m_onExited = nullptr;
+			m_supervisor = nullptr;
+		}
+
+		/// <summary>
+		/// Reap the root process once its process handle reports the exit, only used with notifications
+		/// </summary>
+		void OnRootProcessExited()
+		{
+			try
+			{
+				int status;
+				rusage usage;
+				if (wait4(m_processId, &status, 0, &usage) == -1)
+					throw std::runtime_error(std::format("Wait failed {0}", errno));
+
+				SetRootProcessExited(status, usage);
+			}
+			catch (...)
+			{
+				m_workerException = std::current_exception();
+				m_workerFailed = true;
+			}
+
+			CompleteAsync();
+		}
+
+		/// <summary>
+		/// Record a failure from one of the threads that monitor the process tree, the first one wins
+		/// </summary>
+		void SetWorkerFailure(std::exception_ptr failure)
+		{
+			auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
+			if (!m_workerFailed)
+			{
+				m_workerException = failure;
+				m_workerFailed = true;
+			}
+		}
+
+		/// <summary>
+		/// A preloaded client is about to run a static executable, which never loads the client.
+		/// Trace the requesting thread from a new thread so it is monitored the same as with the trace backend.
+		/// Called from the message ring reader with the monitor lock held.
+		/// </summary>
+		void OnTraceRequest(pid_t processId, pid_t threadId)
+		{
+			// Hold on to the process itself so it can be stopped without racing a reused process id
+			auto processHandle = static_cast<int>(syscall(SYS_pidfd_open, processId, 0));
+			if (processHandle < 0)
+			{
+				// The client waits for a tracer that will never come
+				kill(processId, SIGKILL);
+				if (!m_workerFailed)
 				{
-					// Ensure we cleanup nicely
-					seccomp_release(ctx);
-					throw;
+					m_workerException = std::make_exception_ptr(
+						std::runtime_error(std::format("pidfd_open failed {0}", errno)));
+					m_workerFailed = true;
 				}
 
-				ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+				return;
+			}
 
-				std::vector<const char*> arguments;
-				arguments.push_back(m_executable.ToString().c_str());
-				for (auto& argument : m_arguments)
-					arguments.push_back(argument.c_str());
-				arguments.push_back(nullptr);
+			Log::Diag("Tracing static executable from process: {}", processId);
+			m_staticTracers.push_back({
+				processHandle,
+				std::thread(&LinuxMonitorProcess::TraceStaticProcess, this, processHandle, threadId),
+			});
+		}
 
-				auto environmentArray = std::vector<const char*>();
-				for (auto& value : environment)
-					environmentArray.push_back(value.c_str());
-				environmentArray.push_back(nullptr);
+		/// <summary>
+		/// Stop the static processes that outlived the root process, the same as the trace backend
+		/// does for the whole tree, and wait for their tracers
+		/// </summary>
+		void StopStaticTracers()
+		{
+			for (auto& tracer : m_staticTracers)
+			{
+				if (tracer.Thread.joinable())
+				{
+					syscall(SYS_pidfd_send_signal, tracer.ProcessHandle, SIGKILL, nullptr, 0);
+					tracer.Thread.join();
+				}
 
-				// Replace runtime with child program
-				DebugTrace("child exec");
-				auto result = execve(
-					m_executable.ToString().c_str(),
-					const_cast<char**>(arguments.data()),
-					const_cast<char**>(environmentArray.data()));
-				if (result == -1)
-					throw std::runtime_error("Failed to start child");
+				close(tracer.ProcessHandle);
 			}
-			catch(const std::exception& e)
+
+			m_staticTracers.clear();
+		}
+
+		/// <summary>
+		/// The supervisor loop can no longer service the handles, stop the process so the owner is completed
+		/// with the loop failure. A worker backend posts the completion once the tracee is gone.
+		/// </summary>
+		void OnSupervisorFailed(std::exception_ptr failure)
+		{
+			if (!m_workerFailed)
 			{
-				std::cerr << e.what() << '\n';
-				exit(1234);
+				m_workerException = failure;
+				m_workerFailed = true;
 			}
 
-			// Running in other program now
+			// The process id is only valid once the child has been launched
+			if (m_processRunning && m_processId > 0)
+				kill(m_processId, SIGKILL);
 		}
 
 		/// <summary>
-		/// The main entry point for the worker thread that will monitor incoming messages from all
-		/// client connections.
+		/// Record the exit code and the resources used by the root process once it has been reaped.
+		/// The usage includes every descendant the tree waited on before the root exited.
 		/// </summary>
+		void SetRootProcessExited(int status, const rusage& usage)
+		{
+			auto toMicroseconds = [](const timeval& value)
+			{
+				return std::chrono::seconds(value.tv_sec) + std::chrono::microseconds(value.tv_usec);
+			};
+
+			m_exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+			m_resourceUsage.WallTime = std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - m_startTime);
+			m_resourceUsage.UserTime = toMicroseconds(usage.ru_utime);
+			m_resourceUsage.SystemTime = toMicroseconds(usage.ru_stime);
+
+			// Linux reports the peak resident set size in kilobytes
+			m_resourceUsage.MaxResidentSetSize = static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+			m_resourceUsage.VoluntaryContextSwitches = static_cast<uint64_t>(usage.ru_nvcsw);
+			m_resourceUsage.InvoluntaryContextSwitches = static_cast<uint64_t>(usage.ru_nivcsw);
+			DebugTrace("Main exit:", m_exitCode);
+		}
 
-		struct ProcessTraceState
+		/// <summary>
+		/// Collect the final state of an asynchronous process on the supervisor loop and notify the owner
+		/// </summary>
+		void CompleteAsync()
 		{
-			pid_t ProcessId;
-			bool IsRunning;
-			bool InSystemCall;
-		};
+			// Stop watching every handle before any of them are closed
+			for (auto registration : m_supervisorRegistrations)
+				m_supervisor->Unregister(registration);
+			m_supervisorRegistrations.clear();
 
-		ProcessTraceState& InitializeProcess(
-			std::vector<ProcessTraceState>& activeProcesses,
-			pid_t processId)
+			if (m_workerThread.joinable())
+				m_workerThread.join();
+
+			ReleaseNotify();
+			if (m_processHandle >= 0)
+			{
+				close(m_processHandle);
+				m_processHandle = -1;
+			}
+
+			m_processRunning = false;
+
+			auto result = MonitorProcessResult();
+			try
+			{
+				m_outputReader->Stop();
+			}
+			catch (...)
+			{
+				if (!m_workerFailed)
+				{
+					m_workerException = std::current_exception();
+					m_workerFailed = true;
+				}
+			}
+
+			m_isFinished = true;
+			result.ExitCode = m_exitCode;
+			result.ResourceUsage = GetResourceUsage();
+			if (m_workerFailed)
+				result.Failure = m_workerException;
+
+			// Release the self reference last, this may be the final owner of the process
+			auto onExited = std::move(m_onExited);
+			auto self = std::move(m_self);
+			m_supervisor = nullptr;
+			onExited(std::move(result));
+		}
+
+		void ReleaseNotify()
 		{
-			activeProcesses.push_back({
-				processId,
-				true,
-				false,
-			});
+			if (m_notifyRequest != nullptr)
+			{
+				seccomp_notify_free(m_notifyRequest, m_notifyResponse);
+				m_notifyRequest = nullptr;
+				m_notifyResponse = nullptr;
+			}
 
-			return activeProcesses.at(activeProcesses.size() - 1);
+			if (m_notifyHandle >= 0)
+			{
+				close(m_notifyHandle);
+				m_notifyHandle = -1;
+			}
 		}
 
-		ProcessTraceState& FindProcess(
-			std::vector<ProcessTraceState>& activeProcesses,
-			pid_t processId)
+		void WorkerThread(
+			int stdOutWriteHandle,
+			int stdErrWriteHandle,
+			std::promise<void> processStarted)
 		{
-			auto result = std::find_if(
-				activeProcesses.begin(),
-				activeProcesses.end(),
-				[processId](const ProcessTraceState& value) { return value.ProcessId == processId; });
+			DebugTrace("WorkerThread Start");
 
-			if (result == activeProcesses.end())
+			int notifyHandle = -1;
+			try
 			{
-				throw std::runtime_error("Missing process trace state");
+				LaunchChild(stdOutWriteHandle, stdErrWriteHandle, notifyHandle);
 			}
-			else
+			catch (...)
 			{
-				return *result;
+				processStarted.set_exception(std::current_exception());
+				return;
+			}
+
+			processStarted.set_value();
+
+			try
+			{
+				if (m_backend == LinuxMonitorBackend::UserNotification)
+				{
+					NotifyProcess(notifyHandle);
+				}
+				else if (m_backend == LinuxMonitorBackend::Preload)
+				{
+					DrainMessageRing();
+				}
+				else
+				{
+					TraceProcess();
+				}
+			}
+			catch (...)
+			{
+				m_workerException = std::current_exception();
+				m_workerFailed = true;
 			}
+
+			if (m_processHandle >= 0)
+			{
+				close(m_processHandle);
+				m_processHandle = -1;
+			}
+
+			// Hand the completion over to the shared loop for an asynchronous process
+			if (m_supervisor != nullptr)
+				m_supervisor->Post([this]() { CompleteAsync(); });
+
+			DebugTrace("WorkerThread done");
 		}
 
-		void WorkerThread()
+		/// <summary>
+		/// Launch the child process from the calling thread, the write end of both pipes is always closed.
+		/// The seccomp listener is returned when user notifications are used.
+		/// </summary>
+		void LaunchChild(
+			int stdOutWriteHandle,
+			int stdErrWriteHandle,
+			int& notifyHandle)
 		{
-			Log::Diag("WorkerThread Start");
+			// Build up all child process state before the launch
+			auto workingDirectory = m_workingDirectory.ToString();
+			auto executable = m_executable.ToString();
+
+			std::vector<const char*> arguments;
+			arguments.push_back(executable.c_str());
+			for (auto& argument : m_arguments)
+				arguments.push_back(argument.c_str());
+			arguments.push_back(nullptr);
+
+			auto environment = std::vector<std::string>();
+			environment.push_back("HOME=/");
+			environment.push_back("USER=USERNAME");
+			environment.push_back("PAHT=/usr/bin");
+
+			// Load the monitor client into the child and hand it the shared memory ring
+			if (m_backend == LinuxMonitorBackend::Preload)
+			{
+				try
+				{
+					CreateMessageRing();
+				}
+				catch (...)
+				{
+					close(stdOutWriteHandle);
+					close(stdErrWriteHandle);
+					throw;
+				}
+
+				auto moduleName = System::IProcessManager::Current().GetCurrentProcessFileName();
+				auto clientPath = moduleName.GetParent() + Path("./Monitor.Client.so");
+				environment.push_back(std::format("LD_PRELOAD={0}", clientPath.ToString()));
+				environment.push_back(std::format("{0}={1}", MessageRingHandleVariable, m_messageRingHandle));
+			}
+
+			auto environmentArray = std::vector<const char*>();
+			for (auto& value : environment)
+				environmentArray.push_back(value.c_str());
+			environmentArray.push_back(nullptr);
+
+			// The child sends the seccomp listener back over a socket when notifications are used
+			int notifySockets[2] = { -1, -1 };
+			if (m_backend == LinuxMonitorBackend::UserNotification &&
+				socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, notifySockets) < 0)
+			{
+				close(stdOutWriteHandle);
+				close(stdErrWriteHandle);
+				throw std::runtime_error("Failed to create notify socket");
+			}
+
+			auto request = LinuxLaunchRequest();
+			request.WorkingDirectory = workingDirectory.c_str();
+			request.Executable = executable.c_str();
+			request.Arguments = const_cast<char* const*>(arguments.data());
+			request.Environment = const_cast<char* const*>(environmentArray.data());
+			request.StdOutHandle = stdOutWriteHandle;
+			request.StdErrHandle = stdErrWriteHandle;
+			request.InheritHandle = m_messageRingHandle;
+			request.Filter = nullptr;
+			request.SendListener = m_backend == LinuxMonitorBackend::UserNotification;
+			request.NotifySocket = notifySockets[1];
+			request.TraceMe = m_backend == LinuxMonitorBackend::Trace;
+
+			// Create a child process
+			DebugTrace("Launch");
+			std::exception_ptr launchException = nullptr;
+			try
+			{
+				// The preloaded client reports the events itself
+				if (m_backend == LinuxMonitorBackend::Trace)
+					request.Filter = &LinuxSystemCallFilter::GetTraceProgram();
+				else if (m_backend == LinuxMonitorBackend::UserNotification)
+					request.Filter = &LinuxSystemCallFilter::GetNotifyProgram();
+
+				m_startTime = std::chrono::steady_clock::now();
+				LinuxProcessLauncher::Launch(request, m_processId, m_processHandle);
+			}
+			catch (...)
+			{
+				launchException = std::current_exception();
+			}
+
+			// Close our handle on the write end
+			close(stdOutWriteHandle);
+			close(stdErrWriteHandle);
+			if (notifySockets[1] != -1)
+				close(notifySockets[1]);
+
+			if (launchException != nullptr)
+			{
+				if (notifySockets[0] != -1)
+					close(notifySockets[0]);
+
+				std::rethrow_exception(launchException);
+			}
+
+			// The child sent the listener before the exec, which the launch already waited on
+			if (m_backend == LinuxMonitorBackend::UserNotification)
+				notifyHandle = ReceiveHandle(notifySockets[0]);
+		}
 
+		void TraceProcess()
+		{
 			auto activeProcesses = std::vector<ProcessTraceState>();
 			InitializeProcess(activeProcesses, m_processId);
 
@@ -407,33 +939,61 @@ namespace Monitor::Linux
 			auto& rootProcess = FindProcess(activeProcesses, currentProcessId);
 
 			// Enable SecComp filtering
-			unsigned int ptraceOptions =
-				// Make it easier to track our SIGTRAP events
-				PTRACE_O_TRACESYSGOOD |
-				// Trace Secure Compute
-				PTRACE_O_TRACESECCOMP |
-				// Auto attach to children
-				PTRACE_O_TRACECLONE |
-				PTRACE_O_TRACEFORK |
-				PTRACE_O_TRACEVFORK |
-				// Prevent children from running beyond our lifetime
-				PTRACE_O_EXITKILL |
-				// Monitor execve
-				PTRACE_O_TRACEEXEC |
-				// Monitor child exit
-				PTRACE_O_TRACEEXIT;
-
-			if (ptrace(PTRACE_SETOPTIONS, m_processId, 0, ptraceOptions) < 0)
+			if (ptrace(PTRACE_SETOPTIONS, m_processId, 0, TraceOptions) < 0)
 				throw std::runtime_error(std::format("ptrace PTRACE_SETOPTIONS failed {0}", errno));
 			if (ptrace(PTRACE_CONT, m_processId, NULL, NULL) < 0)
 				throw std::runtime_error(std::format("ptrace PTRACE_CONT failed {0}", errno));
 
-			int eventCount = 0;
+			auto rootProcessId = m_processId;
+			rusage usage;
+			if (TraceProcessTree(activeProcesses, rootProcessId, status, usage))
+				SetRootProcessExited(status, usage);
+		}
+
+		/// <summary>
+		/// Trace a thread that is about to run a static executable for the preloaded client.
+		/// The client waits for the attach before it loads the trace program and continues with the exec,
+		/// the traced process tree then stops for this thread the same as with the trace backend.
+		/// </summary>
+		void TraceStaticProcess(int processHandle, pid_t threadId)
+		{
+			try
+			{
+				if (ptrace(PTRACE_SEIZE, threadId, 0, TraceOptions) < 0)
+					throw std::runtime_error(std::format("ptrace PTRACE_SEIZE failed {0}", errno));
+
+				auto activeProcesses = std::vector<ProcessTraceState>();
+				InitializeProcess(activeProcesses, threadId);
+
+				auto rootProcessId = threadId;
+				int status;
+				rusage usage;
+				TraceProcessTree(activeProcesses, rootProcessId, status, usage);
+			}
+			catch (...)
+			{
+				// The client waits for a tracer that will never come
+				syscall(SYS_pidfd_send_signal, processHandle, SIGKILL, nullptr, 0);
+				SetWorkerFailure(std::current_exception());
+			}
+		}
+
+		/// <summary>
+		/// Handle the ptrace stops for the process tree traced by this thread until the root of the tree exits.
+		/// Returns false if the wait reported a status that is not understood.
+		/// </summary>
+		bool TraceProcessTree(
+			std::vector<ProcessTraceState>& activeProcesses,
+			pid_t& rootProcessId,
+			int& status,
+			rusage& usage)
+		{
 			while (true)
 			{
-				eventCount++;
 				DebugTrace("Waiting...");
-				currentProcessId = waitpid(-1, &status, __WALL);
+
+				// Only wait on the process tree traced by this thread
+				auto currentProcessId = wait4(-1, &status, __WALL | __WNOTHREAD, &usage);
 				int wait_errno = errno;
 
 				DebugTrace("Wait:", currentProcessId);
@@ -443,24 +1003,29 @@ namespace Monitor::Linux
 					throw std::runtime_error(std::format("Wait failed {0}", wait_errno));
 
 				bool continueSysCall = false;
-				bool exited = WIFEXITED(status);
+				// A tracee stopped by a signal is gone the same as one that exited
+				bool exited = WIFEXITED(status) || WIFSIGNALED(status);
 
 				if (exited)
 				{
-					int exitCode = WEXITSTATUS(status);
 					auto& currentProcess = FindProcess(activeProcesses, currentProcessId);
 					currentProcess.IsRunning = false;
-					if (currentProcessId == m_processId)
+					if (currentProcessId == rootProcessId)
 					{
-						m_exitCode = exitCode;
-						DebugTrace("Main exit:", m_exitCode);
-						return;
+						return true;
 					}
 					else
 					{
 						DebugTrace("Child exit:", currentProcessId);
 					}
 				}
+				else if (WIFSTOPPED(status) && (status >> 16) == PTRACE_EVENT_STOP)
+				{
+					// The children of a seized process start with an event stop instead of a signal
+					DebugTrace("PTRACE_EVENT_STOP");
+					if (!HasProcess(activeProcesses, currentProcessId))
+						InitializeProcess(activeProcesses, currentProcessId);
+				}
 				else if (WIFSTOPPED(status))
 				{
 					auto signal = WSTOPSIG(status);
@@ -476,7 +1041,13 @@ namespace Monitor::Linux
 							if (currentProcess.InSystemCall)
 							{
 								// Process the completed system call
-								m_eventListener.ProcessSysCall(currentProcessId);
+								auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
+								m_eventCount++;
+								if (currentProcess.HasSysCallEntry)
+									m_eventListener.ProcessSysCall(currentProcessId, currentProcess.SysCallEntry);
+								else
+									m_eventListener.ProcessSysCall(currentProcessId);
+
 								currentProcess.InSystemCall = false;
 							}
 							else
@@ -504,8 +1075,12 @@ namespace Monitor::Linux
 										if (!currentProcess.InSystemCall)
 										{
 											// Signal the system call to continue so we can monitor the return result
+											auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
 											continueSysCall = true;
 											currentProcess.InSystemCall = true;
+											currentProcess.HasSysCallEntry = m_eventListener.TryGetSysCallEntry(
+												currentProcessId,
+												currentProcess.SysCallEntry);
 										} 
 										else
 										{
@@ -563,6 +1138,10 @@ namespace Monitor::Linux
 								case PTRACE_EVENT_EXEC:
 								{
 									DebugTrace("PTRACE_EVENT_EXEC");
+									TakeOverExecThread(activeProcesses, rootProcessId, currentProcessId);
+
+									auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
+									m_eventListener.ProcessExec(currentProcessId);
 									break;
 								}
 								case PTRACE_EVENT_EXIT:
@@ -571,6 +1150,9 @@ namespace Monitor::Linux
 									auto& currentProcess = FindProcess(activeProcesses, currentProcessId);
 									currentProcess.IsRunning = false;
 
+									auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
+									m_eventListener.ProcessExit(currentProcessId);
+
 									break;
 								}
 								default:
@@ -604,7 +1186,7 @@ namespace Monitor::Linux
 				else
 				{
 					Log::Warning("WARNING: Unknown Status");
-					break;
+					return false;
 				}
 
 				if (!exited)
@@ -621,20 +1203,368 @@ namespace Monitor::Linux
 						if (ptrace(PTRACE_CONT, currentProcessId, 0, 0) < 0)
 							throw std::runtime_error(std::format("ptrace PTRACE_CONT failed {0}", errno));
 					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Handle the seccomp user notifications for the process tree until the root process exits
+		/// The system calls continue in the kernel once they are recorded so the tracee never stops under ptrace
+		/// </summary>
+		void NotifyProcess(int notifyHandle)
+		{
+			// The launcher only returns a process handle when the kernel supports it
+			if (m_processHandle < 0)
+				m_processHandle = (int)syscall(SYS_pidfd_open, m_processId, 0);
+			auto processHandle = m_processHandle;
+			if (processHandle < 0)
+			{
+				close(notifyHandle);
+				throw std::runtime_error(std::format("pidfd_open failed {0}", errno));
+			}
 
-					if (eventCount > 100)
+			auto epollHandle = epoll_create1(EPOLL_CLOEXEC);
+			seccomp_notif* request = nullptr;
+			seccomp_notif_resp* response = nullptr;
+			try
+			{
+				if (epollHandle < 0)
+					throw std::runtime_error(std::format("epoll_create1 failed {0}", errno));
+
+				epoll_event notifyEvent = {};
+				notifyEvent.events = EPOLLIN;
+				notifyEvent.data.fd = notifyHandle;
+				if (epoll_ctl(epollHandle, EPOLL_CTL_ADD, notifyHandle, &notifyEvent) < 0)
+					throw std::runtime_error(std::format("epoll_ctl failed {0}", errno));
+
+				epoll_event processEvent = {};
+				processEvent.events = EPOLLIN;
+				processEvent.data.fd = processHandle;
+				if (epoll_ctl(epollHandle, EPOLL_CTL_ADD, processHandle, &processEvent) < 0)
+					throw std::runtime_error(std::format("epoll_ctl failed {0}", errno));
+
+				if (seccomp_notify_alloc(&request, &response) != 0)
+					throw std::runtime_error("seccomp_notify_alloc failed");
+
+				auto isRunning = true;
+				while (isRunning)
+				{
+					epoll_event events[2];
+					auto eventCount = epoll_wait(epollHandle, events, 2, -1);
+					if (eventCount < 0)
 					{
-						// Read std out so the child does not fill the buffer
-						// TODO: Move to background thread so we do not block the child
-						ReadAvailableStdOut();
-						ReadAvailableStdErr();
+						if (errno == EINTR)
+							continue;
+						throw std::runtime_error(std::format("epoll_wait failed {0}", errno));
+					}
 
-						eventCount = 0;
+					for (auto i = 0; i < eventCount; i++)
+					{
+						if (events[i].data.fd == notifyHandle)
+						{
+							HandleNotification(notifyHandle, *request, *response);
+						}
+						else
+						{
+							// The root process exited, notifications that raced the exit are no longer needed
+							isRunning = false;
+						}
 					}
 				}
+
+				int status;
+				rusage usage;
+				if (wait4(m_processId, &status, 0, &usage) == -1)
+					throw std::runtime_error(std::format("Wait failed {0}", errno));
+
+				SetRootProcessExited(status, usage);
+			}
+			catch (...)
+			{
+				seccomp_notify_free(request, response);
+				if (epollHandle >= 0)
+					close(epollHandle);
+				close(notifyHandle);
+				throw;
+			}
+
+			seccomp_notify_free(request, response);
+			close(epollHandle);
+			close(notifyHandle);
+		}
+
+		/// <summary>
+		/// Sends the continue response for a received notification when it leaves scope
+		/// The tracee is blocked in the kernel until it receives a response, even when processing fails
+		/// </summary>
+		class ScopedNotificationContinue
+		{
+		private:
+			int m_notifyHandle;
+			seccomp_notif_resp& m_response;
+
+		public:
+			ScopedNotificationContinue(int notifyHandle, uint64_t id, seccomp_notif_resp& response) :
+				m_notifyHandle(notifyHandle),
+				m_response(response)
+			{
+				m_response.id = id;
+				m_response.val = 0;
+				m_response.error = 0;
+				m_response.flags = SECCOMP_USER_NOTIF_FLAG_CONTINUE;
+			}
+
+			ScopedNotificationContinue(const ScopedNotificationContinue&) = delete;
+			ScopedNotificationContinue& operator=(const ScopedNotificationContinue&) = delete;
+
+			~ScopedNotificationContinue()
+			{
+				// Let the kernel run the original system call
+				// A failure means the target is gone and nothing is waiting on the response
+				seccomp_notify_respond(m_notifyHandle, &m_response);
+			}
+		};
+
+		void HandleNotification(int notifyHandle, seccomp_notif& request, seccomp_notif_resp& response)
+		{
+			if (seccomp_notify_receive(notifyHandle, &request) != 0)
+			{
+				// The target was killed before the notification could be received
+				DebugTrace("seccomp_notify_receive failed");
+				return;
+			}
+
+			auto scopedContinue = ScopedNotificationContinue(notifyHandle, request.id, response);
+
+			// Ignore all messages if partial monitor is enabled or the operation has already failed
+			if (!m_partialMonitor && !m_workerFailed)
+			{
+				auto entry = SysCallStatus({
+					(long)request.data.nr,
+					0,
+					0,
+					std::array<long, 6>({
+						(long)request.data.args[0],
+						(long)request.data.args[1],
+						(long)request.data.args[2],
+						(long)request.data.args[3],
+						(long)request.data.args[4],
+						(long)request.data.args[5],
+					})
+				});
+
+				try
+				{
+					m_eventCount++;
+					m_eventListener.ProcessSysCallNotification((pid_t)request.pid, entry);
+				}
+				catch (...)
+				{
+					// Fail the operation once the process exits, the observed accesses are incomplete
+					m_workerException = std::current_exception();
+					m_workerFailed = true;
+				}
 			}
 		}
 
+		/// <summary>
+		/// Create the shared memory that the preloaded clients write their events to
+		/// The handle is closed on exec so only the monitored child shares it
+		/// </summary>
+		void CreateMessageRing()
+		{
+			m_messageRingHandle = memfd_create("soup-monitor", MFD_CLOEXEC);
+			if (m_messageRingHandle < 0)
+				throw std::runtime_error(std::format("memfd_create failed {0}", errno));
+
+			auto size = MessageRing::GetSize(MessageRingSlotCount);
+			if (ftruncate(m_messageRingHandle, size) < 0)
+				throw std::runtime_error(std::format("ftruncate failed {0}", errno));
+
+			m_messageRingMemory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_messageRingHandle, 0);
+			if (m_messageRingMemory == MAP_FAILED)
+			{
+				m_messageRingMemory = nullptr;
+				throw std::runtime_error(std::format("mmap failed {0}", errno));
+			}
+
+			auto ring = MessageRing::Create(m_messageRingMemory, MessageRingSlotCount);
+
+			// Set the child process payload
+			auto& payload = ring.GetPayload();
+			payload.nTraceProcessId = getpid();
+
+			// Copy over the working directory
+			auto workingDirectoryString = m_workingDirectory.ToString();
+			if (workingDirectoryString.length() >= sizeof(payload.zWorkingDirectory))
+				throw std::runtime_error("Working directory too long for payload");
+			workingDirectoryString.copy(payload.zWorkingDirectory, workingDirectoryString.length());
+			payload.zWorkingDirectory[workingDirectoryString.length()] = 0;
+
+			// Pass along the read/write access lists
+			payload.EnableAccessChecks = m_enableAccessChecks;
+			LoadStringList(*m_allowedReadAccess, payload.zReadAccessDirectories, payload.cReadAccessDirectories, 4096);
+			LoadStringList(*m_allowedWriteAccess, payload.zWriteAccessDirectories, payload.cWriteAccessDirectories, 4096);
+
+			// A process that runs a static executable loads the trace program itself once it is traced
+			auto& traceProgram = LinuxSystemCallFilter::GetTraceProgram();
+			if (traceProgram.len > MaxTraceProgramLength)
+				throw std::runtime_error("Trace program does not fit in the payload");
+			std::copy(traceProgram.filter, traceProgram.filter + traceProgram.len, payload.TraceProgram);
+			payload.cTraceProgram = traceProgram.len;
+		}
+
+		/// <summary>
+		/// Pass the events from the preloaded clients along until the root process exits
+		/// </summary>
+		void DrainMessageRing()
+		{
+			auto ring = MessageRing(m_messageRingMemory);
+			auto message = Message();
+			auto readMessages = [&]()
+			{
+				auto lock = std::lock_guard<std::mutex>(m_monitorMutex);
+				while (ring.TryRead(message))
+				{
+					m_eventCount++;
+					m_detourListener.SafeLogMessage(message);
+				}
+			};
+
+			try
+			{
+				while (true)
+				{
+					readMessages();
+
+					// Only consider the root child, a static tracer owns the ptrace stops of its threads
+					int status;
+					rusage usage;
+					auto result = wait4(m_processId, &status, WNOHANG | __WNOTHREAD, &usage);
+					if (result == -1)
+						throw std::runtime_error(std::format("Wait failed {0}", errno));
+
+					if (result == m_processId)
+					{
+						// Pick up anything written right before the exit
+						readMessages();
+
+						SetRootProcessExited(status, usage);
+						break;
+					}
+
+					// The wait times out so the exit of the root process is noticed
+					ring.WaitForMessage(std::chrono::milliseconds(10));
+				}
+			}
+			catch (...)
+			{
+				StopStaticTracers();
+				throw;
+			}
+
+			StopStaticTracers();
+
+			auto abandonedCount = ring.GetAbandonedCount();
+
+			munmap(m_messageRingMemory, MessageRing::GetSize(MessageRingSlotCount));
+			m_messageRingMemory = nullptr;
+			close(m_messageRingHandle);
+			m_messageRingHandle = -1;
+
+			// A lost message may have been a file access, the observed state cannot be trusted for incremental builds
+			if (abandonedCount > 0)
+				throw std::runtime_error(
+					std::format("Lost {0} monitor messages from writers that exited early", abandonedCount));
+		}
+
+		static void LoadStringList(
+			const std::vector<Path>& values,
+			char* rawValues,
+			uint32_t& length,
+			uint64_t maxLength)
+		{
+			length = 0;
+			rawValues[0] = 0;
+
+			for (auto value : values)
+			{
+				auto stringValue = value.ToString();
+				auto newLength = length + static_cast<uint32_t>(stringValue.length()) + 1;
+				if (newLength > maxLength)
+					throw std::runtime_error("Ran out of space in payload string list");
+
+				// Copy over the null terminated string
+				stringValue.copy(rawValues + length, stringValue.length());
+				rawValues[newLength - 1] = 0;
+
+				length = newLength;
+			}
+		}
+
+		/// <summary>
+		/// Check if the executable has no program interpreter, which means it is statically linked
+		/// </summary>
+		static bool IsStaticExecutable(const Path& executable)
+		{
+			auto handle = open(executable.ToString().c_str(), O_RDONLY | O_CLOEXEC);
+			if (handle < 0)
+				return false;
+
+			auto isStatic = false;
+			Elf64_Ehdr header;
+			if (pread(handle, &header, sizeof(header), 0) == sizeof(header) &&
+				memcmp(header.e_ident, ELFMAG, SELFMAG) == 0 &&
+				header.e_ident[EI_CLASS] == ELFCLASS64)
+			{
+				isStatic = true;
+				for (auto i = 0; i < header.e_phnum; i++)
+				{
+					Elf64_Phdr programHeader;
+					auto offset = header.e_phoff + (i * header.e_phentsize);
+					if (pread(handle, &programHeader, sizeof(programHeader), offset) != sizeof(programHeader))
+						break;
+
+					if (programHeader.p_type == PT_INTERP)
+					{
+						isStatic = false;
+						break;
+					}
+				}
+			}
+
+			close(handle);
+			return isStatic;
+		}
+
+		/// <summary>
+		/// Receive a handle sent by the launched child, the socket is always closed
+		/// </summary>
+		static int ReceiveHandle(int socket)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+			char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			auto result = recvmsg(socket, &message, MSG_CMSG_CLOEXEC);
+			close(socket);
+			if (result <= 0)
+				throw std::runtime_error("Failed to receive notify handle");
+
+			auto header = CMSG_FIRSTHDR(&message);
+			if (header == nullptr || header->cmsg_type != SCM_RIGHTS)
+				throw std::runtime_error("Missing notify handle");
+
+			int handle;
+			memcpy(&handle, CMSG_DATA(header), sizeof(int));
+			return handle;
+		}
+
 		void DebugTrace(std::string_view message, uint32_t value)
 		{
 #ifdef TRACE_MONITOR_HOST
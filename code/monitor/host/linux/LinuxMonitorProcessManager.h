@@ -16,11 +16,30 @@ namespace Monitor::Linux
 	#endif
 	class LinuxMonitorProcessManager : public IMonitorProcessManager
 	{
+	private:
+		LinuxMonitorBackend m_backend;
+
+		// The shared loop for all asynchronous processes, created on first use
+		std::mutex m_supervisorMutex;
+		std::unique_ptr<LinuxProcessSupervisor> m_supervisor;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
 		/// </summary>
-		LinuxMonitorProcessManager()
+		LinuxMonitorProcessManager() :
+			LinuxMonitorProcessManager(LinuxMonitorBackend::Trace)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
+		/// The user notification backend requires Linux 5.5 or newer
+		/// </summary>
+		LinuxMonitorProcessManager(LinuxMonitorBackend backend) :
+			m_backend(backend),
+			m_supervisorMutex(),
+			m_supervisor()
 		{
 		}
 
@@ -35,15 +54,72 @@ namespace Monitor::Linux
 			std::shared_ptr<ISystemAccessMonitor> monitor,
 			bool enableAccessChecks,
 			bool partialMonitor,
-			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) override final
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess) override final
 		{
 			return std::make_shared<LinuxMonitorProcess>(
 				executable,
 				std::move(arguments),
 				workingDirectory,
 				std::move(monitor),
-				partialMonitor);
+				enableAccessChecks,
+				partialMonitor,
+				m_backend,
+				std::move(allowedReadAccess),
+				std::move(allowedWriteAccess));
+		}
+
+		/// <summary>
+		/// Start a monitored process on the shared supervisor loop and invoke the callback once it exits
+		/// </summary>
+		void StartMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			const std::map<std::string, std::string>& environmentVariables,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			bool enableAccessChecks,
+			bool partialMonitor,
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess,
+			MonitorProcessOutputCallback onOutput,
+			MonitorProcessCallback onExited) override final
+		{
+			auto process = std::make_shared<LinuxMonitorProcess>(
+				executable,
+				std::move(arguments),
+				workingDirectory,
+				std::move(monitor),
+				enableAccessChecks,
+				partialMonitor,
+				m_backend,
+				std::move(allowedReadAccess),
+				std::move(allowedWriteAccess));
+
+			// The process owns the callback until it exits, report a failure to start through it as well
+			auto startFailure = std::exception_ptr(nullptr);
+			try
+			{
+				process->StartAsync(GetSupervisor(), std::move(onOutput), onExited);
+				return;
+			}
+			catch (...)
+			{
+				startFailure = std::current_exception();
+			}
+
+			auto result = MonitorProcessResult();
+			result.Failure = startFailure;
+			onExited(std::move(result));
+		}
+
+	private:
+		LinuxProcessSupervisor& GetSupervisor()
+		{
+			auto lock = std::lock_guard<std::mutex>(m_supervisorMutex);
+			if (m_supervisor == nullptr)
+				m_supervisor = std::make_unique<LinuxProcessSupervisor>();
+			return *m_supervisor;
 		}
 	};
 }
@@ -0,0 +1,197 @@
+﻿// <copyright file="LinuxProcessLauncher.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The state for a single child process launch.
+	/// The child shares the memory of the caller until it execs so everything must be prepared up front.
+	/// </summary>
+	struct LinuxLaunchRequest
+	{
+		const char* WorkingDirectory;
+		const char* Executable;
+		char* const* Arguments;
+		char* const* Environment;
+		int StdOutHandle;
+		int StdErrHandle;
+
+		// An optional handle to keep open in the child
+		int InheritHandle;
+
+		// The optional seccomp program, when the listener is requested it is sent back on the notify socket
+		const sock_fprog* Filter;
+		bool SendListener;
+		int NotifySocket;
+
+		// Stop the child under the calling thread before it runs
+		bool TraceMe;
+	};
+
+	/// <summary>
+	/// Launches child processes with clone(CLONE_VM | CLONE_VFORK) so the cost does not grow with
+	/// the size of the build process, and returns a pidfd for the child when the kernel supports it.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxProcessLauncher
+	{
+	private:
+		static constexpr size_t StackSize = 64 * 1024;
+
+		struct LaunchState
+		{
+			const LinuxLaunchRequest* Request;
+			sigset_t SignalMask;
+
+			// Written by the child when it fails before the exec
+			const char* FailedStep;
+			int Error;
+		};
+
+	public:
+		/// <summary>
+		/// Start the child process, the process handle is -1 when pidfds are not supported
+		/// </summary>
+		static void Launch(const LinuxLaunchRequest& request, pid_t& processId, int& processHandle)
+		{
+			// The child runs on its own stack while sharing the rest of our memory
+			auto stack = mmap(
+				nullptr,
+				StackSize,
+				PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_NORESERVE,
+				-1,
+				0);
+			if (stack == MAP_FAILED)
+				throw std::runtime_error(std::format("Failed to allocate launch stack {0}", errno));
+
+			auto state = LaunchState();
+			state.Request = &request;
+			state.FailedStep = nullptr;
+			state.Error = 0;
+
+			// Block all signals so no handler runs on the shared memory before the exec
+			sigset_t allSignals;
+			sigfillset(&allSignals);
+			pthread_sigmask(SIG_SETMASK, &allSignals, &state.SignalMask);
+
+			auto stackTop = static_cast<char*>(stack) + StackSize;
+			processHandle = -1;
+			auto flags = CLONE_VM | CLONE_VFORK | SIGCHLD;
+			processId = clone(&LaunchChild, stackTop, flags | CLONE_PIDFD, &state, &processHandle);
+			if (processId == -1 && errno == EINVAL)
+			{
+				// Older kernels do not know about pidfds
+				processHandle = -1;
+				processId = clone(&LaunchChild, stackTop, flags, &state, nullptr);
+			}
+
+			auto cloneError = errno;
+			pthread_sigmask(SIG_SETMASK, &state.SignalMask, nullptr);
+			munmap(stack, StackSize);
+
+			if (processId == -1)
+				throw std::runtime_error(std::format("Failed to clone child process {0}", cloneError));
+
+			// The caller is suspended until the child has exec'd or exited
+			if (state.FailedStep != nullptr)
+			{
+				int status;
+				waitpid(processId, &status, 0);
+				if (processHandle >= 0)
+				{
+					close(processHandle);
+					processHandle = -1;
+				}
+
+				throw std::runtime_error(std::format("Failed to start child: {0} {1}", state.FailedStep, state.Error));
+			}
+		}
+
+	private:
+		/// <summary>
+		/// The child entry point, only async signal safe calls are allowed until the exec
+		/// </summary>
+		static int LaunchChild(void* value)
+		{
+			auto& state = *static_cast<LaunchState*>(value);
+			auto& request = *state.Request;
+
+			// Set the working directory for only the child process
+			if (chdir(request.WorkingDirectory) == -1)
+				return Fail(state, "chdir");
+
+			// Redirect stdout and stderr to the pipe write ends
+			if (dup2(request.StdOutHandle, STDOUT_FILENO) != STDOUT_FILENO)
+				return Fail(state, "dup2 stdout");
+			if (dup2(request.StdErrHandle, STDERR_FILENO) != STDERR_FILENO)
+				return Fail(state, "dup2 stderr");
+
+			// Let the handle survive the exec
+			if (request.InheritHandle >= 0 && fcntl(request.InheritHandle, F_SETFD, 0) < 0)
+				return Fail(state, "inherit handle");
+
+			if (request.Filter != nullptr)
+			{
+				if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) < 0)
+					return Fail(state, "no new privileges");
+
+				auto filterFlags = request.SendListener ? SECCOMP_FILTER_FLAG_NEW_LISTENER : 0;
+				auto listener = (int)syscall(SYS_seccomp, SECCOMP_SET_MODE_FILTER, filterFlags, request.Filter);
+				if (listener < 0)
+					return Fail(state, "seccomp");
+
+				// Hand the listener to the monitor before running anything that is filtered
+				if (request.SendListener)
+				{
+					if (!TrySendHandle(request.NotifySocket, listener))
+						return Fail(state, "send listener");
+					close(listener);
+				}
+			}
+
+			if (request.TraceMe && ptrace(PTRACE_TRACEME, 0, nullptr, nullptr) < 0)
+				return Fail(state, "ptrace");
+
+			// Replace runtime with child program
+			sigprocmask(SIG_SETMASK, &state.SignalMask, nullptr);
+			execve(request.Executable, request.Arguments, request.Environment);
+			return Fail(state, "execve");
+		}
+
+		static int Fail(LaunchState& state, const char* step)
+		{
+			state.FailedStep = step;
+			state.Error = errno;
+			_exit(127);
+		}
+
+		/// <summary>
+		/// Send a handle over a unix socket without allocating
+		/// </summary>
+		static bool TrySendHandle(int socket, int handle)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+			char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			auto header = CMSG_FIRSTHDR(&message);
+			header->cmsg_level = SOL_SOCKET;
+			header->cmsg_type = SCM_RIGHTS;
+			header->cmsg_len = CMSG_LEN(sizeof(int));
+			memcpy(CMSG_DATA(header), &handle, sizeof(int));
+
+			return sendmsg(socket, &message, 0) >= 0;
+		}
+	};
+}
@@ -0,0 +1,403 @@
+﻿// <copyright file="LinuxProcessOutputReader.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Drains the standard output and error pipes of a monitored process on a background thread,
+	/// or from a shared event loop, so a child that writes a lot of output never blocks on a full pipe
+	/// while the monitor is busy. When an output callback is provided each complete line is reported as
+	/// soon as it arrives and only the trailing partial line is kept in memory, otherwise the output is
+	/// captured up to a cap for the blocking process interface.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxProcessOutputReader
+	{
+	private:
+		static constexpr size_t BufferSize = 64 * 1024;
+		static constexpr int PipeSize = 1024 * 1024;
+
+		// The maximum output captured for each stream when it is not reported, the remainder is dropped
+		static constexpr size_t MaxCapturedSize = 16 * 1024 * 1024;
+
+		// The longest partial line held while reporting, a longer line is reported in pieces
+		static constexpr size_t MaxLineSize = 64 * 1024;
+
+		struct OutputStream
+		{
+			MonitorProcessOutputStream Type;
+			int Handle;
+			bool IsOpen;
+			std::string Content;
+			size_t DroppedSize;
+		};
+
+		OutputStream m_stdOut;
+		OutputStream m_stdErr;
+		MonitorProcessOutputCallback m_onOutput;
+		int m_stopHandle;
+		std::vector<char> m_buffer;
+
+		std::thread m_readerThread;
+		std::exception_ptr m_readerException;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxProcessOutputReader'/> class.
+		/// Takes ownership of the read end of both pipes.
+		/// </summary>
+		LinuxProcessOutputReader(
+			int stdOutReadHandle,
+			int stdErrReadHandle,
+			MonitorProcessOutputCallback onOutput) :
+			m_stdOut({ MonitorProcessOutputStream::StandardOutput, stdOutReadHandle, true, {}, 0 }),
+			m_stdErr({ MonitorProcessOutputStream::StandardError, stdErrReadHandle, true, {}, 0 }),
+			m_onOutput(std::move(onOutput)),
+			m_stopHandle(-1),
+			m_buffer(),
+			m_readerThread(),
+			m_readerException(nullptr)
+		{
+		}
+
+		LinuxProcessOutputReader(const LinuxProcessOutputReader&) = delete;
+		LinuxProcessOutputReader& operator=(const LinuxProcessOutputReader&) = delete;
+
+		~LinuxProcessOutputReader()
+		{
+			if (m_readerThread.joinable())
+			{
+				RequestStop();
+				m_readerThread.join();
+			}
+
+			CloseHandles();
+		}
+
+		/// <summary>
+		/// Start reading on the background thread
+		/// </summary>
+		void Start()
+		{
+			m_stopHandle = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			if (m_stopHandle < 0)
+				throw std::runtime_error(std::format("eventfd failed {0}", errno));
+
+			Attach();
+
+			m_readerThread = std::thread(&LinuxProcessOutputReader::ReaderThread, this);
+		}
+
+		/// <summary>
+		/// Prepare the pipes to be read from an external event loop instead of the background thread
+		/// </summary>
+		void Attach()
+		{
+			// Only the read end is non blocking, the child must block on a full pipe instead of dropping output
+			SetNonBlocking(m_stdOut.Handle);
+			SetNonBlocking(m_stdErr.Handle);
+
+			// Larger pipes let a burst of output through without waking the reader for every page.
+			// Ignore failures, the default size still works and the limit is configurable per system.
+			fcntl(m_stdOut.Handle, F_SETPIPE_SZ, PipeSize);
+			fcntl(m_stdErr.Handle, F_SETPIPE_SZ, PipeSize);
+
+			m_buffer.resize(BufferSize);
+		}
+
+		/// <summary>
+		/// Get the read end of the standard output pipe
+		/// </summary>
+		int GetStandardOutputHandle() const
+		{
+			return m_stdOut.Handle;
+		}
+
+		/// <summary>
+		/// Get the read end of the standard error pipe
+		/// </summary>
+		int GetStandardErrorHandle() const
+		{
+			return m_stdErr.Handle;
+		}
+
+		/// <summary>
+		/// Read the available standard output from an external event loop, returns false once the pipe is closed
+		/// </summary>
+		bool ReadStandardOutput()
+		{
+			ReadAvailable(m_stdOut);
+			return m_stdOut.IsOpen;
+		}
+
+		/// <summary>
+		/// Read the available standard error from an external event loop, returns false once the pipe is closed
+		/// </summary>
+		bool ReadStandardError()
+		{
+			ReadAvailable(m_stdErr);
+			return m_stdErr.IsOpen;
+		}
+
+		/// <summary>
+		/// Read anything left in the pipes and stop the background thread.
+		/// A detached grandchild may hold the pipes open forever so this does not wait for the end of the stream.
+		/// When attached to an external loop the caller must stop watching the pipes first.
+		/// </summary>
+		void Stop()
+		{
+			if (m_readerThread.joinable())
+			{
+				RequestStop();
+				m_readerThread.join();
+			}
+			else if (m_readerException == nullptr)
+			{
+				try
+				{
+					ReadAvailable(m_stdOut);
+					ReadAvailable(m_stdErr);
+				}
+				catch (...)
+				{
+					m_readerException = std::current_exception();
+				}
+			}
+
+			CloseHandles();
+
+			if (m_readerException == nullptr)
+			{
+				try
+				{
+					Finish(m_stdOut, "stdout");
+					Finish(m_stdErr, "stderr");
+				}
+				catch (...)
+				{
+					m_readerException = std::current_exception();
+				}
+			}
+
+			if (m_readerException != nullptr)
+				std::rethrow_exception(m_readerException);
+		}
+
+		/// <summary>
+		/// Get the captured standard output, empty when the output was reported
+		/// </summary>
+		const std::string& GetStandardOutput() const
+		{
+			return m_stdOut.Content;
+		}
+
+		/// <summary>
+		/// Get the captured standard error output, empty when the output was reported
+		/// </summary>
+		const std::string& GetStandardError() const
+		{
+			return m_stdErr.Content;
+		}
+
+	private:
+		void RequestStop()
+		{
+			uint64_t value = 1;
+			if (write(m_stopHandle, &value, sizeof(value)) != sizeof(value))
+				Log::Error("Failed to stop output reader {0}", errno);
+		}
+
+		void CloseHandles()
+		{
+			if (m_stdOut.Handle >= 0)
+			{
+				close(m_stdOut.Handle);
+				m_stdOut.Handle = -1;
+			}
+
+			if (m_stdErr.Handle >= 0)
+			{
+				close(m_stdErr.Handle);
+				m_stdErr.Handle = -1;
+			}
+
+			if (m_stopHandle >= 0)
+			{
+				close(m_stopHandle);
+				m_stopHandle = -1;
+			}
+		}
+
+		void ReaderThread()
+		{
+			auto epollHandle = -1;
+			try
+			{
+				epollHandle = epoll_create1(EPOLL_CLOEXEC);
+				if (epollHandle < 0)
+					throw std::runtime_error(std::format("epoll_create1 failed {0}", errno));
+
+				Register(epollHandle, m_stdOut.Handle);
+				Register(epollHandle, m_stdErr.Handle);
+				Register(epollHandle, m_stopHandle);
+
+				auto isStopping = false;
+				while (!isStopping && (m_stdOut.IsOpen || m_stdErr.IsOpen))
+				{
+					epoll_event events[3];
+					auto eventCount = epoll_wait(epollHandle, events, 3, -1);
+					if (eventCount < 0)
+					{
+						if (errno == EINTR)
+							continue;
+						throw std::runtime_error(std::format("epoll_wait failed {0}", errno));
+					}
+
+					for (auto i = 0; i < eventCount; i++)
+					{
+						if (events[i].data.fd == m_stopHandle)
+							isStopping = true;
+						else if (events[i].data.fd == m_stdOut.Handle)
+							ReadAvailable(m_stdOut, epollHandle);
+						else if (events[i].data.fd == m_stdErr.Handle)
+							ReadAvailable(m_stdErr, epollHandle);
+					}
+				}
+
+				// The process has exited, pick up the final output
+				ReadAvailable(m_stdOut);
+				ReadAvailable(m_stdErr);
+			}
+			catch (...)
+			{
+				m_readerException = std::current_exception();
+			}
+
+			if (epollHandle >= 0)
+				close(epollHandle);
+		}
+
+		static void SetNonBlocking(int handle)
+		{
+			auto flags = fcntl(handle, F_GETFL);
+			if (flags < 0 || fcntl(handle, F_SETFL, flags | O_NONBLOCK) < 0)
+				throw std::runtime_error(std::format("Failed to set non blocking output {0}", errno));
+		}
+
+		static void Register(int epollHandle, int handle)
+		{
+			auto event = epoll_event();
+			event.events = EPOLLIN;
+			event.data.fd = handle;
+			if (epoll_ctl(epollHandle, EPOLL_CTL_ADD, handle, &event) < 0)
+				throw std::runtime_error(std::format("epoll_ctl failed {0}", errno));
+		}
+
+		void ReadAvailable(OutputStream& stream, int epollHandle)
+		{
+			ReadAvailable(stream);
+
+			// Stop watching the pipe once all writers closed it
+			if (!stream.IsOpen)
+				epoll_ctl(epollHandle, EPOLL_CTL_DEL, stream.Handle, nullptr);
+		}
+
+		void ReadAvailable(OutputStream& stream)
+		{
+			while (stream.IsOpen)
+			{
+				auto countRead = read(stream.Handle, m_buffer.data(), m_buffer.size());
+				if (countRead > 0)
+				{
+					Append(stream, std::string_view(m_buffer.data(), countRead));
+				}
+				else if (countRead == 0)
+				{
+					// All writers closed the pipe
+					stream.IsOpen = false;
+				}
+				else if (errno == EINTR)
+				{
+					continue;
+				}
+				else if (errno == EAGAIN)
+				{
+					break;
+				}
+				else
+				{
+					throw std::runtime_error(std::format("Failed to read process output {0}", errno));
+				}
+			}
+		}
+
+		void Append(OutputStream& stream, std::string_view value)
+		{
+			if (m_onOutput)
+			{
+				Report(stream, value);
+				return;
+			}
+
+			// Keep the start of the output, it usually holds the first and most useful error
+			auto remainingSize = MaxCapturedSize - std::min(stream.Content.size(), MaxCapturedSize);
+			auto capturedSize = std::min(value.size(), remainingSize);
+			stream.Content.append(value.substr(0, capturedSize));
+			stream.DroppedSize += value.size() - capturedSize;
+		}
+
+		/// <summary>
+		/// Report the complete lines and hold on to the partial line until the rest of it arrives
+		/// </summary>
+		void Report(OutputStream& stream, std::string_view value)
+		{
+			while (!value.empty())
+			{
+				auto lineEnd = value.find('\n');
+				if (lineEnd == std::string_view::npos)
+				{
+					stream.Content.append(value);
+					if (stream.Content.size() >= MaxLineSize)
+						ReportLine(stream);
+					break;
+				}
+
+				stream.Content.append(value.substr(0, lineEnd));
+				ReportLine(stream);
+				value.remove_prefix(lineEnd + 1);
+			}
+		}
+
+		void ReportLine(OutputStream& stream)
+		{
+			auto line = std::string_view(stream.Content);
+			if (line.ends_with('\r'))
+				line.remove_suffix(1);
+
+			m_onOutput(stream.Type, line);
+			stream.Content.clear();
+		}
+
+		void Finish(OutputStream& stream, std::string_view name)
+		{
+			// Report the trailing line that was not terminated
+			if (m_onOutput)
+			{
+				if (!stream.Content.empty())
+					ReportLine(stream);
+				return;
+			}
+
+			if (stream.DroppedSize > 0)
+			{
+				stream.Content.append(std::format("\n[{0} bytes of {1} truncated]\n", stream.DroppedSize, name));
+				stream.DroppedSize = 0;
+			}
+		}
+	};
+}
@@ -0,0 +1,117 @@
+﻿// <copyright file="LinuxProcessPathTable.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Resolves the relative paths passed to system calls using the working directory and open
+	/// directory descriptors of each traced process. The working directory is read from procfs the first
+	/// time it is needed and kept until a traced chdir, a directory descriptor is read each time it is used
+	/// so the descriptor system calls do not have to stop the tracee.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxProcessPathTable
+	{
+	private:
+		std::unordered_map<pid_t, std::string> m_workingDirectories;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxProcessPathTable'/> class.
+		/// </summary>
+		LinuxProcessPathTable() :
+			m_workingDirectories()
+		{
+		}
+
+		/// <summary>
+		/// Resolve the path relative to the directory descriptor of a stopped process
+		/// </summary>
+		std::string ResolvePath(pid_t pid, int32_t dirfd, std::string path)
+		{
+			if (path.empty() || path.starts_with('/'))
+				return path;
+
+			if (dirfd != AT_FDCWD)
+				return ResolvePathUncached(pid, dirfd, std::move(path));
+
+			auto& directory = m_workingDirectories[pid];
+			if (directory.empty())
+				directory = ReadDirectory(pid, dirfd);
+			if (directory.empty())
+				return path;
+
+			return Combine(directory, path);
+		}
+
+		/// <summary>
+		/// Resolve the path without using or updating the table, for a system call that has not run yet
+		/// </summary>
+		static std::string ResolvePathUncached(pid_t pid, int32_t dirfd, std::string path)
+		{
+			if (path.empty() || path.starts_with('/'))
+				return path;
+
+			auto directory = ReadDirectory(pid, dirfd);
+			if (directory.empty())
+				return path;
+
+			return Combine(directory, path);
+		}
+
+		/// <summary>
+		/// The working directory changed, threads share it with the caller so forget it for all of them
+		/// </summary>
+		void OnChangeDirectory()
+		{
+			m_workingDirectories.clear();
+		}
+
+		/// <summary>
+		/// The process replaced its image
+		/// </summary>
+		void OnExec(pid_t pid)
+		{
+			m_workingDirectories.erase(pid);
+		}
+
+		/// <summary>
+		/// The process exited
+		/// </summary>
+		void OnExit(pid_t pid)
+		{
+			m_workingDirectories.erase(pid);
+		}
+
+	private:
+		static std::string Combine(const std::string& directory, const std::string& path)
+		{
+			auto result = std::string();
+			result.reserve(directory.size() + path.size() + 1);
+			result.append(directory);
+			if (!directory.ends_with('/'))
+				result.push_back('/');
+			result.append(path);
+			return result;
+		}
+
+		static std::string ReadDirectory(pid_t pid, int32_t dirfd)
+		{
+			auto linkPath = dirfd == AT_FDCWD ?
+				std::format("/proc/{0}/cwd", pid) :
+				std::format("/proc/{0}/fd/{1}", pid, dirfd);
+
+			char buffer[PATH_MAX];
+			auto length = readlink(linkPath.c_str(), buffer, sizeof(buffer));
+			if (length <= 0 || length == sizeof(buffer))
+				return std::string();
+
+			return std::string(buffer, length);
+		}
+	};
+}
@@ -0,0 +1,330 @@
+﻿// <copyright file="LinuxProcessSupervisor.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A single epoll loop that services the handles of many running child processes at once.
+	/// The process pidfds, output pipes and monitor listeners are registered with a callback that runs
+	/// on the loop thread whenever the handle is readable, so no thread has to block on a single child.
+	/// If the loop itself fails every registered handle is failed with the error and posted actions keep
+	/// running on the loop thread, so the owners are still able to complete their processes.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxProcessSupervisor
+	{
+	private:
+		static constexpr int MaxEvents = 64;
+
+		// The registration id reserved for the wake handle
+		static constexpr uint64_t WakeId = 0;
+
+		struct Registration
+		{
+			int Handle;
+			std::shared_ptr<std::function<bool()>> OnReady;
+			std::function<void(std::exception_ptr)> OnFailed;
+		};
+
+		int m_epollHandle;
+		int m_wakeHandle;
+		std::thread m_loopThread;
+
+		std::mutex m_mutex;
+		uint64_t m_nextId;
+		std::unordered_map<uint64_t, Registration> m_registrations;
+		std::vector<std::function<void()>> m_pendingActions;
+		std::condition_variable m_pendingActionsChanged;
+		std::exception_ptr m_failure;
+		bool m_isStopping;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxProcessSupervisor'/> class.
+		/// </summary>
+		LinuxProcessSupervisor() :
+			m_epollHandle(-1),
+			m_wakeHandle(-1),
+			m_loopThread(),
+			m_mutex(),
+			m_nextId(WakeId + 1),
+			m_registrations(),
+			m_pendingActions(),
+			m_pendingActionsChanged(),
+			m_failure(nullptr),
+			m_isStopping(false)
+		{
+			m_epollHandle = epoll_create1(EPOLL_CLOEXEC);
+			if (m_epollHandle < 0)
+				throw std::runtime_error(std::format("epoll_create1 failed {0}", errno));
+
+			m_wakeHandle = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			if (m_wakeHandle < 0)
+			{
+				close(m_epollHandle);
+				throw std::runtime_error(std::format("eventfd failed {0}", errno));
+			}
+
+			auto event = epoll_event();
+			event.events = EPOLLIN;
+			event.data.u64 = WakeId;
+			if (epoll_ctl(m_epollHandle, EPOLL_CTL_ADD, m_wakeHandle, &event) < 0)
+			{
+				close(m_wakeHandle);
+				close(m_epollHandle);
+				throw std::runtime_error(std::format("epoll_ctl failed {0}", errno));
+			}
+
+			m_loopThread = std::thread(&LinuxProcessSupervisor::LoopThread, this);
+		}
+
+		LinuxProcessSupervisor(const LinuxProcessSupervisor&) = delete;
+		LinuxProcessSupervisor& operator=(const LinuxProcessSupervisor&) = delete;
+
+		/// <summary>
+		/// Finalizes an instance of the <see cref='LinuxProcessSupervisor'/> class.
+		/// The supervisor must outlive the processes it supervises, anything still registered is abandoned.
+		/// </summary>
+		~LinuxProcessSupervisor()
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(m_mutex);
+				m_isStopping = true;
+			}
+
+			Wake();
+			m_pendingActionsChanged.notify_one();
+			m_loopThread.join();
+
+			close(m_wakeHandle);
+			close(m_epollHandle);
+		}
+
+		/// <summary>
+		/// Watch a handle and invoke the callback on the loop thread each time it is readable.
+		/// The handle is removed once the callback returns false, it is never closed by the supervisor.
+		/// The optional failure callback runs on the loop thread if the loop can no longer watch the handle.
+		/// Returns the id used to remove the handle early.
+		/// </summary>
+		uint64_t Register(
+			int handle,
+			std::function<bool()> onReady,
+			std::function<void(std::exception_ptr)> onFailed = nullptr)
+		{
+			auto lock = std::lock_guard<std::mutex>(m_mutex);
+			if (m_failure != nullptr)
+				std::rethrow_exception(m_failure);
+
+			auto id = m_nextId++;
+			m_registrations.emplace(
+				id,
+				Registration({
+					handle,
+					std::make_shared<std::function<bool()>>(std::move(onReady)),
+					std::move(onFailed),
+				}));
+
+			auto event = epoll_event();
+			event.events = EPOLLIN;
+			event.data.u64 = id;
+			if (epoll_ctl(m_epollHandle, EPOLL_CTL_ADD, handle, &event) < 0)
+			{
+				m_registrations.erase(id);
+				throw std::runtime_error(std::format("epoll_ctl failed {0}", errno));
+			}
+
+			return id;
+		}
+
+		/// <summary>
+		/// Stop watching a handle, this must happen before the handle is closed
+		/// </summary>
+		void Unregister(uint64_t id)
+		{
+			auto lock = std::lock_guard<std::mutex>(m_mutex);
+			auto findResult = m_registrations.find(id);
+			if (findResult != m_registrations.end())
+			{
+				epoll_ctl(m_epollHandle, EPOLL_CTL_DEL, findResult->second.Handle, nullptr);
+				m_registrations.erase(findResult);
+			}
+		}
+
+		/// <summary>
+		/// Run an action on the loop thread
+		/// </summary>
+		void Post(std::function<void()> action)
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(m_mutex);
+				m_pendingActions.push_back(std::move(action));
+			}
+
+			Wake();
+			m_pendingActionsChanged.notify_one();
+		}
+
+	private:
+		void Wake()
+		{
+			uint64_t value = 1;
+			if (write(m_wakeHandle, &value, sizeof(value)) != sizeof(value) && errno != EAGAIN)
+				Log::Error("Failed to wake process supervisor {0}", errno);
+		}
+
+		void LoopThread()
+		{
+			epoll_event events[MaxEvents];
+			while (true)
+			{
+				auto eventCount = epoll_wait(m_epollHandle, events, MaxEvents, -1);
+				if (eventCount < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					auto error = errno;
+					Log::Error("Process supervisor epoll_wait failed {0}", error);
+					FailRegistrations(std::make_exception_ptr(
+						std::runtime_error(std::format("Process supervisor epoll_wait failed {0}", error))));
+					RunActionsUntilStopped();
+					return;
+				}
+
+				for (auto i = 0; i < eventCount; i++)
+				{
+					auto id = events[i].data.u64;
+					if (id == WakeId)
+					{
+						uint64_t value;
+						auto result = read(m_wakeHandle, &value, sizeof(value));
+						(void)result;
+						continue;
+					}
+
+					// The handle may have been removed by an earlier callback in the same batch
+					std::shared_ptr<std::function<bool()>> onReady;
+					{
+						auto lock = std::lock_guard<std::mutex>(m_mutex);
+						auto findResult = m_registrations.find(id);
+						if (findResult == m_registrations.end())
+							continue;
+						onReady = findResult->second.OnReady;
+					}
+
+					// Callbacks own their errors, an escaped exception would take down every supervised process
+					auto keepWatching = false;
+					try
+					{
+						keepWatching = (*onReady)();
+					}
+					catch (const std::exception& ex)
+					{
+						Log::Error("Process supervisor callback failed: {0}", ex.what());
+					}
+					catch (...)
+					{
+						Log::Error("Process supervisor callback failed with an unknown error");
+					}
+
+					if (!keepWatching)
+						Unregister(id);
+				}
+
+				auto actions = std::vector<std::function<void()>>();
+				auto isStopping = false;
+				{
+					auto lock = std::lock_guard<std::mutex>(m_mutex);
+					actions.swap(m_pendingActions);
+					isStopping = m_isStopping;
+				}
+
+				RunActions(actions);
+
+				if (isStopping)
+					return;
+			}
+		}
+
+		/// <summary>
+		/// Remove every registration and hand the loop failure to the owners that asked for it
+		/// </summary>
+		void FailRegistrations(std::exception_ptr failure)
+		{
+			auto registrations = std::unordered_map<uint64_t, Registration>();
+			{
+				auto lock = std::lock_guard<std::mutex>(m_mutex);
+				m_failure = failure;
+				registrations.swap(m_registrations);
+			}
+
+			for (auto& [id, registration] : registrations)
+			{
+				if (registration.OnFailed == nullptr)
+					continue;
+
+				try
+				{
+					registration.OnFailed(failure);
+				}
+				catch (...)
+				{
+					Log::Error("Process supervisor failure callback failed");
+				}
+			}
+		}
+
+		/// <summary>
+		/// Keep servicing posted actions once the handles can no longer be watched,
+		/// the owners complete their processes through them
+		/// </summary>
+		void RunActionsUntilStopped()
+		{
+			while (true)
+			{
+				auto actions = std::vector<std::function<void()>>();
+				auto isStopping = false;
+				{
+					auto lock = std::unique_lock<std::mutex>(m_mutex);
+					m_pendingActionsChanged.wait(
+						lock,
+						[this]() { return m_isStopping || !m_pendingActions.empty(); });
+					actions.swap(m_pendingActions);
+					isStopping = m_isStopping;
+				}
+
+				RunActions(actions);
+
+				if (isStopping)
+					return;
+			}
+		}
+
+		/// <summary>
+		/// Run the posted actions, a failed action must not take down every supervised process
+		/// </summary>
+		void RunActions(std::vector<std::function<void()>>& actions)
+		{
+			for (auto& action : actions)
+			{
+				try
+				{
+					action();
+				}
+				catch (const std::exception& ex)
+				{
+					Log::Error("Process supervisor action failed: {0}", ex.what());
+				}
+				catch (...)
+				{
+					Log::Error("Process supervisor action failed with an unknown error");
+				}
+			}
+		}
+	};
+}
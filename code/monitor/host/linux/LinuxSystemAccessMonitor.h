@@ -7,12 +7,33 @@ namespace Monitor::Linux
 	class LinuxSystemAccessMonitor : public ILinuxSystemMonitor
 	{
 	private:
+		// Allow the reported path sets to be checked with a view of the path
+		struct PathHash
+		{
+			using is_transparent = void;
+
+			size_t operator()(std::string_view value) const
+			{
+				return std::hash<std::string_view>()(value);
+			}
+		};
+
+		using PathSet = std::unordered_set<std::string, PathHash, std::equal_to<>>;
+
 		std::shared_ptr<ISystemAccessMonitor> _monitor;
 
+		// The accesses already reported for the process tree, repeats are dropped before parsing the path
+		PathSet _reportedReads;
+		PathSet _reportedMissingReads;
+		PathSet _reportedWrites;
+
 	public:
 		LinuxSystemAccessMonitor(
 			std::shared_ptr<ISystemAccessMonitor> monitor) :
-			_monitor(std::move(monitor))
+			_monitor(std::move(monitor)),
+			_reportedReads(),
+			_reportedMissingReads(),
+			_reportedWrites()
 		{
 		}
 
@@ -62,68 +83,21 @@ namespace Monitor::Linux
 
 		void OnOpen(std::string_view path, int32_t oflag, int32_t result) override final
 		{
-			bool isWriteOnly = (oflag & O_WRONLY) != 0;
-			bool isReadWrite = (oflag & O_RDWR) != 0;
-			bool isReadOnly = (oflag & O_RDONLY) != 0;
-			bool wasBlocked = false;
-			bool exists = result != -1;
-
-			// TODO: Warn about RW
-
-			// Treat a RW that does not exist as a read only for now
-			if (isWriteOnly || (isReadWrite && exists))
-			{
-				TouchFileWrite(path, wasBlocked);
-			}
-			
-			if (isReadWrite || isReadOnly)
-			{
-				TouchFileRead(path, exists, wasBlocked);
-			}
+			TouchFileOpen(path, oflag, result);
 		}
 
 		void OnOpenAt(int32_t dirfd, std::string_view pathname, int32_t flags, int32_t result) override final
 		{
-			bool isWriteOnly = (flags & O_WRONLY) != 0;
-			bool isReadWrite = (flags & O_RDWR) != 0;
-			bool isReadOnly = (flags & O_RDONLY) != 0;
-			bool wasBlocked = false;
-			bool exists = result != -1;
-
-			// TODO: Warn about RW
-
-			// Treat a RW that does not exist as a read only for now
-			if (isWriteOnly || (isReadWrite && exists))
-			{
-				TouchFileWrite(pathname, wasBlocked);
-			}
-			
-			if (isReadWrite || isReadOnly)
-			{
-				TouchFileRead(pathname, exists, wasBlocked);
-			}
+			// The path arrives resolved against the directory descriptor, the trace listener resolves it
+			// from procfs and the preload client resolves it in the calling process before sending
+			TouchFileOpen(pathname, flags, result);
 		}
 		
 		void OnOpenAt2(int32_t dirfd, std::string_view pathname, int32_t flags, int32_t result) override final
 		{
-			bool isWriteOnly = (flags & O_WRONLY) != 0;
-			bool isReadWrite = (flags & O_RDWR) != 0;
-			bool isReadOnly = (flags & O_RDONLY) != 0;
-			bool wasBlocked = false;
-			bool exists = result != -1;
-
-			// TODO: Warn about RW
-
-			// Treat a RW that does not exist as a read only for now
-			if (isWriteOnly || (isReadWrite && exists))
-			{
-				TouchFileWrite(pathname, wasBlocked);
-			}
-			
-			if (isReadWrite || isReadOnly)
-			{
-				TouchFileRead(pathname, exists, wasBlocked);
-			}
+			// The path arrives resolved against the directory descriptor, the trace listener resolves it
+			// from procfs and the preload client resolves it in the calling process before sending
+			TouchFileOpen(pathname, flags, result);
 		}
 
 		void OnRemove(std::string_view pathname, int32_t result) override final
@@ -209,11 +183,39 @@ namespace Monitor::Linux
 			TouchFileRead(converter.to_bytes(fileName.data()), exists, wasBlocked);
 		}
 
+		void TouchFileOpen(std::string_view fileName, int32_t flags, int32_t result)
+		{
+			auto accessMode = flags & O_ACCMODE;
+			bool isWriteOnly = accessMode == O_WRONLY;
+			bool isReadWrite = accessMode == O_RDWR;
+			bool isReadOnly = accessMode == O_RDONLY;
+			bool wasBlocked = false;
+			bool exists = result != -1;
+
+			// TODO: Warn about RW
+
+			// Treat a RW that does not exist as a read only for now
+			if (isWriteOnly || (isReadWrite && exists))
+			{
+				TouchFileWrite(fileName, wasBlocked);
+			}
+
+			if (isReadWrite || isReadOnly)
+			{
+				TouchFileRead(fileName, exists, wasBlocked);
+			}
+		}
+
 		void TouchFileRead(std::string_view fileName, bool exists, bool wasBlocked)
 		{
+			auto& reported = exists ? _reportedReads : _reportedMissingReads;
+			if (reported.contains(fileName))
+				return;
+
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
+				reported.emplace(fileName);
 				_monitor->TouchFileRead(Path::Parse(fileName), exists, wasBlocked);
 			}
 		}
@@ -226,9 +228,13 @@ namespace Monitor::Linux
 
 		void TouchFileWrite(std::string_view fileName, bool wasBlocked)
 		{
+			if (_reportedWrites.contains(fileName))
+				return;
+
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
+				_reportedWrites.emplace(fileName);
 				_monitor->TouchFileWrite(Path::Parse(fileName), wasBlocked);
 			}
 		}
@@ -241,6 +247,8 @@ namespace Monitor::Linux
 
 		void TouchFileDelete(std::string_view fileName, bool wasBlocked)
 		{
+			// Any later access to the path changes the result again
+			ForgetReported(fileName);
 			_monitor->TouchFileDelete(Path::Parse(fileName), wasBlocked);
 		}
 
@@ -252,9 +260,24 @@ namespace Monitor::Linux
 
 		void TouchFileDeleteOnClose(std::string_view fileName)
 		{
+			ForgetReported(fileName);
 			_monitor->TouchFileDeleteOnClose(Path::Parse(fileName));
 		}
 
+		void ForgetReported(std::string_view fileName)
+		{
+			EraseReported(_reportedReads, fileName);
+			EraseReported(_reportedMissingReads, fileName);
+			EraseReported(_reportedWrites, fileName);
+		}
+
+		static void EraseReported(PathSet& reported, std::string_view fileName)
+		{
+			auto value = reported.find(fileName);
+			if (value != reported.end())
+				reported.erase(value);
+		}
+
 		bool IsSpecialFile(std::string_view fileName)
 		{
 			// Check if the file name is a pipe or the standard input/output streams
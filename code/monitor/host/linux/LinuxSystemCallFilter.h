@@ -0,0 +1,122 @@
+﻿// <copyright file="LinuxSystemCallFilter.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The seccomp programs that select the monitored system calls.
+	/// Each program is compiled once per build process and loaded directly by the launched children.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxSystemCallFilter
+	{
+	private:
+		struct Program
+		{
+			std::vector<sock_filter> Instructions;
+			sock_fprog Value;
+		};
+
+	public:
+		/// <summary>
+		/// Get the program that stops the tracee under ptrace for each monitored system call
+		/// </summary>
+		static const sock_fprog& GetTraceProgram()
+		{
+			static const auto program = Compile(SCMP_ACT_TRACE(1));
+			return program->Value;
+		}
+
+		/// <summary>
+		/// Get the program that notifies the listener for each monitored system call
+		/// </summary>
+		static const sock_fprog& GetNotifyProgram()
+		{
+			static const auto program = Compile(SCMP_ACT_NOTIFY);
+			return program->Value;
+		}
+
+	private:
+		static std::unique_ptr<Program> Compile(uint32_t action)
+		{
+			const int systemCalls[] =
+			{
+				SCMP_SYS(open),
+				SCMP_SYS(openat),
+				SCMP_SYS(openat2),
+				SCMP_SYS(creat),
+				SCMP_SYS(link),
+				SCMP_SYS(linkat),
+				SCMP_SYS(rename),
+				SCMP_SYS(renameat),
+				SCMP_SYS(renameat2),
+				SCMP_SYS(unlink),
+				SCMP_SYS(mkdir),
+				SCMP_SYS(mkdirat),
+				SCMP_SYS(rmdir),
+				// Track the working directory to resolve relative paths, directory descriptors are read when used
+				SCMP_SYS(chdir),
+				SCMP_SYS(fchdir),
+				SCMP_SYS(fork),
+				SCMP_SYS(vfork),
+				SCMP_SYS(clone),
+				SCMP_SYS(clone3),
+				// TODO: Allow first execve when the parent has not connected yet to allow it
+				// Maybe try to filter to the known exe and only allow that and trace others
+				// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
+				// SCMP_SYS(execve),
+				SCMP_SYS(execveat),
+			};
+
+			scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
+			if (ctx == NULL)
+				throw std::runtime_error("seccomp_init failed");
+
+			auto handle = -1;
+			try
+			{
+				for (auto systemCall : systemCalls)
+				{
+					if (seccomp_rule_add(ctx, action, systemCall, 0) < 0)
+						throw std::runtime_error("seccomp_rule_add failed");
+				}
+
+				// Export the raw program so the children can load it without libseccomp
+				handle = memfd_create("soup-seccomp", MFD_CLOEXEC);
+				if (handle < 0)
+					throw std::runtime_error(std::format("memfd_create failed {0}", errno));
+
+				if (seccomp_export_bpf(ctx, handle) < 0)
+					throw std::runtime_error("seccomp_export_bpf failed");
+
+				auto size = lseek(handle, 0, SEEK_END);
+				if (size <= 0 || size % sizeof(sock_filter) != 0)
+					throw std::runtime_error("Invalid seccomp program size");
+
+				auto program = std::make_unique<Program>();
+				program->Instructions.resize(size / sizeof(sock_filter));
+				if (pread(handle, program->Instructions.data(), size, 0) != size)
+					throw std::runtime_error("Failed to read seccomp program");
+
+				program->Value.len = static_cast<unsigned short>(program->Instructions.size());
+				program->Value.filter = program->Instructions.data();
+
+				close(handle);
+				seccomp_release(ctx);
+				return program;
+			}
+			catch (...)
+			{
+				if (handle >= 0)
+					close(handle);
+				seccomp_release(ctx);
+				throw;
+			}
+		}
+	};
+}
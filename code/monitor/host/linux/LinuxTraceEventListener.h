@@ -4,6 +4,8 @@
 
 #pragma once
 #include "ILinuxSystemMonitor.h"
+#include "LinuxProcessPathTable.h"
+#include "LinuxTraceeMemory.h"
 
 namespace Monitor::Linux
 {
@@ -15,12 +17,6 @@ namespace Monitor::Linux
 		std::array<long, 6> Arguments;
 	};
 
-	typedef union {
-		long val;
-		int32_t intData[sizeof(long) / sizeof(int32_t)];
-		char data[sizeof(long)];
-	} dissected_long_t;
-	
 	/// <summary>
 	/// The event listener knows how to parse an incoming message and pass it along to the
 	/// registered monitor.
@@ -31,13 +27,19 @@ namespace Monitor::Linux
 		// Input
 		std::shared_ptr<ILinuxSystemMonitor> m_monitor;
 
+		// Runtime
+		bool m_isSysCallInfoSupported;
+		LinuxProcessPathTable m_pathTable;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxTraceEventListener'/> class.
 		/// </summary>
 		LinuxTraceEventListener(
 			std::shared_ptr<ILinuxSystemMonitor> monitor) :
-			m_monitor(std::move(monitor))
+			m_monitor(std::move(monitor)),
+			m_isSysCallInfoSupported(true),
+			m_pathTable()
 		{
 		}
 
@@ -46,9 +48,99 @@ namespace Monitor::Linux
 			m_monitor->OnError(message);
 		}
 
+		/// <summary>
+		/// Capture the system call number and arguments while the tracee is stopped on the seccomp event
+		/// Returns false if the kernel cannot report them and the registers must be read on completion
+		/// </summary>
+		bool TryGetSysCallEntry(pid_t pid, SysCallStatus& entry)
+		{
+			if (!m_isSysCallInfoSupported)
+				return false;
+
+			__ptrace_syscall_info info;
+			if (ptrace(PTRACE_GET_SYSCALL_INFO, pid, sizeof(info), &info) == -1)
+			{
+				if (errno != EIO && errno != EINVAL)
+					throw std::runtime_error(std::format("PTRACE_GET_SYSCALL_INFO failed {0}", errno));
+
+				// Kernels before 5.3 do not know the request
+				m_isSysCallInfoSupported = false;
+				return false;
+			}
+
+			if (info.op != PTRACE_SYSCALL_INFO_SECCOMP)
+				return false;
+
+			entry.Command = (long)info.seccomp.nr;
+			entry.Return = 0;
+			entry.Error = 0;
+			for (auto i = 0u; i < entry.Arguments.size(); i++)
+				entry.Arguments[i] = (long)info.seccomp.args[i];
+
+			return true;
+		}
+
+		/// <summary>
+		/// Process a completed system call using the registers of the tracee
+		/// </summary>
 		void ProcessSysCall(pid_t pid)
 		{
-			auto registers = GetSysCallArgs(pid);
+			HandleSysCall(pid, GetSysCallArgs(pid), false);
+		}
+
+		/// <summary>
+		/// Process a completed system call that was captured by <see cref='TryGetSysCallEntry'/>
+		/// </summary>
+		void ProcessSysCall(pid_t pid, SysCallStatus entry)
+		{
+			__ptrace_syscall_info info;
+			if (ptrace(PTRACE_GET_SYSCALL_INFO, pid, sizeof(info), &info) == -1)
+				throw std::runtime_error(std::format("PTRACE_GET_SYSCALL_INFO failed {0}", errno));
+			if (info.op != PTRACE_SYSCALL_INFO_EXIT)
+				throw std::runtime_error("Expected to be at a system call exit");
+
+			if (info.exit.is_error)
+			{
+				entry.Return = -1;
+				entry.Error = (long)-info.exit.rval;
+			}
+			else
+			{
+				entry.Return = (long)info.exit.rval;
+			}
+
+			HandleSysCall(pid, entry, false);
+		}
+
+		/// <summary>
+		/// Process a system call from a seccomp user notification before the kernel has run it
+		/// The reported results are predicted, opens are checked with PredictOpenResult and every
+		/// other call keeps the zero result from the notification as if it succeeded
+		/// </summary>
+		void ProcessSysCallNotification(pid_t pid, const SysCallStatus& entry)
+		{
+			HandleSysCall(pid, entry, true);
+		}
+
+		/// <summary>
+		/// The traced process replaced its image
+		/// </summary>
+		void ProcessExec(pid_t pid)
+		{
+			m_pathTable.OnExec(pid);
+		}
+
+		/// <summary>
+		/// The traced process exited
+		/// </summary>
+		void ProcessExit(pid_t pid)
+		{
+			m_pathTable.OnExit(pid);
+		}
+
+	private:
+		void HandleSysCall(pid_t pid, const SysCallStatus& registers, bool isPending)
+		{
 			auto args = registers.Arguments;
 			auto result = registers.Return;
 			switch (registers.Command)
@@ -56,30 +148,30 @@ namespace Monitor::Linux
 				// FileApi
 				case SCMP_SYS(creat):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto path = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
 					m_monitor->OnCreat(path, result);
 					break;
 				}
 				case SCMP_SYS(link):
 				{
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[0]);
-					auto newpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto oldpath = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
+					auto newpath = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					m_monitor->OnLink(oldpath, newpath, result);
 					break;
 				}
 				case SCMP_SYS(linkat):
 				{
 					auto olddirfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto oldpath = ResolvePath(pid, olddirfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto newdirfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto newpath = ResolvePath(pid, newdirfd, ReadNullTerminatedStringValue(pid, args[3]), isPending);
 					auto flags = (int32_t)args[4];
 					m_monitor->OnLinkAt(olddirfd, oldpath, newdirfd, newpath, flags, result);
 					break;
 				}
 				case SCMP_SYS(mkdir):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto path = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
 					auto mode = (uint32_t)args[1];
 					m_monitor->OnMkdir(path, mode, result);
 					break;
@@ -87,71 +179,83 @@ namespace Monitor::Linux
 				case SCMP_SYS(mkdirat):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto path = ResolvePath(pid, dirfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto mode = (uint32_t)args[2];
 					m_monitor->OnMkdirAt(dirfd, path, mode, result);
 					break;
 				}
 				case SCMP_SYS(open):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto path = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
 					auto oflag = (int32_t)args[1];
+					if (isPending)
+						result = PredictOpenResult(path, oflag);
 					m_monitor->OnOpen(path, oflag, result);
 					break;
 				}
 				case SCMP_SYS(openat):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto path = ResolvePath(pid, dirfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto oflag = (int32_t)args[2];
+					if (isPending)
+						result = PredictOpenResult(path, oflag);
 					m_monitor->OnOpenAt(dirfd, path, oflag, result);
 					break;
 				}
 				case SCMP_SYS(openat2):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto path = ResolvePath(pid, dirfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto oflag = (int32_t)args[2];
+					if (isPending)
+						result = PredictOpenResult(path, oflag);
 					m_monitor->OnOpenAt2(dirfd, path, oflag, result);
 					break;
 				}
 				case SCMP_SYS(rename):
 				{
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[0]);
-					auto newpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto oldpath = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
+					auto newpath = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					m_monitor->OnRename(oldpath, newpath, result);
 					break;
 				}
 				case SCMP_SYS(renameat):
 				{
 					auto oldfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto oldpath = ResolvePath(pid, oldfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto newfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto newpath = ResolvePath(pid, newfd, ReadNullTerminatedStringValue(pid, args[3]), isPending);
 					m_monitor->OnRenameAt(oldfd, oldpath, newfd, newpath, result);
 					break;
 				}
 				case SCMP_SYS(renameat2):
 				{
 					auto oldfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto oldpath = ResolvePath(pid, oldfd, ReadNullTerminatedStringValue(pid, args[1]), isPending);
 					auto newfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto newpath = ResolvePath(pid, newfd, ReadNullTerminatedStringValue(pid, args[3]), isPending);
 					m_monitor->OnRenameAt2(oldfd, oldpath, newfd, newpath, result);
 					break;
 				}
 				case SCMP_SYS(rmdir):
 				{
-					auto pathname = ReadNullTerminatedStringValue(pid, args[0]);
+					auto pathname = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
 					m_monitor->OnRmdir(pathname, result);
 					break;
 				}
 				case SCMP_SYS(unlink):
 				{
-					auto pathname = ReadNullTerminatedStringValue(pid, args[0]);
+					auto pathname = ResolvePath(pid, AT_FDCWD, ReadNullTerminatedStringValue(pid, args[0]), isPending);
 					m_monitor->OnUnlink(pathname, result);
 					break;
 				}
+				case SCMP_SYS(chdir):
+				case SCMP_SYS(fchdir):
+				{
+					m_pathTable.OnChangeDirectory();
+					break;
+				}
 
 				// ProcessApi
 				case SCMP_SYS(clone):
@@ -193,7 +297,6 @@ namespace Monitor::Linux
 			}
 		}
 
-	private:
 		SysCallStatus GetSysCallArgs(pid_t pid)
 		{
 			user_regs_struct regs;
@@ -227,61 +330,37 @@ namespace Monitor::Linux
 			};
 		}
 
-		std::string ReadNullTerminatedStringValue(pid_t pid, long addr)
+		/// <summary>
+		/// Resolve the path passed to a system call relative to the directories of the tracee
+		/// A pending system call has not updated the descriptors yet so the table cannot be trusted
+		/// </summary>
+		std::string ResolvePath(pid_t pid, int32_t dirfd, std::string path, bool isPending)
 		{
-			auto result = std::string(1024, '\0');
-
-			char *laddr = result.data();
-
-			unsigned long len = 1024;
-			unsigned int nread = 0;
-			unsigned int residue = addr & (sizeof(long) - 1);
-			void *const orig_addr = laddr;
-
-			// aligned address
-			addr &= -sizeof(long);
-
-			while (len)
-			{
-				errno = 0;
-				dissected_long_t u = {
-					.val = ptrace(PTRACE_PEEKDATA, pid, addr, 0)
-				};
+			if (isPending)
+				return LinuxProcessPathTable::ResolvePathUncached(pid, dirfd, std::move(path));
+			else
+				return m_pathTable.ResolvePath(pid, dirfd, std::move(path));
+		}
 
-				switch (errno)
-				{
-					case 0:
-						break;
-					case ESRCH:
-					case EINVAL:
-						throw std::runtime_error("Could be seen if the process is gone");
-					case EFAULT:
-					case EIO:
-					case EPERM:
-						throw std::runtime_error("address space is inaccessible");
-					default:
-						throw std::runtime_error("all the rest is strange and should be reported");
-				}
+		/// <summary>
+		/// Predict the result of an open that has not run yet from the current state of the file system
+		/// This is only an existence check, permission failures and races with other processes are not seen
+		/// </summary>
+		long PredictOpenResult(const std::string& path, int32_t oflag)
+		{
+			if ((oflag & O_CREAT) != 0)
+				return 0;
 
-				unsigned long m = std::min(sizeof(long) - residue, len);
-				memcpy(laddr, &u.data[residue], m);
-				while (residue < sizeof(long))
-				{
-					if (u.data[residue++] == '\0')
-					{
-						result.resize(nread + residue - 1);
-						return result;
-					}
-				}
+			// The path could not be resolved, the tracee is gone
+			if (!path.starts_with('/'))
+				return -1;
 
-				residue = 0;
-				addr += sizeof(long);
-				laddr += m;
-				nread += m;
-				len -= m;
-			}
+			return faccessat(AT_FDCWD, path.c_str(), F_OK, 0) == 0 ? 0 : -1;
+		}
 
-			return result;
+		std::string ReadNullTerminatedStringValue(pid_t pid, long addr)
+		{
+			return LinuxTraceeMemory::ReadNullTerminatedString(pid, addr);
 		}
 	};
 }
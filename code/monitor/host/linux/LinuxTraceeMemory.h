@@ -0,0 +1,144 @@
+﻿// <copyright file="LinuxTraceeMemory.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	typedef union {
+		long val;
+		int32_t intData[sizeof(long) / sizeof(int32_t)];
+		char data[sizeof(long)];
+	} dissected_long_t;
+
+	/// <summary>
+	/// Reads values out of the address space of a stopped tracee
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxTraceeMemory
+	{
+	public:
+		// The longest string that will be read from the tracee, anything longer is truncated
+		static constexpr size_t MaxStringLength = 1024;
+
+		/// <summary>
+		/// Read a null terminated string with as few copies from the tracee as possible
+		/// Each read covers the remainder of the current page and the next page so a typical path is
+		/// a single system call, an unmapped page only truncates the read to the pages that were valid
+		/// </summary>
+		static std::string ReadNullTerminatedString(pid_t pid, long addr)
+		{
+			static auto isVirtualMemoryReadSupported = std::atomic<bool>(true);
+			if (!isVirtualMemoryReadSupported)
+				return PeekNullTerminatedString(pid, addr);
+
+			static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+			auto result = std::string(MaxStringLength, '\0');
+			size_t nread = 0;
+			while (nread < MaxStringLength)
+			{
+				auto address = static_cast<size_t>(addr) + nread;
+				auto remaining = MaxStringLength - nread;
+				auto firstLength = std::min(pageSize - (address % pageSize), remaining);
+				auto secondLength = std::min(pageSize, remaining - firstLength);
+
+				iovec local = { result.data() + nread, firstLength + secondLength };
+				iovec remote[2] = {
+					{ reinterpret_cast<void*>(address), firstLength },
+					{ reinterpret_cast<void*>(address + firstLength), secondLength },
+				};
+
+				auto count = process_vm_readv(pid, &local, 1, remote, secondLength > 0 ? 2 : 1, 0);
+				if (count <= 0)
+				{
+					switch (errno)
+					{
+						case ENOSYS:
+							// The kernel does not support cross memory attach
+							isVirtualMemoryReadSupported = false;
+							return PeekNullTerminatedString(pid, addr);
+						case ESRCH:
+							throw std::runtime_error("Could be seen if the process is gone");
+						default:
+							// Let the word at a time read handle memory that cannot be attached to directly
+							return PeekNullTerminatedString(pid, addr);
+					}
+				}
+
+				auto terminator = memchr(result.data() + nread, '\0', count);
+				if (terminator != nullptr)
+				{
+					result.resize(static_cast<char*>(terminator) - result.data());
+					return result;
+				}
+
+				nread += count;
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Read a null terminated string from the tracee one machine word at a time
+		/// </summary>
+		static std::string PeekNullTerminatedString(pid_t pid, long addr)
+		{
+			auto result = std::string(MaxStringLength, '\0');
+
+			char *laddr = result.data();
+
+			unsigned long len = MaxStringLength;
+			unsigned int nread = 0;
+			unsigned int residue = addr & (sizeof(long) - 1);
+
+			// aligned address
+			addr &= -sizeof(long);
+
+			while (len)
+			{
+				errno = 0;
+				dissected_long_t u = {
+					.val = ptrace(PTRACE_PEEKDATA, pid, addr, 0)
+				};
+
+				switch (errno)
+				{
+					case 0:
+						break;
+					case ESRCH:
+					case EINVAL:
+						throw std::runtime_error("Could be seen if the process is gone");
+					case EFAULT:
+					case EIO:
+					case EPERM:
+						throw std::runtime_error("address space is inaccessible");
+					default:
+						throw std::runtime_error("all the rest is strange and should be reported");
+				}
+
+				unsigned long m = std::min(sizeof(long) - residue, len);
+				memcpy(laddr, &u.data[residue], m);
+				while (residue < sizeof(long))
+				{
+					if (u.data[residue++] == '\0')
+					{
+						result.resize(nread + residue - 1);
+						return result;
+					}
+				}
+
+				residue = 0;
+				addr += sizeof(long);
+				laddr += m;
+				nread += m;
+				len -= m;
+			}
+
+			return result;
+		}
+	};
+}
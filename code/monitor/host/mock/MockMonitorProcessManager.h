@@ -18,6 +18,9 @@ namespace Monitor
 	{
 	private:
 		std::atomic<int> m_uniqueId;
+
+		// Serialize the processes started by concurrent evaluations so the shared request log stays ordered
+		std::mutex _processMutex;
 		std::vector<std::string> _requests;
 		std::map<std::string, std::string> _executeResults;
 		std::map<std::string, std::function<void(ISystemAccessMonitor&)>> _executeMonitors;
@@ -28,6 +31,7 @@ namespace Monitor
 		/// </summary>
 		MockMonitorProcessManager() :
 			m_uniqueId(1),
+			_processMutex(),
 			_requests(),
 			_executeResults()
 		{
@@ -76,8 +80,8 @@ namespace Monitor
 			std::shared_ptr<ISystemAccessMonitor> monitor,
 			bool enableAccessChecks,
 			bool partialMonitor,
-			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) override final
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess) override final
 		{
 			std::stringstream message;
 			auto id = m_uniqueId++;
@@ -87,8 +91,8 @@ namespace Monitor
 			message << " Environment [" << environmentVariables.size() << "]";
 			message << " " << enableAccessChecks;
 			message << " " << partialMonitor;
-			message << " AllowedRead [" << allowedReadAccess.size() << "]";
-			message << " AllowedWrite [" << allowedWriteAccess.size() << "]";
+			message << " AllowedRead [" << allowedReadAccess->size() << "]";
+			message << " AllowedWrite [" << allowedWriteAccess->size() << "]";
 
 			_requests.push_back(message.str());
 
@@ -120,5 +124,36 @@ namespace Monitor
 					std::string());
 			}
 		}
+
+		/// <summary>
+		/// Run the mock process to completion while holding the process lock
+		/// </summary>
+		void StartMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			const std::map<std::string, std::string>& environmentVariables,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			bool enableAccessChecks,
+			bool partialMonitor,
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess,
+			MonitorProcessOutputCallback onOutput,
+			MonitorProcessCallback onExited) override final
+		{
+			auto lock = std::lock_guard<std::mutex>(_processMutex);
+			IMonitorProcessManager::StartMonitorProcess(
+				executable,
+				std::move(arguments),
+				workingDirectory,
+				environmentVariables,
+				std::move(monitor),
+				enableAccessChecks,
+				partialMonitor,
+				std::move(allowedReadAccess),
+				std::move(allowedWriteAccess),
+				std::move(onOutput),
+				std::move(onExited));
+		}
 	};
 }
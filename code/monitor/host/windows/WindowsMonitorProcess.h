@@ -39,8 +39,8 @@ namespace Monitor::Windows
 
 		bool m_enableAccessChecks;
 		bool m_partialMonitor;
-		std::vector<Path> m_allowedReadAccess;
-		std::vector<Path> m_allowedWriteAccess;
+		std::shared_ptr<const std::vector<Path>> m_allowedReadAccess;
+		std::shared_ptr<const std::vector<Path>> m_allowedWriteAccess;
 
 		// Runtime
 		std::thread m_workerThread;
@@ -80,8 +80,8 @@ namespace Monitor::Windows
 			std::shared_ptr<ISystemAccessMonitor> monitor,
 			bool enableAccessChecks,
 			bool partialMonitor,
-			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) :
+			std::shared_ptr<const std::vector<Path>> allowedReadAccess,
+			std::shared_ptr<const std::vector<Path>> allowedWriteAccess) :
 			m_executable(executable),
 			m_arguments(std::move(arguments)),
 			m_workingDirectory(workingDirectory),
@@ -280,8 +280,8 @@ namespace Monitor::Windows
 
 			// Pass along the read/write access lists
 			payload.EnableAccessChecks = m_enableAccessChecks;
-			LoadStringList(m_allowedReadAccess, payload.zReadAccessDirectories, payload.cReadAccessDirectories, 4096);
-			LoadStringList(m_allowedWriteAccess, payload.zWriteAccessDirectories, payload.cWriteAccessDirectories, 4096);
+			LoadStringList(*m_allowedReadAccess, payload.zReadAccessDirectories, payload.cReadAccessDirectories, 4096);
+			LoadStringList(*m_allowedWriteAccess, payload.zWriteAccessDirectories, payload.cWriteAccessDirectories, 4096);
 
 			if (!DetourCopyPayloadToProcess(
 				m_processHandle.Get(),
@@ -12,5 +12,8 @@ namespace Monitor
 		Error,
 
 		Detour,
+
+		// The sending thread is about to run a static executable and waits for the host to trace it
+		TraceRequest,
 	};
 }
\ No newline at end of file
@@ -17,6 +17,15 @@ module;
 #include <strsafe.h>
 #pragma warning(pop)
 
+#elif defined(__linux__)
+
+#include <linux/filter.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+
 #endif
 
 #include <stdio.h>
@@ -26,9 +35,12 @@ module;
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 #include <atomic>
 #include <array>
+#include <chrono>
 #include <codecvt>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <new>
 #include <string>
 #include <sstream>
 #include <thread>
@@ -54,6 +66,8 @@ export void ThrowIfFailed(int32_t result, std::string_view message)
 #elif defined(__linux__)
 
 #include "linux/DetourEventType.h"
+#include "linux/ProcessPayload.h"
+#include "linux/MessageRing.h"
 
 #endif
 
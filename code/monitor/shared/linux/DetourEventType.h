@@ -38,5 +38,7 @@ namespace Monitor::Linux
 		execve,
 		execveat,
 		fexecve,
+		posix_spawn,
+		posix_spawnp,
 	};
 }
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+#include "../Message.h"
+#include "ProcessPayload.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A bounded multiple producer, single consumer queue of messages that lives in shared memory
+	/// Every process in the monitored tree maps the same region and claims slots with an atomic increment,
+	/// each slot carries a sequence number that publishes the message to the host once it is fully written.
+	/// A writer that dies after claiming a slot would stall the reader forever, so the reader skips a slot
+	/// that stays claimed for longer than the abandoned slot timeout and a late writer drops its message.
+	/// A skipped slot is a lost access record, the host must fail the monitored operation when any were skipped.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class MessageRing
+	{
+	private:
+		static constexpr uint32_t Version = 2;
+
+		// Writing a message is a single copy, a slot claimed for this long belongs to a writer that is gone
+		static constexpr std::chrono::milliseconds AbandonedSlotTimeout = std::chrono::milliseconds(1000);
+
+		struct Slot
+		{
+			std::atomic<uint64_t> Sequence;
+			Message Value;
+		};
+
+		struct Header
+		{
+			uint32_t Version;
+			uint32_t SlotCount;
+			ProcessPayload Payload;
+
+			// Keep the producer and consumer counters on their own cache lines
+			alignas(64) std::atomic<uint64_t> WriteIndex;
+			alignas(64) std::atomic<uint64_t> ReadIndex;
+			alignas(64) std::atomic<uint32_t> IsReaderWaiting;
+		};
+
+		static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory requires lock free atomics");
+		static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory requires lock free atomics");
+
+		Header* _header;
+		Slot* _slots;
+
+		// Reader state, only the single reader tracks how long the next slot has been claimed
+		uint64_t _stalledPosition;
+		std::chrono::steady_clock::time_point _stalledSince;
+		uint64_t _abandonedCount;
+
+	public:
+		/// <summary>
+		/// Get the size of the shared memory required for the requested number of slots
+		/// </summary>
+		static size_t GetSize(uint32_t slotCount)
+		{
+			return sizeof(Header) + (sizeof(Slot) * slotCount);
+		}
+
+		/// <summary>
+		/// Get the number of slots in an existing ring from the start of its shared memory
+		/// </summary>
+		static uint32_t GetSlotCount(const void* memory)
+		{
+			auto header = static_cast<const Header*>(memory);
+			if (header->Version != Version)
+				throw std::runtime_error("Unknown message ring version");
+
+			return header->SlotCount;
+		}
+
+		/// <summary>
+		/// Create a new empty ring in the provided shared memory, the slot count must be a power of two
+		/// </summary>
+		static MessageRing Create(void* memory, uint32_t slotCount)
+		{
+			if (slotCount == 0 || (slotCount & (slotCount - 1)) != 0)
+				throw std::runtime_error("Message ring slot count must be a power of two");
+
+			auto header = new (memory) Header();
+			header->Version = Version;
+			header->SlotCount = slotCount;
+			header->WriteIndex.store(0, std::memory_order_relaxed);
+			header->ReadIndex.store(0, std::memory_order_relaxed);
+			header->IsReaderWaiting.store(0, std::memory_order_relaxed);
+
+			auto slots = reinterpret_cast<Slot*>(header + 1);
+			for (uint32_t i = 0; i < slotCount; i++)
+			{
+				auto slot = new (&slots[i]) Slot();
+				slot->Sequence.store(i, std::memory_order_relaxed);
+			}
+
+			return MessageRing(memory);
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MessageRing"/> class over an existing ring
+		/// </summary>
+		MessageRing(void* memory) :
+			_header(static_cast<Header*>(memory)),
+			_slots(reinterpret_cast<Slot*>(reinterpret_cast<uintptr_t>(memory) + sizeof(Header))),
+			_stalledPosition(std::numeric_limits<uint64_t>::max()),
+			_stalledSince(),
+			_abandonedCount(0)
+		{
+		}
+
+		ProcessPayload& GetPayload()
+		{
+			return _header->Payload;
+		}
+
+		/// <summary>
+		/// Get the number of claimed slots the reader gave up on because the writer never published them.
+		/// The observed accesses are incomplete when this is not zero.
+		/// </summary>
+		uint64_t GetAbandonedCount() const
+		{
+			return _abandonedCount;
+		}
+
+		/// <summary>
+		/// Write a message, waiting for the host to drain the ring if it is full.
+		/// Returns false if the reader already gave up on the claimed slot and the message was dropped.
+		/// </summary>
+		bool Write(const Message& message)
+		{
+			auto mask = static_cast<uint64_t>(_header->SlotCount) - 1;
+			auto position = _header->WriteIndex.load(std::memory_order_relaxed);
+			Slot* slot;
+			while (true)
+			{
+				slot = &_slots[position & mask];
+				auto sequence = slot->Sequence.load(std::memory_order_acquire);
+				auto difference = static_cast<int64_t>(sequence - position);
+				if (difference == 0)
+				{
+					// Claim the slot
+					if (_header->WriteIndex.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (difference < 0)
+				{
+					// The ring is full, give the host a chance to catch up
+					WakeReader();
+					sched_yield();
+					position = _header->WriteIndex.load(std::memory_order_relaxed);
+				}
+				else
+				{
+					// Another writer claimed the slot first
+					position = _header->WriteIndex.load(std::memory_order_relaxed);
+				}
+			}
+
+			// Only copy the used portion of the message
+			auto size = sizeof(Message::Type) + sizeof(Message::ContentSize) + message.ContentSize;
+			memcpy(&slot->Value, &message, size);
+
+			// Publish the slot unless the reader skipped it while this writer was stalled
+			auto expected = position;
+			if (!slot->Sequence.compare_exchange_strong(
+				expected, position + 1, std::memory_order_release, std::memory_order_relaxed))
+			{
+				return false;
+			}
+
+			// Pairs with the fence in WaitForMessage so either the reader sees the message or the writer sees the waiter
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (_header->IsReaderWaiting.load(std::memory_order_relaxed) != 0)
+				WakeReader();
+
+			return true;
+		}
+
+		/// <summary>
+		/// Read the next published message, only a single reader is supported
+		/// </summary>
+		bool TryRead(Message& message)
+		{
+			auto position = _header->ReadIndex.load(std::memory_order_relaxed);
+			auto slot = &_slots[position & (static_cast<uint64_t>(_header->SlotCount) - 1)];
+			while (slot->Sequence.load(std::memory_order_acquire) != position + 1)
+			{
+				if (!TrySkipAbandonedSlot(*slot, position))
+					return false;
+
+				position = _header->ReadIndex.load(std::memory_order_relaxed);
+				slot = &_slots[position & (static_cast<uint64_t>(_header->SlotCount) - 1)];
+			}
+
+			auto size = sizeof(Message::Type) + sizeof(Message::ContentSize) + slot->Value.ContentSize;
+			memcpy(&message, &slot->Value, std::min(size, sizeof(Message)));
+
+			// Release the slot for the writer one full lap ahead
+			slot->Sequence.store(position + _header->SlotCount, std::memory_order_release);
+			_header->ReadIndex.store(position + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// <summary>
+		/// Block until a writer publishes a message or the timeout expires
+		/// </summary>
+		void WaitForMessage(std::chrono::milliseconds timeout)
+		{
+			_header->IsReaderWaiting.store(1, std::memory_order_relaxed);
+
+			// Check again after advertising the wait so a concurrent write is never missed
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			auto position = _header->ReadIndex.load(std::memory_order_relaxed);
+			auto& slot = _slots[position & (static_cast<uint64_t>(_header->SlotCount) - 1)];
+			if (slot.Sequence.load(std::memory_order_acquire) != position + 1)
+			{
+				auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+				timespec time = {
+					static_cast<time_t>(seconds.count()),
+					static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds).count()),
+				};
+				syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_header->IsReaderWaiting), FUTEX_WAIT, 1, &time, nullptr, 0);
+			}
+
+			_header->IsReaderWaiting.store(0, std::memory_order_relaxed);
+		}
+
+	private:
+		/// <summary>
+		/// Skip the next slot if a writer claimed it and never published the message
+		/// </summary>
+		bool TrySkipAbandonedSlot(Slot& slot, uint64_t position)
+		{
+			// Nothing to skip until a writer has claimed the slot
+			if (_header->WriteIndex.load(std::memory_order_relaxed) <= position)
+				return false;
+
+			auto now = std::chrono::steady_clock::now();
+			if (_stalledPosition != position)
+			{
+				_stalledPosition = position;
+				_stalledSince = now;
+				return false;
+			}
+
+			if (now - _stalledSince < AbandonedSlotTimeout)
+				return false;
+
+			// Release the slot for the next lap, this fails if the writer published in the meantime
+			auto expected = position;
+			if (slot.Sequence.compare_exchange_strong(
+				expected, position + _header->SlotCount, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				_header->ReadIndex.store(position + 1, std::memory_order_relaxed);
+				_abandonedCount++;
+			}
+
+			return true;
+		}
+
+		void WakeReader()
+		{
+			// Shared futex, the ring is mapped into other processes
+			_header->IsReaderWaiting.store(0, std::memory_order_release);
+			syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_header->IsReaderWaiting), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+		}
+	};
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#ifdef SOUP_BUILD
+export
+#endif
+namespace Monitor::Linux
+{
+	// The environment variable that passes the inherited shared memory handle to each monitored process
+	constexpr const char* MessageRingHandleVariable = "SOUP_MONITOR_RING";
+
+	// The largest seccomp program the host can hand to a process that runs a static executable
+	constexpr uint32_t MaxTraceProgramLength = 256;
+
+	struct ProcessPayload
+	{
+		uint32_t nTraceProcessId;
+		char zWorkingDirectory[256];
+		uint32_t EnableAccessChecks;
+		uint32_t cReadAccessDirectories;
+		char zReadAccessDirectories[4096];
+		uint32_t cWriteAccessDirectories;
+		char zWriteAccessDirectories[4096];
+		uint32_t cTraceProgram;
+		sock_filter TraceProgram[MaxTraceProgramLength];
+	};
+}
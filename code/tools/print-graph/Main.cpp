@@ -72,8 +72,8 @@ void PrintOperations(Soup::Core::OperationGraph& graph)
 		std::cout << "  Command-Arguments: " << ToString(operationInfo.Command.Arguments) << std::endl;
 		std::cout << "  DeclaredInput: " << ToString(operationInfo.DeclaredInput) << std::endl;
 		std::cout << "  DeclaredOutput: " << ToString(operationInfo.DeclaredOutput) << std::endl;
-		std::cout << "  ReadAccess: " << ToString(operationInfo.ReadAccess) << std::endl;
-		std::cout << "  WriteAccess: " << ToString(operationInfo.WriteAccess) << std::endl;
+		std::cout << "  ReadAccess: " << ToString(operationInfo.ReadAccess.GetFiles()) << std::endl;
+		std::cout << "  WriteAccess: " << ToString(operationInfo.WriteAccess.GetFiles()) << std::endl;
 		std::cout << "  Children: " << ToString(operationInfo.Children) << std::endl;
 		std::cout << "  DependencyCount: " << operationInfo.DependencyCount << std::endl;
 	}
@@ -12,7 +12,8 @@ void PrintUsage()
 	std::cout << "printresults [path]" << std::endl;
 }
 
-std::string ToString(const std::vector<uint32_t>& valueList)
+template<typename T>
+std::string ToString(const T& valueList)
 {
 	auto builder = std::stringstream();
 	builder << "[";
@@ -69,6 +70,18 @@ void PrintResults(Soup::Core::OperationResults& results)
 		std::cout << "\tWasSuccessfulRun: " << operationResult.WasSuccessfulRun << std::endl;
 		std::cout << "\tObservedInput: " << ToString(operationResult.ObservedInput) << std::endl;
 		std::cout << "\tObservedOutput: " << ToString(operationResult.ObservedOutput) << std::endl;
+
+		auto& resourceUsage = operationResult.ResourceUsage;
+		if (resourceUsage != Soup::Core::OperationResourceUsage())
+		{
+			std::cout << "\tWallTime: " << resourceUsage.WallTime.count() << "us" << std::endl;
+			std::cout << "\tUserTime: " << resourceUsage.UserTime.count() << "us" << std::endl;
+			std::cout << "\tSystemTime: " << resourceUsage.SystemTime.count() << "us" << std::endl;
+			std::cout << "\tMaxResidentSetSize: " << resourceUsage.MaxResidentSetSize << std::endl;
+			std::cout << "\tContextSwitches: " << resourceUsage.VoluntaryContextSwitches <<
+				" voluntary, " << resourceUsage.InvoluntaryContextSwitches << " involuntary" << std::endl;
+			std::cout << "\tMonitorEventCount: " << resourceUsage.MonitorEventCount << std::endl;
+		}
 	}
 }
 